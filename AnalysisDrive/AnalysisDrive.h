@@ -17,6 +17,19 @@
 /* JSON */
 #include "Json.h"               // JSONIuWFNg
 #include "JsonParser.h"         // JSONp[T[
+#include "JsonHandler.h"        // JSONp[XCxg̃nh
+#include "JsonArena.h"          // JSONIuWFNgpA[i
+#include "JsonStringView.h"     // JSONstringl̎Q
+#include "JsonSpan.h"           // JSONarray̘Ä̎Q
+#include "JsonKey.h"            // JSONobjectname
+#include "JsonObject.h"         // JSONIuWFNgobject^
+#include "JsonBind.h"           // JSONC++̌^̑Ήt
+#include "JsonPath.h"           // JSONIuWFNg̃pX(JSON Pointer)
+#include "JsonDocument.h"       // JSONhLg
+#include "JsonView.h"           // JSONIuWFNg̎Q
+#include "JsonSink.h"           // JSONo͐
+#include "JsonWriter.h"         // JSON`̏̕o
+#include "FormatDouble.h"       // double^̒l̕ϊ
 /* MessgaePack */
 #include "MsgpackParser.h"      // MessagePackp[T[
 /* ̑ */
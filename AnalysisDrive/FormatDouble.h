@@ -0,0 +1,39 @@
+/**
+ * @file   FormatDouble.h
+ * @brief  double^̒l̕ϊ
+ * @author kyo
+ * @date   2026/10/17
+ */
+#ifndef ANALYSISDRIVE_FORMATDOUBLE_H_
+#define ANALYSISDRIVE_FORMATDOUBLE_H_
+
+#include <cstddef>
+#include <string>
+
+/** Analysis Drive */
+namespace adlib
+{
+//> FormatDoublȅo͂ɕKvȃobt@TCY(byte. I[܂)
+const size_t FORMAT_DOUBLE_BUFFER_SIZE = 32;
+
+/**
+ * double^̒l, ̒lɖ߂ŒZ10i̕ɕϊ
+ * @param[in]  value  l
+ * @param[out] buffer i[(FORMAT_DOUBLE_BUFFER_SIZEȏ. I[t)
+ * @return ̃TCY(I[)
+ * @remarks Schubfach̕@, ̒lɖ߂ŒŽ10i(Ό̒lɍł߂)߂. <br>
+ *          10ȉ_̈ʒu-4傫16ȉłΌŒ菬_`(: 0.001, 100.0),
+ *          ȊO͎w`(: 1e-05, 1.5e+300)ŏo͂. lɂ_ȉt. <br>
+ *          P[ɈˑȂ. NaN, "nan", "inf", "-inf"o͂.
+ */
+size_t FormatDouble(double value, char* buffer);
+
+/**
+ * double^̒l, ̒lɖ߂ŒZ10i̕ɕϊ
+ * @param[in] value l
+ * @return 
+ * @remarks ڍׂFormatDouble(double, char*)Q
+ */
+std::string FormatDouble(double value);
+}
+#endif // ANALYSISDRIVE_FORMATDOUBLE_H_
@@ -7,18 +7,43 @@
 #ifndef ANALYSISDRIVE_JSON_H_
 #define ANALYSISDRIVE_JSON_H_
 
+#include "JsonArena.h"
+#include "JsonKey.h"
+#include "JsonSpan.h"
+#include "JsonStringView.h"
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
-#include <unordered_map>
 #include <ostream>
 
 /** Analysis Drive */
 namespace adlib
 {
-/** JSONIuWFNg */
+// O錾
+class JsonValue;
+class JsonObject;
+class JsonDocument;
+class JsonPath;
+class JsonSink;
+
+/**
+ * JSONIuWFNg
+ * @remarks const̃o֐(GetArray, GetObject, Find, At, DumpȂǂconst),
+ *          JsonIuWFNgɑ΂ĕXbh瓯ɌĂł悢
+ *          (l̕ύX, const̃o֐̌ĂяoƓɂ͌Ă΂Ȃ). <br>
+ *          ÄɕێĂarray, constGetArray̏̌Ăяoɗvfq[vɍ쐬
+ *          (rς. mۂꍇGetDoubleSpan, GetInt64Span, ܂JsonViewgp).
+ * @attention constGetArray, GetObject, ^قȂꍇɃvOŜŋL̒lԂ.
+ *            ʂJsonIuWFNgłĂXbh瓯ɌĂ΂Ȃ(^sȏꍇconst, Find, Atgp).
+ */
 class Json final
 {
+private:
+  friend class JsonValue;
+  friend class JsonPath;
+  friend class JsonDocument;
+
 public:
   //! JSOŇ^
   enum JSON_VALUE_TYPE
@@ -29,18 +54,66 @@ public:
     NUMBER_DOUBLE, /*!< number(double) */
     BOOL,          /*!< bool           */
     ARRAY,         /*!< array          */
-    OBJECT         /*!< object         */
+    OBJECT,        /*!< object         */
+    NUMBER_INT64   /*!< number(int64)  */
   };
 
+  //! JSONIuWFNg̃AP[^^`
+  typedef JsonAllocator<Json> Allocator;
   //! JSONIuWFNgłarray^`
-  typedef std::vector<Json> Array;
-  //! JSONIuWFNgłobject^`
-  typedef std::unordered_map<std::string, Json> Object;
+  typedef std::vector<Json, JsonAllocator<Json>> Array;
+  //! JSONIuWFNgłarray^(vfSnumber(double))̘Ä`
+  typedef std::vector<double, JsonAllocator<double>> DoubleArray;
+  //! JSONIuWFNgłarray^(vfSnumber(int, int64))̘Ä`
+  typedef std::vector<std::int64_t, JsonAllocator<std::int64_t>> Int64Array;
+  //! JSONIuWFNgłobject^`(nameƒl̑gǉɕێ. JsonObject.hQ)
+  typedef JsonObject Object;
 
 private:
-  //! PimplCfBI
-  class Impl;
-  std::unique_ptr<Impl> m_impl;
+  //! ľ^
+  JSON_VALUE_TYPE m_type;
+  //! l(null, number, bool͒ڕێ, string, array, object̓q[v̎̂QƂ)
+  union
+  {
+    bool m_bool;          //!< bool
+    int m_int;            //!< number(int)
+    std::int64_t m_int64; //!< number(int64)
+    double m_double;      //!< number(double)
+    JsonValue* m_heap;    //!< string, array, object
+  } m_value;
+
+private:
+  /**
+   * array, object̒lRs[
+   * @return Rs[(vf, o̒l͋L)
+   */
+  Json Clone() const;
+
+  /**
+   * LĂl؂藣(JsonIuWFNgƋLĂ΃Rs[)
+   * @remarks array, objectύXOɌĂ(Rs[̎QƃJEg݂̑̂ŗvf͋L)
+   */
+  void Detach();
+
+  /**
+   * ύXarrayl擾(LĂ΃Rs[)
+   * @return arrayl(arrayłȂnullptr)
+   * @remarks GetArrayƈقȂ, ȍ~̃Rs[łlL(Ԃ|C^͕ύXI܂ł̊Ԃgp邱)
+   */
+  Json::Array* EditArray();
+
+  /**
+   * ύXobjectl擾(LĂ΃Rs[)
+   * @return objectl(objectłȂnullptr)
+   * @remarks GetObjectƈقȂ, ȍ~̃Rs[łlL(Ԃ|C^͕ύXI܂ł̊Ԃgp邱)
+   */
+  Json::Object* EditObject();
+
+  /**
+   * l{IuWFNĝ݂QƂԂɂ(LĂ, ܂͕ύX\ȎQƂԂarray, object̓Rs[)
+   * @remarks vf, o̒l̓Rs[ɋL(Ăяołǂ)
+   */
+  void Isolate();
 
 public:
   /**
@@ -61,8 +134,25 @@ public:
   /**
    * RXgN^
    * @param[in] value l(string^)
+   * @param[in] alloc mۂɎgpAP[^(ȗ̓q[v)
+   */
+  explicit Json(const std::string& value, const Json::Allocator& alloc = Json::Allocator());
+
+  /**
+   * RXgN^([u)
+   * @param[in] value l(string^)
+   * @param[in] alloc mۂɎgpAP[^(ȗ̓q[v)
+   */
+  explicit Json(std::string&& value, const Json::Allocator& alloc = Json::Allocator());
+
+  /**
+   * RXgN^(Q)
+   * @param[in] value l(string^)̎Q
+   * @param[in] alloc mۂɎgpAP[^(ȗ̓q[v)
+   * @remarks ̓Rs[ɎQƂ(GetStringĂ񂾎_ŏ߂ăRs[)
+   * @attention QƐ̕, {IuWFNgƂ̃Rs[SĔj܂ŗLł邱
    */
-  explicit Json(const std::string& value);
+  explicit Json(const JsonStringView& value, const Json::Allocator& alloc = Json::Allocator());
 
   /**
    * RXgN^
@@ -70,6 +160,13 @@ public:
    */
   explicit Json(int value);
 
+  /**
+   * RXgN^
+   * @param[in] value l(number^(int64))
+   * @remarks int^͈̔͂Ɏ܂lnumber(int)ɂȂ
+   */
+  explicit Json(std::int64_t value);
+
   /**
    * RXgN^
    * @param[in] value l(number^(double))
@@ -85,18 +182,84 @@ public:
   /**
    * RXgN^
    * @param[in] value l(array^)
+   * @param[in] alloc mۂɎgpAP[^(ȗ̓q[v)
    */
-  explicit Json(const Json::Array& value);
+  explicit Json(const Json::Array& value, const Json::Allocator& alloc = Json::Allocator());
+
+  /**
+   * RXgN^([u)
+   * @param[in] value l(array^)
+   * @remarks vf̓Rs[valueڂ. ̂valueƓAP[^Ŋmۂ.
+   */
+  explicit Json(Json::Array&& value);
+
+  /**
+   * RXgN^
+   * @param[in] value l(array^, vf͑Snumber(double))
+   * @param[in] alloc mۂɎgpAP[^(ȗ̓q[v)
+   * @remarks vfdouble̘Ä̂܂ܕێ(GetDoubleSpanŎ擾ł)
+   */
+  explicit Json(const Json::DoubleArray& value, const Json::Allocator& alloc = Json::Allocator());
+
+  /**
+   * RXgN^([u)
+   * @param[in] value l(array^, vf͑Snumber(double))
+   * @remarks vf͎̘̂ÄɃRs[. ̂valueƓAP[^Ŋmۂ.
+   */
+  explicit Json(Json::DoubleArray&& value);
+
+  /**
+   * RXgN^
+   * @param[in] value l(array^̗vf. Snumber(double))
+   * @param[in] alloc mۂɎgpAP[^(ȗ̓q[v)
+   * @remarks vfdouble̘ÄɃRs[ĕێ(GetDoubleSpanŎ擾ł)
+   */
+  explicit Json(JsonSpan<double> value, const Json::Allocator& alloc = Json::Allocator());
+
+  /**
+   * RXgN^
+   * @param[in] value l(array^, vf͑Snumber(int, int64))
+   * @param[in] alloc mۂɎgpAP[^(ȗ̓q[v)
+   * @remarks vfint64̘Ä̂܂ܕێ(GetInt64SpanŎ擾ł)
+   */
+  explicit Json(const Json::Int64Array& value, const Json::Allocator& alloc = Json::Allocator());
+
+  /**
+   * RXgN^([u)
+   * @param[in] value l(array^, vf͑Snumber(int, int64))
+   * @remarks vf͎̘̂ÄɃRs[. ̂valueƓAP[^Ŋmۂ.
+   */
+  explicit Json(Json::Int64Array&& value);
+
+  /**
+   * RXgN^
+   * @param[in] value l(array^̗vf. Snumber(int, int64))
+   * @param[in] alloc mۂɎgpAP[^(ȗ̓q[v)
+   * @remarks vfint64̘ÄɃRs[ĕێ(GetInt64SpanŎ擾ł)
+   */
+  explicit Json(JsonSpan<std::int64_t> value, const Json::Allocator& alloc = Json::Allocator());
 
   /**
    * RXgN^
    * @param[in] value l(object^)
+   * @param[in] alloc mۂɎgpAP[^(ȗ̓q[v)
+   */
+  explicit Json(const Json::Object& value, const Json::Allocator& alloc = Json::Allocator());
+
+  /**
+   * RXgN^([u)
+   * @param[in] value l(object^)
+   * @remarks vf̓Rs[valueڂ. ̂valueƓAP[^Ŋmۂ.
    */
-  explicit Json(const Json::Object& value);
+  explicit Json(Json::Object&& value);
 
   /**
    * Rs[RXgN^
    * @param[in] obj Rs[
+   * @remarks l͋L(O(1)). L̒lGetArray, GetObject(const)Ă񂾎_ŃRs[邽,
+   *          Rs[ύXĂRs[͕ςȂ(ύXlɎoĤ݃Rs[). <br>
+   *          , GetArray, GetObject(const)ŕύX\ȎQƂԂarray, object,
+   *          ̎QƂʂύXRs[ɋy΂Ȃ悤, LɃRs[
    */
   Json(const Json& obj);
 
@@ -109,11 +272,19 @@ public:
   /**
    * 
    * @param[in] obj IuWFNg
+   * @remarks Rs[RXgN^Ɠ, l͕ύX鎞_܂ŃRs[Ȃ
    */
   Json& operator=(const Json& obj);
 
-  /** zfXgN^ */
-  virtual ~Json();
+  /**
+   * [u
+   * @param[in] obj [uIuWFNg
+   * @remarks [unullɂȂ
+   */
+  Json& operator=(Json&& obj);
+
+  /** fXgN^ */
+  ~Json();
 
   /**
    * ^擾
@@ -134,7 +305,7 @@ public:
   bool IsString() const;
 
   /**
-   * number(int or double)ǂ
+   * number(int, int64 or double)ǂ
    * @return numberȂtrue
    */
   bool IsNumber() const;
@@ -145,6 +316,13 @@ public:
    */
   bool IsNumberInt() const;
 
+  /**
+   * number(int64)ǂ
+   * @return number(int64)Ȃtrue
+   * @remarks int^͈̔͂Ɏ܂Ȃ̂number(int64)ɂȂ
+   */
+  bool IsNumberInt64() const;
+
   /**
    * number(double)ǂ
    * @return number(double)Ȃtrue
@@ -169,18 +347,48 @@ public:
    */
   bool IsObject() const;
 
+  /**
+   * vfdouble̘ÄɕێĂarrayǂ
+   * @return vfSnumber(double)array, ÄɕێĂtrue
+   * @remarks p[T[͗vfSnumber(double)arrayÄɕێ. <br>
+   *          GetArray(const)ĂԂƒʏarrayɕς.
+   */
+  bool IsDoubleArray() const;
+
+  /**
+   * vfint64̘ÄɕێĂarrayǂ
+   * @return vfSnumber(int, int64)array, ÄɕێĂtrue
+   * @remarks p[T[͗vfSnumber(int, int64)arrayÄɕێ. <br>
+   *          GetArray(const)ĂԂƒʏarrayɕς.
+   */
+  bool IsInt64Array() const;
+
   /**
    * stringlget
    * @return stringl
    */
   const std::string& GetString() const;
 
+  /**
+   * stringl̎QƂget
+   * @return stringl̎Q(stringȊO͋󕶎)
+   * @remarks ̓obt@QƂĂlłRs[Ɏ擾ł
+   */
+  JsonStringView GetStringView() const;
+
   /**
    * numberl(int)get
    * @return numberl(int)
    */
   int GetNumberInt() const;
 
+  /**
+   * numberl(int64)get
+   * @return numberl(int64)
+   * @remarks number(int)̂܂܎擾ł
+   */
+  std::int64_t GetNumberInt64() const;
+
   /**
    * number(double)get
    * @return numberl(double)
@@ -196,18 +404,47 @@ public:
   /**
    * arraylget
    * @return arrayl
+   * @remarks JsonIuWFNgƋLĂꍇ, arrayRs[ĂԂ(vf͋L܂).
+   *          ȍ~, {IuWFNg̃Rs[arrayLɃRs[(Rs[͕ԂQƂ̉e󂯂Ȃ). <br>
+   *          Rs[L܂ܕύXꍇ, Append, JsonPath::Setgp. <br>
+   *          ÄɕێĂarray, vfƂJsonIuWFNg쐬Ēʏarrayɕς
+   *          (ȍ~IsDoubleArray, IsInt64ArrayfalseɂȂ)
+   * @attention arrayȊȌꍇ, vOŜŋLvectorԂ(ύXĂlɂ͔fȂ).
+   *            Xbh瓯ɌĂ΂Ȃ
    */
   Json::Array& GetArray();
 
   /**
    * arraylget(const)
    * @return arrayl
+   * @remarks ÄɕێĂarray, ̌ĂяoɗvfƂJsonIuWFNgʂ̗̈(q[v)ɍ쐬
+   *          (Äێ܂. Xbh瓯ɌĂ΂Ă悢). <br>
+   *          mۂꍇGetDoubleSpan, GetInt64Spangp
    */
   const Json::Array& GetArray() const;
 
+  /**
+   * arrayl(double̘Ä)get
+   * @return vf̎Q(IsDoubleArrayłȂ΋)
+   * @remarks vfƂJsonIuWFNg쐬ɎQƂ
+   */
+  JsonSpan<double> GetDoubleSpan() const;
+
+  /**
+   * arrayl(int64̘Ä)get
+   * @return vf̎Q(IsInt64ArrayłȂ΋)
+   * @remarks vfƂJsonIuWFNg쐬ɎQƂ
+   */
+  JsonSpan<std::int64_t> GetInt64Span() const;
+
   /**
    * objectlget
    * @return objectl
+   * @remarks JsonIuWFNgƋLĂꍇ, objectRs[ĂԂ(o̒l͋L܂).
+   *          ȍ~, {IuWFNg̃Rs[objectLɃRs[(Rs[͕ԂQƂ̉e󂯂Ȃ). <br>
+   *          Rs[L܂ܕύXꍇ, Set, Erase, JsonPath::Setgp
+   * @attention objectȊȌꍇ, vOŜŋLmapԂ(ύXĂlɂ͔fȂ).
+   *            Xbh瓯ɌĂ΂Ȃ
    */
   Json::Object& GetObject();
 
@@ -217,12 +454,121 @@ public:
    */
   const Json::Object& GetObject() const;
 
+  /**
+   * objectnameɑΉl
+   * @param[in] name name
+   * @return l(objectłȂ, ܂namenullptr)
+   * @remarks GetObject()[name]ƈقȂ, nameĂnullǉȂ(mۂȂ)
+   */
+  const Json* Find(const std::string& name) const;
+
+  /**
+   * objectnameɑΉl(C)
+   * @param[in] name name
+   * @return l(objectłȂ, ܂namenullptr)
+   * @remarks GetObject()[name]ƈقȂ, nameĂnullǉȂ(mۂȂ)
+   */
+  const Json* Find(const char* name) const;
+
+  /**
+   * objectnameɑΉl(JsonKey)
+   * @param[in] name name
+   * @return l(objectłȂ, ܂namenullptr)
+   * @remarks vZς݂̃nbVlŌ
+   */
+  const Json* Find(const JsonKey& name) const;
+
+  /**
+   * objectnameɑΉl擾
+   * @param[in] name name
+   * @return l(objectłȂ, ܂name΋Lnull)
+   * @remarks FindƓ, nameĂnullǉȂ(Json::Object::atƈقȂOȂ)
+   */
+  const Json& At(const std::string& name) const;
+
+  /**
+   * objectnameɑΉl擾(C)
+   * @param[in] name name
+   * @return l(objectłȂ, ܂name΋Lnull)
+   * @remarks FindƓ, nameĂnullǉȂ(Json::Object::atƈقȂOȂ)
+   */
+  const Json& At(const char* name) const;
+
+  /**
+   * objectnameɑΉl擾(JsonKey)
+   * @param[in] name name
+   * @return l(objectłȂ, ܂name΋Lnull)
+   * @remarks FindƓ, nameĂnullǉȂ(Json::Object::atƈقȂOȂ)
+   */
+  const Json& At(const JsonKey& name) const;
+
+  /**
+   * objectnameɒlݒ肷
+   * @param[in] name  name
+   * @param[in] value l(nameΒǉ)
+   * @return objectłtrue(objectȊO͕ύXȂ)
+   * @remarks JsonIuWFNgƋLĂꍇ, objectRs[Ăݒ肷(o̒l͋L܂). <br>
+   *          GetObjectƈقȂύX\ȎQƂԂȂ, ȍ~̃Rs[lL(Rs[͎QƃJEg̑̂)
+   */
+  bool Set(const std::string& name, Json value);
+
+  /**
+   * objectnameɒlݒ肷(C)
+   * @param[in] name  name
+   * @param[in] value l(nameΒǉ)
+   * @return objectłtrue(objectȊO͕ύXȂ)
+   * @remarks JsonIuWFNgƋLĂꍇ, objectRs[Ăݒ肷(ȍ~̃Rs[lL)
+   */
+  bool Set(const char* name, Json value);
+
+  /**
+   * objectname폜
+   * @param[in] name name
+   * @return 폜true(objectłȂ, ܂nameΕύXȂ)
+   * @remarks JsonIuWFNgƋLĂꍇ, objectRs[Ă폜(ȍ~̃Rs[lL)
+   */
+  bool Erase(const std::string& name);
+
+  /**
+   * objectname폜(C)
+   * @param[in] name name
+   * @return 폜true(objectłȂ, ܂nameΕύXȂ)
+   * @remarks JsonIuWFNgƋLĂꍇ, objectRs[Ă폜(ȍ~̃Rs[lL)
+   */
+  bool Erase(const char* name);
+
+  /**
+   * array̖ɗvfǉ
+   * @param[in] value vf
+   * @return arrayłtrue(arrayȊO͕ύXȂ)
+   * @remarks JsonIuWFNgƋLĂꍇ, arrayRs[Ăǉ(ȍ~̃Rs[lL). <br>
+   *          ÄɕێĂarray, vfƂJsonIuWFNg쐬Ēʏarrayɕς
+   */
+  bool Append(Json value);
+
+  /**
+   * (ύXłȂJsonhLgɂ)
+   * @return JsonhLg({IuWFNg̒lڂ)
+   * @remarks {IuWFNgnullɂȂ. ڍׂJsonDocumentQ.
+   * @attention OGetArray, GetObjectŎ擾QƂ͖ɂȂ(hLg͕ʂ̒lێ)
+   */
+  JsonDocument Freeze();
+
   /**
    * JSON`̕o
    * @param[in,out] outStream o͐̃Xg[
+   * @remarks doublel͌̒lɖ߂ŒZ10iŏo͂(FormatDouble).
+   *          Xg[̐x, P[̐ݒɂ͈ˑȂ
    */
   void Dump(std::ostream* outStream) const;
 
+  /**
+   * JSON`̕o
+   * @param[in,out] sink o͐
+   * @remarks o͂JsonWriter̃obt@ɂ܂Ƃ, Ō1xo͐ɔf
+   */
+  void Dump(JsonSink* sink) const;
+
   /**
    * MessagePack`̃oCio
    * @param[in,out] outStream o͐̃Xg[
@@ -230,4 +576,8 @@ public:
   void DumpMsgpack(std::ostream* outStream) const;
 };
 }
+
+// object^Json̒`ɒ`(vfJson)
+#include "JsonObject.h"
+
 #endif // ANALYSISDRIVE_JSON_H_
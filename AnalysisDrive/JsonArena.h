@@ -0,0 +1,234 @@
+/**
+ * @file   JsonArena.h
+ * @brief  JSONIuWFNgpA[i
+ * @author kyo
+ * @date   2026/10/17
+ */
+#ifndef ANALYSISDRIVE_JSONARENA_H_
+#define ANALYSISDRIVE_JSONARENA_H_
+
+#include <memory>
+#include <new>
+#include <cstddef>
+#include <type_traits>
+
+/** Analysis Drive */
+namespace adlib
+{
+/**
+ * JSONIuWFNgpA[i
+ * @remarks 傫ȃubN珇ɐ؂õmgjbNȃAP[^. <br>
+ *          ݂̃ubNɎ܂Ȃ傫ȗ̈͐p̃ubNɊmۂ(݂̃ubN̎ĉĂȂ). <br>
+ *          ʂ͍̉s킸, A[i̔jɂ܂Ƃ߂ĉ. <br>
+ *          CreateSharedō쐬A[i͏L҂̐𐔂, Ō̏L҂Oꂽ_Ŕj
+ *          (A[i[h̃p[T[, p[Xʂ̍ŏʂ̒lL҂ɂȂ).
+ * @attention XbhZ[tł͂Ȃ(L҂̒ǉ, 폜̂ݕXbhsĂ悢)
+ */
+class JsonArena final
+{
+private:
+  //! PimplCfBI
+  class Impl;
+  std::unique_ptr<Impl> m_impl;
+
+private:
+  /** Rs[֎~ */
+  JsonArena(const JsonArena&);
+  /** ֎~ */
+  void operator=(const JsonArena&);
+
+public:
+  /** RXgN^ */
+  JsonArena();
+
+  /**
+   * RXgN^
+   * @param[in] blockSize ŏɊmۂubÑTCY(byte)
+   */
+  explicit JsonArena(size_t blockSize);
+
+  /** zfXgN^ */
+  virtual ~JsonArena();
+
+  /**
+   * L҂𐔂A[i쐬
+   * @return A[i(L҂1lƂĎQƂ. QƂSĊOꂽ, ̏L҂ȂȂ_Ŕj)
+   */
+  static std::shared_ptr<JsonArena> CreateShared();
+
+  /**
+   * L҂ǉ
+   * @attention CreateSharedō쐬A[î. ǉL҂ReleaseOwnerŊO
+   */
+  void AddOwner();
+
+  /**
+   * L҂O(Ō̏L҂ł΃A[ij)
+   * @param[in] arena A[i(CreateSharedō쐬)
+   */
+  static void ReleaseOwner(JsonArena* arena);
+
+  /**
+   * L҂̐擾
+   * @return L҂̐
+   */
+  long OwnerCount() const;
+
+  /**
+   * mۂ
+   * @param[in] size      mۂTCY(byte)
+   * @param[in] alignment ACg(2ׂ̂)
+   * @return mۂ̈̐擪
+   */
+  void* Allocate(size_t size, size_t alignment);
+
+  /**
+   * \[XA[iƈꏏɕێ
+   * @param[in] resource ێ郊\[X
+   * @remarks A[imۂlQƂ郊\[X(̓obt@Ȃ), A[i̔j܂ŉȂ
+   */
+  void Retain(const std::shared_ptr<void>& resource);
+
+  /**
+   * mۂ̈SĖgpɖ߂
+   * @remarks ŌɊmۂubN(ő̃ubN)݂̂cčėp, ێĂ\[X. <br>
+   *          x̃TCỸf[^JԂꍇ, 2ڈȍ~̓ubNmۂȂȂ.
+   * @attention A[imۂlSĔjĂ邱
+   */
+  void Reset();
+
+  /**
+   * mۍς݂̃TCY擾
+   * @return AllocateŐ؂oTCY̍v(byte)
+   */
+  size_t UsedSize() const;
+
+  /**
+   * \ς݂̃TCY擾
+   * @return mۂubÑTCY̍v(byte)
+   */
+  size_t ReservedSize() const;
+};
+
+/**
+ * JSONIuWFNgpAP[^
+ * @tparam T mۂ^
+ * @remarks A[iȂ(ftHgRXgN^ō쐬)ꍇ͒ʏ̃q[vmۂ. <br>
+ *          A[iꍇ̓A[imۂ, deallocateł͉Ȃ. <br>
+ *          AP[^̓A[ĩ|C^݂̂ێ, LȂ(lƂɎQƃJEgȂ).
+ * @attention A[i, ̃A[imۂlSĔj܂ŗLł邱
+ */
+template <class T>
+class JsonAllocator
+{
+public:
+  //! mۂ^
+  typedef T value_type;
+  //! |C^^
+  typedef T* pointer;
+  //! |C^^(const)
+  typedef const T* const_pointer;
+  //! TCY^
+  typedef size_t size_type;
+  //! ^
+  typedef ptrdiff_t difference_type;
+  //! Reĩ[u̓AP[^ڂ
+  typedef std::true_type propagate_on_container_move_assignment;
+  //! ReĩXbv̓AP[^
+  typedef std::true_type propagate_on_container_swap;
+
+  //! ʂ̌^̃AP[^
+  template <class U>
+  struct rebind
+  {
+    typedef JsonAllocator<U> other;
+  };
+
+private:
+  template <class U> friend class JsonAllocator;
+  //! mې̃A[i(nullptrł΃q[v. LȂ)
+  JsonArena* m_arena;
+
+public:
+  /** RXgN^(q[vmۂ) */
+  JsonAllocator() : m_arena(nullptr) {}
+
+  /**
+   * RXgN^
+   * @param[in] arena mې̃A[i(nullptrł΃q[v)
+   */
+  explicit JsonAllocator(JsonArena* arena) : m_arena(arena) {}
+
+  /**
+   * RXgN^(ʂ̌^̃AP[^쐬)
+   * @param[in] obj ʂ̌^̃AP[^
+   */
+  template <class U>
+  JsonAllocator(const JsonAllocator<U>& obj) : m_arena(obj.m_arena) {}
+
+  /**
+   * mې̃A[i擾
+   * @return A[i(q[vmۂꍇnullptr)
+   */
+  JsonArena* Arena() const
+  {
+    return m_arena;
+  }
+
+  /**
+   * mۂ
+   * @param[in] n vf
+   * @return mۂ̈̐擪
+   */
+  T* allocate(size_t n)
+  {
+    if (m_arena != nullptr) return static_cast<T*>(m_arena->Allocate(n * sizeof(T), std::alignment_of<T>::value));
+    return static_cast<T*>(::operator new(n * sizeof(T)));
+  }
+
+  /**
+   * 
+   * @param[in] p ̈̐擪
+   * @param[in] n vf
+   * @remarks A[imۂ̈͌ʂɉȂ
+   */
+  void deallocate(T* p, size_t n)
+  {
+    (void)n;
+    if (m_arena == nullptr) ::operator delete(p);
+  }
+
+  /**
+   * ReĩRs[ɎgpAP[^擾
+   * @return q[vmۂAP[^
+   * @remarks Rs[ReĩA[i̎ɔȂ悤, Rs[̓q[vɍ쐬
+   */
+  JsonAllocator select_on_container_copy_construction() const
+  {
+    return JsonAllocator();
+  }
+
+  /**
+   * vr
+   * @param[in] obj rΏ
+   * @return mېłtrue
+   */
+  template <class U>
+  bool operator==(const JsonAllocator<U>& obj) const
+  {
+    return m_arena == obj.m_arena;
+  }
+
+  /**
+   * svr
+   * @param[in] obj rΏ
+   * @return قȂmېłtrue
+   */
+  template <class U>
+  bool operator!=(const JsonAllocator<U>& obj) const
+  {
+    return m_arena != obj.m_arena;
+  }
+};
+}
+#endif // ANALYSISDRIVE_JSONARENA_H_
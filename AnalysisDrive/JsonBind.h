@@ -0,0 +1,421 @@
+/**
+ * @file   JsonBind.h
+ * @brief  JSONC++̌^̑Ήt
+ * @author kyo
+ * @date   2026/10/17
+ */
+#ifndef ANALYSISDRIVE_JSONBIND_H_
+#define ANALYSISDRIVE_JSONBIND_H_
+
+#include <cfloat>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+/** Analysis Drive */
+namespace adlib
+{
+/**
+ * \̂JSONobject̃ȏΉt
+ * @tparam T \
+ * @remarks \̂Ƃɓꉻ, ÓI֐Fieldsnameƃo񋓂. <br>
+ *          Fieldsɂ͊֐IuWFNgn邽, ufields("name", &T::member);v̌`ŗ񋓂. <br>
+ *          ǒ^bool, int, std::int64_t, double, float, std::string, std::vector, Bindꉻ\.
+ */
+template <class T>
+struct Bind;
+
+/**
+ * l̊i[(^Ƃ̊֐e[u)
+ * @remarks 󂯕tȂl̊֐nullptrɂ(^̕svƂăG[ɂȂ)
+ */
+struct JsonBindOps
+{
+  //! ^̖O(G[bZ[Wp)
+  const char* typeName;
+  //! boolli[
+  void (*setBool)(void* target, bool value);
+  //! i[(͈͊OłfalseԂ)
+  bool (*setInt)(void* target, std::int64_t value);
+  //! _i[(͈͊OłfalseԂ)
+  bool (*setDouble)(void* target, double value);
+  //! stringli[
+  void (*setString)(void* target, const std::string& value);
+  //! arraẙi[Jn(̗vf͍폜)
+  void (*startArray)(void* target);
+  //! array̖ɗvfǉ, ̊i[ƏԂ
+  void* (*appendElement)(void* target, const JsonBindOps** elementOps);
+  //! objectnameɑΉ郁o̊i[ƏԂ(nullptr. name͕񃊃eԂ)
+  void* (*findField)(void* target, const std::string& name, const JsonBindOps** fieldOps, const char** fieldName);
+};
+
+/**
+ * l̊i[(\)
+ * @tparam T \(BindꉻĂ邱)
+ */
+template <class T>
+struct JsonBindTraits
+{
+  //! ֐e[u
+  static const JsonBindOps OPS;
+
+  /** nameɑΉ郁oT֐IuWFNg */
+  class FieldFinder
+  {
+  private:
+    T* m_target;                //!< \
+    const std::string& m_name;  //!< Tname
+    void* m_field;              //!< o
+    const JsonBindOps* m_ops;   //!< ȍ
+    const char* m_fieldName;    //!< oname
+
+    /** ֎~ */
+    void operator=(const FieldFinder&);
+
+  public:
+    /**
+     * RXgN^
+     * @param[in] target \
+     * @param[in] name   Tname
+     */
+    FieldFinder(T* target, const std::string& name)
+      :m_target(target), m_name(name), m_field(nullptr), m_ops(nullptr), m_fieldName(nullptr)
+    {
+    }
+
+    /**
+     * o1ƍ
+     * @tparam N name̕(I[܂)
+     * @tparam M ǒ^
+     * @param[in] name   name(񃊃e)
+     * @param[in] member o
+     */
+    template <size_t N, class M>
+    void operator()(const char (&name)[N], M T::*member)
+    {
+      if (m_field != nullptr || m_name.size() != N - 1 || std::memcmp(m_name.data(), name, N - 1) != 0) return;
+      m_field = &(m_target->*member);
+      m_ops = &JsonBindTraits<M>::OPS;
+      m_fieldName = name;
+    }
+
+    /**
+     * ʂ擾
+     * @param[out] fieldOps  ȍ
+     * @param[out] fieldName oname
+     * @return o(nullptr)
+     */
+    void* Result(const JsonBindOps** fieldOps, const char** fieldName) const
+    {
+      *fieldOps = m_ops;
+      *fieldName = m_fieldName;
+      return m_field;
+    }
+  };
+
+  /**
+   * nameɑΉ郁oT
+   * @param[in]  target    \
+   * @param[in]  name      name
+   * @param[out] fieldOps  ȍ
+   * @param[out] fieldName oname
+   * @return o(nullptr)
+   */
+  static void* FindField(void* target, const std::string& name, const JsonBindOps** fieldOps, const char** fieldName)
+  {
+    FieldFinder finder(static_cast<T*>(target), name);
+    Bind<T>::Fields(finder);
+    return finder.Result(fieldOps, fieldName);
+  }
+};
+template <class T>
+const JsonBindOps JsonBindTraits<T>::OPS =
+  { "object", nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, &JsonBindTraits<T>::FindField };
+
+/** l̊i[(bool) */
+template <>
+struct JsonBindTraits<bool>
+{
+  //! ֐e[u
+  static const JsonBindOps OPS;
+
+  /**
+   * boolli[
+   * @param[in] target i[
+   * @param[in] value  l
+   */
+  static void SetBool(void* target, bool value)
+  {
+    *static_cast<bool*>(target) = value;
+  }
+};
+
+/** l̊i[(int) */
+template <>
+struct JsonBindTraits<int>
+{
+  //! ֐e[u
+  static const JsonBindOps OPS;
+
+  /**
+   * i[
+   * @param[in] target i[
+   * @param[in] value  l
+   * @return int^͈̔͊Ołfalse
+   */
+  static bool SetInt(void* target, std::int64_t value)
+  {
+    if (value < INT_MIN || value > INT_MAX) return false;
+    *static_cast<int*>(target) = static_cast<int>(value);
+    return true;
+  }
+};
+
+/** l̊i[(int64) */
+template <>
+struct JsonBindTraits<std::int64_t>
+{
+  //! ֐e[u
+  static const JsonBindOps OPS;
+
+  /**
+   * i[
+   * @param[in] target i[
+   * @param[in] value  l
+   * @return true
+   */
+  static bool SetInt(void* target, std::int64_t value)
+  {
+    *static_cast<std::int64_t*>(target) = value;
+    return true;
+  }
+};
+
+/** l̊i[(double) */
+template <>
+struct JsonBindTraits<double>
+{
+  //! ֐e[u
+  static const JsonBindOps OPS;
+
+  /**
+   * i[
+   * @param[in] target i[
+   * @param[in] value  l
+   * @return true
+   */
+  static bool SetInt(void* target, std::int64_t value)
+  {
+    *static_cast<double*>(target) = static_cast<double>(value);
+    return true;
+  }
+
+  /**
+   * _i[
+   * @param[in] target i[
+   * @param[in] value  l
+   * @return true
+   */
+  static bool SetDouble(void* target, double value)
+  {
+    *static_cast<double*>(target) = value;
+    return true;
+  }
+};
+
+/** l̊i[(float) */
+template <>
+struct JsonBindTraits<float>
+{
+  //! ֐e[u
+  static const JsonBindOps OPS;
+
+  /**
+   * i[
+   * @param[in] target i[
+   * @param[in] value  l
+   * @return true
+   */
+  static bool SetInt(void* target, std::int64_t value)
+  {
+    *static_cast<float*>(target) = static_cast<float>(value);
+    return true;
+  }
+
+  /**
+   * _i[
+   * @param[in] target i[
+   * @param[in] value  l
+   * @return float^͈̔͊O()łfalse
+   */
+  static bool SetDouble(void* target, double value)
+  {
+    if ((value > FLT_MAX || value < -FLT_MAX) && value - value == 0) return false;
+    *static_cast<float*>(target) = static_cast<float>(value);
+    return true;
+  }
+};
+
+/** l̊i[(std::string) */
+template <>
+struct JsonBindTraits<std::string>
+{
+  //! ֐e[u
+  static const JsonBindOps OPS;
+
+  /**
+   * stringli[
+   * @param[in] target i[
+   * @param[in] value  l
+   */
+  static void SetString(void* target, const std::string& value)
+  {
+    static_cast<std::string*>(target)->assign(value);
+  }
+};
+
+/**
+ * l̊i[(std::vector)
+ * @tparam E vf̌^
+ * @tparam A AP[^
+ */
+template <class E, class A>
+struct JsonBindTraits<std::vector<E, A>>
+{
+  //! ֐e[u
+  static const JsonBindOps OPS;
+
+  /**
+   * arraẙi[Jn
+   * @param[in] target i[
+   * @remarks ̗vf͍폜(eʂ͍ėp)
+   */
+  static void StartArray(void* target)
+  {
+    static_cast<std::vector<E, A>*>(target)->clear();
+  }
+
+  /**
+   * array̖ɗvfǉ
+   * @param[in]  target     i[
+   * @param[out] elementOps vf̏
+   * @return ǉvf
+   */
+  static void* AppendElement(void* target, const JsonBindOps** elementOps)
+  {
+    std::vector<E, A>* vec = static_cast<std::vector<E, A>*>(target);
+    vec->emplace_back();
+    *elementOps = &JsonBindTraits<E>::OPS;
+    return &vec->back();
+  }
+};
+template <class E, class A>
+const JsonBindOps JsonBindTraits<std::vector<E, A>>::OPS =
+  { "array", nullptr, nullptr, nullptr, nullptr,
+    &JsonBindTraits<std::vector<E, A>>::StartArray, &JsonBindTraits<std::vector<E, A>>::AppendElement, nullptr };
+
+/**
+ * l̊i[
+ * @remarks i[̃|C^, ̌^̊i[̑g
+ */
+class JsonBindTarget final
+{
+private:
+  //! i[
+  void* m_target;
+  //! i[
+  const JsonBindOps* m_ops;
+
+public:
+  /**
+   * RXgN^
+   * @tparam T i[̌^
+   * @param[in] target i[
+   */
+  template <class T>
+  explicit JsonBindTarget(T* target) : m_target(target), m_ops(&JsonBindTraits<T>::OPS) {}
+
+  /**
+   * i[擾
+   * @return i[
+   */
+  void* Target() const
+  {
+    return m_target;
+  }
+
+  /**
+   * i[擾
+   * @return i[
+   */
+  const JsonBindOps& Ops() const
+  {
+    return *m_ops;
+  }
+};
+
+/**
+ * @struct  Bind
+ * @section Bind_exsample exsample
+ * @code
+ * #include "AnalysisDrive.h"
+ * #include <iostream>
+ *
+ * struct NodeRecord
+ * {
+ *   int id;
+ *   std::vector<double> coord;
+ *   std::string comment;
+ * };
+ *
+ * struct MeshRecord
+ * {
+ *   std::vector<NodeRecord> node;
+ * };
+ *
+ * // nameƃȏΉt
+ * namespace adlib
+ * {
+ * template <>
+ * struct Bind<NodeRecord>
+ * {
+ *   template <class F>
+ *   static void Fields(F& fields)
+ *   {
+ *     fields("id", &NodeRecord::id);
+ *     fields("coord", &NodeRecord::coord);
+ *     fields("comment", &NodeRecord::comment);
+ *   }
+ * };
+ *
+ * template <>
+ * struct Bind<MeshRecord>
+ * {
+ *   template <class F>
+ *   static void Fields(F& fields)
+ *   {
+ *     fields("node", &MeshRecord::node);
+ *   }
+ * };
+ * }
+ *
+ * int main()
+ * {
+ *   adlib::JsonParser parser;
+ *   MeshRecord mesh;
+ *   // JsonIuWFNg쐬, \̂ɒڊi[
+ *   if (!parser.ParseFileInto("mesh.json", &mesh))
+ *   {
+ *     for (const auto& msg : parser.ErrorMessage()) std::cout << msg << std::endl;
+ *     return 1;
+ *   }
+ *   std::cout << mesh.node.size() << " nodes" << std::endl;
+ *   return 0;
+ * }
+ * @endcode
+ */
+}
+#endif // ANALYSISDRIVE_JSONBIND_H_
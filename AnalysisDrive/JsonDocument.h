@@ -0,0 +1,88 @@
+/**
+ * @file   JsonDocument.h
+ * @brief  JSONhLg
+ * @author kyo
+ * @date   2026/10/17
+ */
+#ifndef ANALYSISDRIVE_JSONDOCUMENT_H_
+#define ANALYSISDRIVE_JSONDOCUMENT_H_
+
+#include "Json.h"
+#include "JsonView.h"
+
+/** Analysis Drive */
+namespace adlib
+{
+/**
+ * JSONhLg
+ * @remarks ύXłȂJSONhLg. Json::Freezeō쐬. <br>
+ *          , ̓obt@QƂĂstringlRs[. <br>
+ *          JsonIuWFNgƋLĂarray, object, ύX\ȎQ(Json::GetArray, Json::GetObject)Ԃarray, object̓Rs[
+ *          ({hLg̒l͖{hLĝ݂QƂ邽, O̎Q, Rs[ʂĕύXȂ). <br>
+ *          lRootŎ擾JsonViewŎQƂ. JsonView͎QƃJEg,
+ *          ÄɕێĂarrayWJȂ, ̃Xbh瓯ɎQƂĂLf[^ւ݂̏Ȃ.
+ * @note {IuWFNg̃Rs[͒lL(ύXłȂ߈S)
+ */
+class JsonDocument final
+{
+private:
+  //! ŏʂ̒l
+  Json m_root;
+
+private:
+  /**
+   * l𓀌(vf, oǂ)
+   * @param[in,out] value l(LĂ, ܂͕ύX\ȎQƂԂarray, object̓Rs[ɒu)
+   */
+  static void FreezeValue(Json& value);
+
+public:
+  /** RXgN^(null) */
+  JsonDocument() {}
+
+  /**
+   * RXgN^
+   * @param[in] root ŏʂ̒l([uē)
+   */
+  explicit JsonDocument(Json&& root);
+
+  /**
+   * ŏʂ̒l擾
+   * @return ŏʂ̒l̎Q
+   */
+  JsonView Root() const;
+
+  /**
+   * ŏʂ̒l擾(JsonIuWFNg)
+   * @return ŏʂ̒l(DumpȂǂɎgp)
+   * @attention 擾JsonIuWFNgRs[ƎQƃJEgς(XbhłRootgp邱)
+   */
+  const Json& GetJson() const;
+};
+
+/**
+ * @class   JsonDocument
+ * @section JsonDocument_exsample exsample
+ * @code
+ * #include "AnalysisDrive.h"
+ * #include <iostream>
+ *
+ * int main()
+ * {
+ *   adlib::JsonParser parser;
+ *   const adlib::JsonDocument doc = parser.ParseFile("input.json").Freeze();
+ *   const adlib::JsonView nodes = doc.Root().At("node");
+ *
+ *   double sum = 0.0;
+ * #pragma omp parallel for reduction(+:sum)
+ *   for (int i = 0; i < static_cast<int>(nodes.Size()); ++i)
+ *   {
+ *     sum += nodes[i].At("coord")[0].GetNumberDouble();
+ *   }
+ *   std::cout << sum << std::endl;
+ *   return 0;
+ * }
+ * @endcode
+ */
+}
+#endif // ANALYSISDRIVE_JSONDOCUMENT_H_
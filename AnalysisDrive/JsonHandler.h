@@ -0,0 +1,149 @@
+/**
+ * @file   JsonHandler.h
+ * @brief  JSONp[XCxg̃nh
+ * @author kyo
+ * @date   2026/10/17
+ */
+#ifndef ANALYSISDRIVE_JSONHANDLER_H_
+#define ANALYSISDRIVE_JSONHANDLER_H_
+
+#include <cstdint>
+#include <string>
+
+/** Analysis Drive */
+namespace adlib
+{
+/**
+ * JSONp[XCxg̃nh
+ * @remarks JsonParser::ParseEvents, lǂݍނтɑΉ֐Ă΂. <br>
+ *          KvȃCxgI[o[Ch΂悢(ftHg͉trueԂ). <br>
+ *          falseԂƃp[X𒆒f.
+ */
+class JsonHandler
+{
+public:
+  /** RXgN^ */
+  JsonHandler();
+
+  /** zfXgN^ */
+  virtual ~JsonHandler();
+
+  /**
+   * nullǂݍ
+   * @return p[X𑱂ꍇtrue
+   */
+  virtual bool Null();
+
+  /**
+   * boollǂݍ
+   * @param[in] value l
+   * @return p[X𑱂ꍇtrue
+   */
+  virtual bool Bool(bool value);
+
+  /**
+   * numberl(int)ǂݍ
+   * @param[in] value l
+   * @return p[X𑱂ꍇtrue
+   */
+  virtual bool Int(int value);
+
+  /**
+   * numberl(int64)ǂݍ
+   * @param[in] value l
+   * @return p[X𑱂ꍇtrue
+   * @remarks int^͈̔͊O̐̂ݖ{֐Ă΂
+   */
+  virtual bool Int64(std::int64_t value);
+
+  /**
+   * numberl(double)ǂݍ
+   * @param[in] value l
+   * @return p[X𑱂ꍇtrue
+   */
+  virtual bool Double(double value);
+
+  /**
+   * stringlǂݍ
+   * @param[in] value l
+   * @return p[X𑱂ꍇtrue
+   * @attention value͌ĂяôݗL(p[T[̃obt@ėp)
+   */
+  virtual bool String(const std::string& value);
+
+  /**
+   * object̊Jn('{')ǂݍ
+   * @return p[X𑱂ꍇtrue
+   */
+  virtual bool StartObject();
+
+  /**
+   * objectnameǂݍ
+   * @param[in] name name
+   * @return p[X𑱂ꍇtrue
+   * @attention name͌ĂяôݗL(p[T[̃obt@ėp)
+   */
+  virtual bool Key(const std::string& name);
+
+  /**
+   * object̏I('}')ǂݍ
+   * @param[in] memberCount object̃o
+   * @return p[X𑱂ꍇtrue
+   */
+  virtual bool EndObject(size_t memberCount);
+
+  /**
+   * arraẙJn('[')ǂݍ
+   * @return p[X𑱂ꍇtrue
+   */
+  virtual bool StartArray();
+
+  /**
+   * array̏I(']')ǂݍ
+   * @param[in] elementCount array̗vf
+   * @return p[X𑱂ꍇtrue
+   */
+  virtual bool EndArray(size_t elementCount);
+};
+
+/**
+ * @class   JsonHandler
+ * @section JsonHandler_exsample exsample
+ * @code
+ * #include "AnalysisDrive.h"
+ * #include <iostream>
+ *
+ * // "timestep"̒lonh
+ * class TimestepHandler : public adlib::JsonHandler
+ * {
+ * public:
+ *   bool m_next = false;
+ *   int m_timestep = 0;
+ *
+ *   bool Key(const std::string& name) override
+ *   {
+ *     m_next = (name == "timestep");
+ *     return true;
+ *   }
+ *   bool Int(int value) override
+ *   {
+ *     if (!m_next) return true;
+ *     m_timestep = value;
+ *     // , ȍ~͓ǂ܂ɒf
+ *     return false;
+ *   }
+ * };
+ *
+ * int main()
+ * {
+ *   adlib::JsonParser parser;
+ *   TimestepHandler handler;
+ *   // JsonIuWFNg쐬Ƀp[X
+ *   parser.ParseFileEvents("result.json", &handler);
+ *   std::cout << "timestep " << handler.m_timestep << std::endl;
+ *   return 0;
+ * }
+ * @endcode
+ */
+}
+#endif // ANALYSISDRIVE_JSONHANDLER_H_
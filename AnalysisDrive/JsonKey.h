@@ -0,0 +1,261 @@
+/**
+ * @file   JsonKey.h
+ * @brief  JSONobjectname
+ * @author kyo
+ * @date   2026/10/17
+ */
+#ifndef ANALYSISDRIVE_JSONKEY_H_
+#define ANALYSISDRIVE_JSONKEY_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <ostream>
+#include <string>
+
+/** Analysis Drive */
+namespace adlib
+{
+// O錾
+class JsonKeyTable;
+class JsonObject;
+
+/**
+ * JSONobjectname
+ * @remarks ƃnbVl1̎̂ɂ܂Ƃ, QƃJEgŋL. <br>
+ *          p[T[͓̓name1̎̂ɂ܂Ƃ߂(C^[),
+ *          objectnameĂĂ1ێ. <br>
+ *          nbVl͍쐬1xvZ, Json::Objecťł͂g. <br>
+ *          std::string, C񂩂Öقɕϊł, const std::string&ƂĎQƂł.
+ * @note nameŌJԂꍇ, JsonKey쐬ĂĎg
+ *       ̂тɕ̃Rs[ƃnbVľvZȂčς.
+ */
+class JsonKey final
+{
+private:
+  friend class JsonKeyTable;
+  friend class JsonObject;
+
+  //! 󕶎(̂ꍇɎQƂ)
+  static const std::string EMPTY_STRING;
+
+  //! name̎
+  struct Entry
+  {
+    std::atomic<long> refCount; //!< QƃJEg
+    size_t hash;                //!< nbVl
+    std::string str;            //!< 
+  };
+
+  //! (nullptrł΋󕶎)
+  Entry* m_entry;
+
+private:
+  /**
+   * RXgN^(nbVlvZς)
+   * @param[in] data ̐擪
+   * @param[in] size ̃TCY(byte)
+   * @param[in] hash nbVl(HashŌvZ)
+   */
+  JsonKey(const char* data, size_t size, size_t hash);
+
+  /** ̂̎QƂO(Ō̎QƂłΔj) */
+  void Release();
+
+public:
+  /** RXgN^(󕶎) */
+  JsonKey() : m_entry(nullptr) {}
+
+  /**
+   * RXgN^
+   * @param[in] str 
+   */
+  JsonKey(const std::string& str);
+
+  /**
+   * RXgN^([u)
+   * @param[in] str 
+   */
+  JsonKey(std::string&& str);
+
+  /**
+   * RXgN^
+   * @param[in] str C
+   */
+  JsonKey(const char* str);
+
+  /**
+   * Rs[RXgN^
+   * @param[in] obj Rs[
+   * @remarks ̂L(̓Rs[Ȃ)
+   */
+  JsonKey(const JsonKey& obj) : m_entry(obj.m_entry)
+  {
+    if (m_entry != nullptr) m_entry->refCount.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  /**
+   * [uRXgN^
+   * @param[in] obj [uIuWFNg
+   * @remarks [u͋󕶎ɂȂ
+   */
+  JsonKey(JsonKey&& obj) : m_entry(obj.m_entry)
+  {
+    obj.m_entry = nullptr;
+  }
+
+  /**
+   * 
+   * @param[in] obj IuWFNg
+   */
+  JsonKey& operator=(const JsonKey& obj);
+
+  /**
+   * [u
+   * @param[in] obj [uIuWFNg
+   * @remarks [u͋󕶎ɂȂ
+   */
+  JsonKey& operator=(JsonKey&& obj);
+
+  /** fXgN^ */
+  ~JsonKey()
+  {
+    if (m_entry != nullptr) this->Release();
+  }
+
+  /**
+   * get
+   * @return 
+   */
+  const std::string& GetString() const;
+
+  /**
+   * nbVlget
+   * @return nbVl(쐬ɌvZ)
+   */
+  size_t GetHash() const
+  {
+    return (m_entry != nullptr) ? m_entry->hash : JsonKey::Hash("", 0);
+  }
+
+  /**
+   * ւ̕ϊ
+   * @return 
+   */
+  operator const std::string&() const
+  {
+    return this->GetString();
+  }
+
+  /**
+   * vr
+   * @param[in] obj rΏ
+   * @return łtrue
+   * @remarks ̂łΕrȂ. nbVlقȂΕrȂ.
+   */
+  bool operator==(const JsonKey& obj) const
+  {
+    if (m_entry == obj.m_entry) return true;
+    return this->GetHash() == obj.GetHash() && this->GetString() == obj.GetString();
+  }
+
+  /**
+   * svr
+   * @param[in] obj rΏ
+   * @return قȂ镶łtrue
+   */
+  bool operator!=(const JsonKey& obj) const
+  {
+    return !(*this == obj);
+  }
+
+  /**
+   * vr(std::string)
+   * @param[in] str rΏ
+   * @return łtrue
+   */
+  bool operator==(const std::string& str) const
+  {
+    return this->GetString() == str;
+  }
+
+  /**
+   * svr(std::string)
+   * @param[in] str rΏ
+   * @return قȂ镶łtrue
+   */
+  bool operator!=(const std::string& str) const
+  {
+    return !(*this == str);
+  }
+
+  /**
+   * vr(C)
+   * @param[in] str rΏ
+   * @return łtrue
+   */
+  bool operator==(const char* str) const
+  {
+    return this->GetString() == str;
+  }
+
+  /**
+   * svr(C)
+   * @param[in] str rΏ
+   * @return قȂ镶łtrue
+   */
+  bool operator!=(const char* str) const
+  {
+    return !(*this == str);
+  }
+
+  /**
+   * 召r
+   * @param[in] obj rΏ
+   * @return 񂪎őOłtrue
+   */
+  bool operator<(const JsonKey& obj) const
+  {
+    return this->GetString() < obj.GetString();
+  }
+
+  /**
+   * ̃nbVlvZ
+   * @param[in] data ̐擪
+   * @param[in] size ̃TCY(byte)
+   * @return nbVl
+   */
+  static size_t Hash(const char* data, size_t size);
+};
+
+/**
+ * Xg[ւ̏o
+ * @param[in,out] outStream o͐̃Xg[
+ * @param[in]     key       o͂name
+ * @return o͐̃Xg[
+ */
+inline std::ostream& operator<<(std::ostream& outStream, const JsonKey& key)
+{
+  return outStream << key.GetString();
+}
+}
+
+namespace std
+{
+/** JsonKeỹnbV(쐬ɌvZnbVlԂ) */
+template <>
+struct hash<adlib::JsonKey>
+{
+  /**
+   * nbVl擾
+   * @param[in] key name
+   * @return nbVl
+   */
+  size_t operator()(const adlib::JsonKey& key) const
+  {
+    return key.GetHash();
+  }
+};
+}
+#endif // ANALYSISDRIVE_JSONKEY_H_
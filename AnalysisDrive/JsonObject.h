@@ -0,0 +1,726 @@
+/**
+ * @file   JsonObject.h
+ * @brief  JSONIuWFNgobject^
+ * @author kyo
+ * @date   2026/10/17
+ */
+#ifndef ANALYSISDRIVE_JSONOBJECT_H_
+#define ANALYSISDRIVE_JSONOBJECT_H_
+
+#include "Json.h"
+#include "JsonArena.h"
+#include "JsonKey.h"
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/** Analysis Drive */
+namespace adlib
+{
+/**
+ * JSONIuWFNgobject^
+ * @remarks nameƒl̑g̓ubNPʂŊmۂ̈ɒu, ړȂ(Dump, DumpMsgpack͒ǉɏo͂). <br>
+ *          vfȂԂ1̃ubNɒǉɕ, 擪珇namerČ
+ *          (C^[ς݂namê͎̔r̂). <br>
+ *          ubNȂȂ邩, 萔𒴂邩, 폜, ǉvfւ̃|C^̔zŕێ.
+ *          萔𒴂ƃnbVlɂ쐬Č. <br>
+ *          폜̓|C^̔zɍ폜ς݂̈t邾ŋl߂Ȃ(O(1)). 폜ς݂𒴂lߒ. <br>
+ *          std::unordered_map<JsonKey, Json>Ɠ`Ŏg(find̖߂l, vf̌^Ȃǂ͓). <br>
+ *          std::string, CnameŌꍇJsonKey쐬, ǉ鎞̂ݍ쐬.
+ * @note ǉĂ̗vf͕̏ςȂ. 폜Ăc̗vf͕̏ςȂ. <br>
+ *       vf͈ړȂ, vfւ̎QƂƃ|C^͍폜܂ŗL(std::unordered_mapƓ). <br>
+ *       Ce[^͒ǉł͖ɂȂȂ. 폜ŋlߒꍇ͑SĖɂȂ.
+ */
+class JsonObject final
+{
+public:
+  //! namě^
+  typedef JsonKey key_type;
+  //! ľ^
+  typedef Json mapped_type;
+  //! vf̌^
+  typedef std::pair<const JsonKey, Json> value_type;
+  //! AP[^̌^
+  typedef JsonAllocator<value_type> allocator_type;
+  //! TCY^
+  typedef size_t size_type;
+
+  /**
+   * Ce[^(ǉɍ폜ς݂̗vf΂ĒH)
+   * @tparam V vf̌^(constłconst value_type)
+   */
+  template <class V>
+  class Iterator
+  {
+  private:
+    template <class> friend class Iterator;
+    friend class JsonObject;
+    //! Hobject
+    const JsonObject* m_owner;
+    //! ݂̈ʒu
+    size_t m_pos;
+
+  private:
+    /** 폜ς݂̗vf΂ */
+    void Skip()
+    {
+      if (m_owner->m_table == nullptr) return;
+      while (m_pos < m_owner->Count() && m_owner->Member(m_pos) == nullptr) ++m_pos;
+    }
+
+  public:
+    //! Ce[^̎
+    typedef std::forward_iterator_tag iterator_category;
+    //! vf̌^
+    typedef V value_type;
+    //! ^
+    typedef ptrdiff_t difference_type;
+    //! |C^^
+    typedef V* pointer;
+    //! Qƌ^
+    typedef V& reference;
+
+    /** RXgN^ */
+    Iterator() : m_owner(nullptr), m_pos(0) {}
+
+    /**
+     * RXgN^
+     * @param[in] owner Hobject
+     * @param[in] pos   ʒu
+     */
+    Iterator(const JsonObject* owner, size_t pos) : m_owner(owner), m_pos(pos)
+    {
+      this->Skip();
+    }
+
+    /**
+     * RXgN^(constł̕ϊ)
+     * @param[in] obj ϊ
+     */
+    template <class U>
+    Iterator(const Iterator<U>& obj, typename std::enable_if<std::is_convertible<U*, V*>::value>::type* = nullptr)
+      :m_owner(obj.m_owner),
+       m_pos(obj.m_pos)
+    {
+    }
+
+    /**
+     * vf擾
+     * @return vf
+     */
+    V& operator*() const
+    {
+      return *m_owner->Member(m_pos);
+    }
+
+    /**
+     * vf擾
+     * @return vf
+     */
+    V* operator->() const
+    {
+      return m_owner->Member(m_pos);
+    }
+
+    /**
+     * ̗vfɐi߂
+     * @return {IuWFNg
+     */
+    Iterator& operator++()
+    {
+      ++m_pos;
+      this->Skip();
+      return *this;
+    }
+
+    /**
+     * ̗vfɐi߂(u)
+     * @return i߂ÕCe[^
+     */
+    Iterator operator++(int)
+    {
+      Iterator prev(*this);
+      ++*this;
+      return prev;
+    }
+
+    /**
+     * vr
+     * @param[in] obj rΏ
+     * @return ʒułtrue
+     */
+    template <class U>
+    bool operator==(const Iterator<U>& obj) const
+    {
+      return m_owner == obj.m_owner && m_pos == obj.m_pos;
+    }
+
+    /**
+     * svr
+     * @param[in] obj rΏ
+     * @return قȂʒułtrue
+     */
+    template <class U>
+    bool operator!=(const Iterator<U>& obj) const
+    {
+      return !(*this == obj);
+    }
+  };
+
+  //! Ce[^
+  typedef Iterator<value_type> iterator;
+  //! Ce[^(const)
+  typedef Iterator<const value_type> const_iterator;
+
+private:
+  //! vfuubN(擪ɒu, ėvf̗̈mۂ)
+  struct Block
+  {
+    Block* next;     //!< OɊmۂubN
+    size_t capacity; //!< vf
+    size_t used;     //!< gpς݂̗vf
+  };
+
+  //! ǉƍ(ubNɂȂ邩, 萔𒴂邩, 폜object̂ݍ쐬)
+  struct Table
+  {
+    //! vfւ̃|C^(ǉ. 폜ʒunullptr)
+    std::vector<value_type*, JsonAllocator<value_type*>> order;
+    //! nbVlɂ(order̓Y+1, 0ł΋. vfȂԂ͋)
+    std::vector<size_t, JsonAllocator<size_t>> index;
+    //! 폜vf̗̈(̗̈ւ̃|C^Ōq. nullptr)
+    value_type* free;
+    //! orderɂ폜ς݂̐
+    size_t erased;
+
+    /**
+     * RXgN^
+     * @param[in] alloc mۂɎgpAP[^
+     */
+    explicit Table(const allocator_type& alloc) : order(alloc), index(alloc), free(nullptr), erased(0) {}
+  };
+
+  //! 쐬vf(葽Ȃ΍쐬)
+  static const size_t INDEX_THRESHOLD;
+  //! ŏɗvfǉ鎞Ɋmۂvf
+  static const size_t INITIAL_CAPACITY;
+  //! Ȃꍇ̈ʒu
+  static const size_t NPOS;
+  //! ubN̐擪ɒuBlock̑傫(vfP)
+  static const size_t BLOCK_HEADER;
+
+  //! mۂɎgpAP[^
+  allocator_type m_allocator;
+  //! ŌɊmۂubN(nullptr)
+  Block* m_blocks;
+  //! ǉƍ(nullptr. vf͍ŏ̃ubNɒǉɕ)
+  Table* m_table;
+
+private:
+  /**
+   * ubN̗vf̗̈̐擪擾
+   * @param[in] block ubN
+   * @return vf̗̈̐擪
+   */
+  static value_type* Members(Block* block)
+  {
+    return reinterpret_cast<value_type*>(block) + JsonObject::BLOCK_HEADER;
+  }
+
+  /**
+   * ʒu̐擾
+   * @return 폜ς݂܂߂ʒu̐
+   */
+  size_t Count() const
+  {
+    if (m_table != nullptr) return m_table->order.size();
+    return (m_blocks != nullptr) ? m_blocks->used : 0;
+  }
+
+  /**
+   * ʒu̗vf擾
+   * @param[in] pos ʒu
+   * @return vf(폜ς݂łnullptr)
+   */
+  value_type* Member(size_t pos) const
+  {
+    return (m_table != nullptr) ? m_table->order[pos] : JsonObject::Members(m_blocks) + pos;
+  }
+
+  /**
+   * name
+   * @param[in] key name
+   * @return vf̈ʒu(NPOS)
+   */
+  size_t Search(const JsonKey& key) const;
+
+  /**
+   * name()
+   * @param[in] data name̐擪
+   * @param[in] size namẽTCY(byte)
+   * @param[in] hash namẽnbVl(JsonKey::HashŌvZ)
+   * @return vf̈ʒu(NPOS)
+   */
+  size_t Search(const char* data, size_t size, size_t hash) const;
+
+  /**
+   * name(std::string)
+   * @param[in] name name
+   * @return vf̈ʒu(NPOS)
+   */
+  size_t Search(const std::string& name) const
+  {
+    return this->Search(name.data(), name.size(), JsonKey::Hash(name.data(), name.size()));
+  }
+
+  /**
+   * name(C)
+   * @param[in] name name
+   * @return vf̈ʒu(NPOS)
+   */
+  size_t Search(const char* name) const
+  {
+    const size_t size = std::strlen(name);
+    return this->Search(name, size, JsonKey::Hash(name, size));
+  }
+
+  /**
+   * nameɑΉl擾(nullǉ. )
+   * @param[in] data name̐擪
+   * @param[in] size namẽTCY(byte)
+   * @return l
+   */
+  Json& Subscript(const char* data, size_t size);
+
+  /**
+   * nameɑΉvf폜
+   * @param[in] pos vf̈ʒu(NPOS)
+   * @return 폜vf(0܂1)
+   */
+  size_t EraseAt(size_t pos);
+
+  /**
+   * ɗvfǉ(nameƂ͊mFς)
+   * @param[in] key   name([u)
+   * @param[in] value l([u)
+   * @return ǉvf
+   */
+  iterator Append(JsonKey&& key, Json&& value);
+
+  /**
+   * vf̗̈擾(폜̈悪΍ėp)
+   * @return vf̗̈(\z)
+   */
+  value_type* AllocateMember();
+
+  /**
+   * vf̗̈Ԃ(ɒǉvfɎg)
+   * @param[in] member vf̗̈(jς)
+   */
+  void FreeMember(value_type* member);
+
+  /**
+   * ubNǉ
+   * @param[in] capacity vf
+   */
+  void AddBlock(size_t capacity);
+
+  /** ǉƍ쐬 */
+  void MakeTable();
+
+  /** SĂ̗vfj, ubN */
+  void Release();
+
+  /**
+   * vfSĒǉ
+   * @param[in] obj ǉ(nameƒlRs[)
+   */
+  void Assign(const JsonObject& obj);
+
+  /**
+   * ɗvfo^
+   * @param[in] pos vf̈ʒu
+   */
+  void IndexMember(size_t pos);
+
+  /**
+   * vfO
+   * @param[in] pos vf̈ʒu
+   */
+  void UnindexMember(size_t pos);
+
+  /** 쐬(vfȂ΍폜) */
+  void RebuildIndex();
+
+  /** 폜ς݂̈菜ċlߒ(vf͈ړȂ) */
+  void Compact();
+
+public:
+  /** RXgN^(q[vmۂ) */
+  JsonObject() : m_blocks(nullptr), m_table(nullptr) {}
+
+  /**
+   * RXgN^
+   * @param[in] alloc mۂɎgpAP[^
+   */
+  explicit JsonObject(const allocator_type& alloc) : m_allocator(alloc), m_blocks(nullptr), m_table(nullptr) {}
+
+  /**
+   * Rs[RXgN^
+   * @param[in] obj Rs[
+   * @remarks vf̓q[vɍ쐬(AP[^̓Rs[Ȃ)
+   */
+  JsonObject(const JsonObject& obj);
+
+  /**
+   * RXgN^(Rs[)
+   * @param[in] obj   Rs[
+   * @param[in] alloc mۂɎgpAP[^
+   */
+  JsonObject(const JsonObject& obj, const allocator_type& alloc);
+
+  /**
+   * [uRXgN^
+   * @param[in] obj [uIuWFNg
+   */
+  JsonObject(JsonObject&& obj);
+
+  /**
+   * RXgN^([u)
+   * @param[in] obj   [uIuWFNg
+   * @param[in] alloc mۂɎgpAP[^(objƓłΗvf̂܂܈ڂ)
+   */
+  JsonObject(JsonObject&& obj, const allocator_type& alloc);
+
+  /**
+   * 
+   * @param[in] obj IuWFNg
+   */
+  JsonObject& operator=(const JsonObject& obj);
+
+  /**
+   * [u
+   * @param[in] obj [uIuWFNg
+   * @remarks AP[^ڂ
+   */
+  JsonObject& operator=(JsonObject&& obj);
+
+  /** fXgN^ */
+  ~JsonObject()
+  {
+    this->Release();
+  }
+
+  /**
+   * AP[^擾
+   * @return mۂɎgpAP[^
+   */
+  allocator_type get_allocator() const
+  {
+    return m_allocator;
+  }
+
+  /**
+   * 擪̃Ce[^
+   * @return ŏɒǉvf
+   */
+  iterator begin()
+  {
+    return iterator(this, 0);
+  }
+
+  /**
+   * 擪̃Ce[^(const)
+   * @return ŏɒǉvf
+   */
+  const_iterator begin() const
+  {
+    return const_iterator(this, 0);
+  }
+
+  /**
+   * I[̃Ce[^
+   * @return Ō̗vf̎
+   */
+  iterator end()
+  {
+    return iterator(this, this->Count());
+  }
+
+  /**
+   * I[̃Ce[^(const)
+   * @return Ō̗vf̎
+   */
+  const_iterator end() const
+  {
+    return const_iterator(this, this->Count());
+  }
+
+  /**
+   * 擪̃Ce[^(const)
+   * @return ŏɒǉvf
+   */
+  const_iterator cbegin() const
+  {
+    return const_iterator(this, 0);
+  }
+
+  /**
+   * I[̃Ce[^(const)
+   * @return Ō̗vf̎
+   */
+  const_iterator cend() const
+  {
+    return const_iterator(this, this->Count());
+  }
+
+  /**
+   * 󂩂ǂ
+   * @return vftrue
+   */
+  bool empty() const
+  {
+    return this->size() == 0;
+  }
+
+  /**
+   * vf擾
+   * @return vf
+   */
+  size_t size() const
+  {
+    return (m_table != nullptr) ? m_table->order.size() - m_table->erased : this->Count();
+  }
+
+  /**
+   * vf̗̈\񂷂
+   * @param[in] n vf
+   */
+  void reserve(size_t n);
+
+  /**
+   * ǉł̈ʒu̗vf擾
+   * @param[in] index ʒu(폜vf͐Ȃ)
+   * @return vf(͈͊Ołend)
+   * @remarks 폜ς݂̗vfO(1), ΐ擪琔
+   */
+  const_iterator nth(size_t index) const;
+
+  /** SĂ̗vf폜 */
+  void clear();
+
+  /**
+   * name
+   * @param[in] key name
+   * @return vf(end)
+   */
+  iterator find(const JsonKey& key);
+
+  /**
+   * name(const)
+   * @param[in] key name
+   * @return vf(end)
+   */
+  const_iterator find(const JsonKey& key) const;
+
+  /**
+   * name(. const)
+   * @param[in] data name̐擪
+   * @param[in] size namẽTCY(byte)
+   * @return vf(end)
+   * @remarks JsonKey쐬Ȃ, mۂɌł
+   */
+  const_iterator find(const char* data, size_t size) const;
+
+  /**
+   * name(std::string)
+   * @param[in] name name
+   * @return vf(end)
+   * @remarks JsonKey쐬Ȃ, mۂɌł(ȉstd::string, Cł)
+   */
+  iterator find(const std::string& name);
+
+  /**
+   * name(std::string. const)
+   * @param[in] name name
+   * @return vf(end)
+   */
+  const_iterator find(const std::string& name) const;
+
+  /**
+   * name(C)
+   * @param[in] name name
+   * @return vf(end)
+   */
+  iterator find(const char* name);
+
+  /**
+   * name(C. const)
+   * @param[in] name name
+   * @return vf(end)
+   */
+  const_iterator find(const char* name) const;
+
+  /**
+   * name̐擾
+   * @param[in] key name
+   * @return 1, 0
+   */
+  size_t count(const JsonKey& key) const;
+
+  /**
+   * name̐擾(std::string)
+   * @param[in] name name
+   * @return 1, 0
+   */
+  size_t count(const std::string& name) const;
+
+  /**
+   * name̐擾(C)
+   * @param[in] name name
+   * @return 1, 0
+   */
+  size_t count(const char* name) const;
+
+  /**
+   * nameɑΉl擾(nullǉ)
+   * @param[in] key name
+   * @return l
+   */
+  Json& operator[](const JsonKey& key);
+
+  /**
+   * nameɑΉl擾(nullǉ)
+   * @param[in] key name(ǉꍇ̓[u)
+   * @return l
+   */
+  Json& operator[](JsonKey&& key);
+
+  /**
+   * nameɑΉl擾(nullǉ. std::string)
+   * @param[in] name name
+   * @return l
+   * @remarks JsonKey͒ǉꍇ̂ݍ쐬(Cł)
+   */
+  Json& operator[](const std::string& name);
+
+  /**
+   * nameɑΉl擾(nullǉ. C)
+   * @param[in] name name
+   * @return l
+   */
+  Json& operator[](const char* name);
+
+  /**
+   * nameɑΉl擾
+   * @param[in] key name
+   * @return l
+   * @remarks std::out_of_range𓊂
+   */
+  Json& at(const JsonKey& key);
+
+  /**
+   * nameɑΉl擾(const)
+   * @param[in] key name
+   * @return l
+   * @remarks std::out_of_range𓊂
+   */
+  const Json& at(const JsonKey& key) const;
+
+  /**
+   * nameɑΉl擾(std::string)
+   * @param[in] name name
+   * @return l
+   * @remarks std::out_of_range𓊂
+   */
+  Json& at(const std::string& name);
+
+  /**
+   * nameɑΉl擾(std::string. const)
+   * @param[in] name name
+   * @return l
+   * @remarks std::out_of_range𓊂
+   */
+  const Json& at(const std::string& name) const;
+
+  /**
+   * nameɑΉl擾(C)
+   * @param[in] name name
+   * @return l
+   * @remarks std::out_of_range𓊂
+   */
+  Json& at(const char* name);
+
+  /**
+   * nameɑΉl擾(C. const)
+   * @param[in] name name
+   * @return l
+   * @remarks std::out_of_range𓊂
+   */
+  const Json& at(const char* name) const;
+
+  /**
+   * vfǉ
+   * @param[in] value vf
+   * @return ǉvf(ɂ΂̗vf), ǉǂ
+   */
+  std::pair<iterator, bool> insert(const value_type& value);
+
+  /**
+   * vfǉ
+   * @tparam K namě^
+   * @tparam V ľ^
+   * @param[in] key   name
+   * @param[in] value l
+   * @return ǉvf(ɂ΂̗vf), ǉǂ
+   * @remarks namestd::string, Cł, JsonKey͒ǉꍇ̂ݍ쐬
+   */
+  template <class K, class V>
+  std::pair<iterator, bool> emplace(K&& key, V&& value)
+  {
+    const size_t pos = this->Search(key);
+    if (pos != NPOS) return std::make_pair(iterator(this, pos), false);
+    return std::make_pair(this->Append(JsonKey(std::forward<K>(key)), Json(std::forward<V>(value))), true);
+  }
+
+  /**
+   * vf폜
+   * @param[in] pos 폜vf
+   * @return 폜vf̎
+   * @remarks 폜ς݂̈t邾Ō̗vf͋l߂Ȃ(c̗vfւ̎QƂ͗L)
+   */
+  iterator erase(const_iterator pos);
+
+  /**
+   * vf폜
+   * @param[in] key 폜name
+   * @return 폜vf(0܂1)
+   */
+  size_t erase(const JsonKey& key);
+
+  /**
+   * vf폜(std::string)
+   * @param[in] name 폜name
+   * @return 폜vf(0܂1)
+   */
+  size_t erase(const std::string& name);
+
+  /**
+   * vf폜(C)
+   * @param[in] name 폜name
+   * @return 폜vf(0܂1)
+   */
+  size_t erase(const char* name);
+
+  /**
+   * 
+   * @param[in,out] obj IuWFNg
+   */
+  void swap(JsonObject& obj);
+};
+}
+#endif // ANALYSISDRIVE_JSONOBJECT_H_
@@ -7,6 +7,8 @@
 #ifndef ANALYSISDRIVE_JSONPARSER_H_
 #define ANALYSISDRIVE_JSONPARSER_H_
 
+#include "JsonBind.h"
+#include <iosfwd>
 #include <memory>
 #include <string>
 #include <vector>
@@ -16,6 +18,7 @@ namespace adlib
 {
 // O錾
 class Json;
+class JsonHandler;
 
 /**
  * JSONp[T[
@@ -33,6 +36,55 @@ private:
   /* ֎~ */
   void operator=(const JsonParser&);
 
+  /**
+   * JSON`̕p[X, i[ɒڊi[
+   * @param[in] data   p[XΏۂ̐̕擪(I[͕sv)
+   * @param[in] size   p[XΏۂ̃̕TCY(byte)
+   * @param[in] target i[
+   * @return Ō܂Ŋi[łtrue
+   */
+  bool ParseIntoTarget(const char* data, size_t size, const JsonBindTarget& target);
+
+  /**
+   * JSON`̃t@Cp[X, i[ɒڊi[
+   * @param[in] path   p[XΏۂ̃t@CpX
+   * @param[in] target i[
+   * @return Ō܂Ŋi[łtrue
+   */
+  bool ParseFileIntoTarget(const std::string& path, const JsonBindTarget& target);
+
+public:
+  //! p[XGW
+  enum PARSE_ENGINE
+  {
+    RECURSIVE,       /*!< ċA~(擪1ǂݍ)                           */
+    STRUCTURAL_INDEX /*!< \CfbNX(\̈ʒuSIMDŐɋ߂)            */
+  };
+
+  //! G[R[h(Validatě)
+  enum ERROR_CODE
+  {
+    ERR_NONE,                              /*!< G[Ȃ                                 */
+    ERR_PARSE_FAILURE,                     /*!< JSOÑp[Xs                           */
+    ERR_0HEAD_NUMBER,                      /*!< 0ړnumber^                      */
+    ERR_BAD_WORD_IN_NUMBER,                /*!< number^ɖȕ܂܂Ă         */
+    ERR_INT_NUMBER_OUT_OF_RANGE,           /*!< number^()͈͊O̒l                 */
+    ERR_DOUBLE_NUMBER_OUT_OF_RANGE,        /*!< number^(double^)͈͊O̒l             */
+    ERR_NOT_DIGIT_FOLLOWER_DOT,            /*!< '.'̌㑱ɐl                      */
+    ERR_NOT_DIGIT_FOLLOWER_EXP,            /*!< 'e', 'E'̌㑱ɐl                 */
+    ERR_NOT_EXIST_DOUBLE_QUOTATION,        /*!< '"'Ȃ                    */
+    ERR_ESCAPE_CHARACTER_FAILURE,          /*!< sȃGXP[v                 */
+    ERR_EXIST_CODE_IN_SURROGATE,           /*!< TQ[g̈UNICODE              */
+    ERR_NOT_EXIST_BRACKET_IN_OBJ,          /*!< object'}'Ȃ                    */
+    ERR_NOT_EXIST_COMMA_IN_OBJ,            /*!< object2ڈȍ~̒l̑O','Ȃ     */
+    ERR_NOT_EXIST_DOUBLE_QUOTATION_IN_OBJ, /*!< objectɕJn'"'Ȃ              */
+    ERR_NOT_EXIST_COLON_IN_OBJ,            /*!< object':'Ȃ                          */
+    ERR_NOT_EXIST_BRACKET_IN_ARRAY,        /*!< array']'Ȃ                     */
+    ERR_NOT_EXIST_COMMA_IN_ARRAY,          /*!< array2ڈȍ~̒l̑O','Ȃ      */
+    ERR_VALUE_FAILURE,                     /*!< sȒl                             */
+    ERR_FILE_OPEN_FAILURE                  /*!< t@CJȂ                         */
+  };
+
 public:
   /** RXgN^ */
   JsonParser();
@@ -42,14 +94,261 @@ public:
   /**
    * JSON`̕p[X
    * @param[in] target p[XΏۂ̕
+   * @param[in] engine p[XGW
    * @return JsonIuWFNg
+   * @remarks STRUCTURAL_INDEX͍\̈ʒuɋ, zCgXy[Xǂ܂JsonIuWFNg쐬.
+   *          larray⏬object(bVȂ)łRECURSIVE葬. <br>
+   *          ʂƃG[bZ[WRECURSIVEƓ
+   *          (sJSON̏ꍇ, RECURSIVEŃp[XăG[bZ[W쐬).
    * @attention ܂ł̃G[bZ[W⃏[jObZ[W
    */
-  Json Parse(const std::string& target);
+  Json Parse(const std::string& target, PARSE_ENGINE engine = RECURSIVE);
+
+  /**
+   * JSON`̕p[X
+   * @param[in] data p[XΏۂ̐̕擪(I[͕sv)
+   * @param[in] size p[XΏۂ̃̕TCY(byte)
+   * @param[in] engine p[XGW
+   * @return JsonIuWFNg
+   * @remarks Ăяõobt@Rs[ɂ̂܂܃p[X. <br>
+   *          engineParse(const std::string&, PARSE_ENGINE)Q
+   * @attention ܂ł̃G[bZ[W⃏[jObZ[W
+   */
+  Json Parse(const char* data, size_t size, PARSE_ENGINE engine = RECURSIVE);
+
+  /**
+   * JSON`̃t@Cp[X
+   * @param[in] path   p[XΏۂ̃t@CpX
+   * @param[in] engine p[XGW
+   * @return JsonIuWFNg
+   * @remarks t@C͓ǂݍݐpŃ}bv, ɃRs[ɂ̂܂܃p[X. <br>
+   *          engineParse(const std::string&, PARSE_ENGINE)Q
+   * @attention ܂ł̃G[bZ[W⃏[jObZ[W
+   */
+  Json ParseFile(const std::string& path, PARSE_ENGINE engine = RECURSIVE);
+
+  /**
+   * JSON`̕p[X, ǂݍ񂾒lnhɒʒm
+   * @param[in]     target  p[XΏۂ̕
+   * @param[in,out] handler Cxg̒ʒm
+   * @return Ō܂Ńp[Xłtrue(G[, ܂̓nhɂ钆f̏ꍇfalse)
+   * @remarks JsonIuWFNg쐬, lǂݍ񂾏handler̊֐Ă. <br>
+   *          gp̓lXg̐[ƍŒstringl݂̂Ɉˑ. <br>
+   *          @ƃG[bZ[WParseƓ. , objectnamȅd͊mFȂ. <br>
+   *          nhɂ钆f̓G[ƂȂ(ErrorMessage()͋̂܂).
+   * @attention ܂ł̃G[bZ[W⃏[jObZ[W
+   */
+  bool ParseEvents(const std::string& target, JsonHandler* handler);
+
+  /**
+   * JSON`̕p[X, ǂݍ񂾒lnhɒʒm
+   * @param[in]     data    p[XΏۂ̐̕擪(I[͕sv)
+   * @param[in]     size    p[XΏۂ̃̕TCY(byte)
+   * @param[in,out] handler Cxg̒ʒm
+   * @return Ō܂Ńp[Xłtrue(G[, ܂̓nhɂ钆f̏ꍇfalse)
+   * @remarks ParseEvents(const std::string&, JsonHandler*)Q
+   * @attention ܂ł̃G[bZ[W⃏[jObZ[W
+   */
+  bool ParseEvents(const char* data, size_t size, JsonHandler* handler);
+
+  /**
+   * JSON`̃t@Cp[X, ǂݍ񂾒lnhɒʒm
+   * @param[in]     path    p[XΏۂ̃t@CpX
+   * @param[in,out] handler Cxg̒ʒm
+   * @return Ō܂Ńp[Xłtrue(G[, ܂̓nhɂ钆f̏ꍇfalse)
+   * @remarks t@C͓ǂݍݐpŃ}bv. <br>
+   *          ParseEvents(const std::string&, JsonHandler*)Q
+   * @attention ܂ł̃G[bZ[W⃏[jObZ[W
+   */
+  bool ParseFileEvents(const std::string& path, JsonHandler* handler);
+
+  /**
+   * JSON`̕p[X, \̂Ȃǂɒڊi[
+   * @tparam T i[̌^(Bindꉻ\, ܂JsonBindTraitsɑΉ^)
+   * @param[in]  target p[XΏۂ̕
+   * @param[out] value  i[
+   * @return Ō܂Ŋi[łtrue
+   * @remarks JsonIuWFNg쐬, ParseEventsœǂݍ񂾒lBind̑Ήtɏ]Ċi[. <br>
+   *          Bindɖname̒l͓ǂݔ΂, null͊i[Ȃ(i[̒l̂܂). <br>
+   *          ^vȂꍇ, li[̌^͈̔͊Ȍꍇ, l̃pX(u$.node[3].idv̌`)܂
+   *          G[bZ[Wi[Ēf(܂łɊi[l͎c).
+   * @attention ܂ł̃G[bZ[W⃏[jObZ[W
+   */
+  template <class T>
+  bool ParseInto(const std::string& target, T* value)
+  {
+    return this->ParseIntoTarget(target.data(), target.size(), JsonBindTarget(value));
+  }
+
+  /**
+   * JSON`̕p[X, \̂Ȃǂɒڊi[
+   * @tparam T i[̌^
+   * @param[in]  data  p[XΏۂ̐̕擪(I[͕sv)
+   * @param[in]  size  p[XΏۂ̃̕TCY(byte)
+   * @param[out] value i[
+   * @return Ō܂Ŋi[łtrue
+   * @remarks ParseInto(const std::string&, T*)Q
+   * @attention ܂ł̃G[bZ[W⃏[jObZ[W
+   */
+  template <class T>
+  bool ParseInto(const char* data, size_t size, T* value)
+  {
+    return this->ParseIntoTarget(data, size, JsonBindTarget(value));
+  }
+
+  /**
+   * JSON`̃t@Cp[X, \̂Ȃǂɒڊi[
+   * @tparam T i[̌^
+   * @param[in]  path  p[XΏۂ̃t@CpX
+   * @param[out] value i[
+   * @return Ō܂Ŋi[łtrue
+   * @remarks t@C͓ǂݍݐpŃ}bv. <br>
+   *          ParseInto(const std::string&, T*)Q
+   * @attention ܂ł̃G[bZ[W⃏[jObZ[W
+   */
+  template <class T>
+  bool ParseFileInto(const std::string& path, T* value)
+  {
+    return this->ParseFileIntoTarget(path, JsonBindTarget(value));
+  }
+
+  /**
+   * JSON`̕؂
+   * @param[in] target ؑΏۂ̕
+   * @return G[R[h(JSONłERR_NONE)
+   * @remarks JsonIuWFNg쐬ɕ@݂̂mF. @ParseƓ(objectnamȅd͊mFȂ). <br>
+   *          G[O⃁bZ[W̍쐬͍s킸, G[R[hƃG[ʒu(ErrorOffset())݂̂i[. <br>
+   *          G[bZ[WErrorMessage()̌Ăяoɍ쐬(ParseƓbZ[WɂȂ).
+   * @attention ܂ł̃G[bZ[W⃏[jObZ[W
+   */
+  ERROR_CODE Validate(const std::string& target);
+
+  /**
+   * JSON`̕؂
+   * @param[in] data ؑΏۂ̐̕擪(I[͕sv)
+   * @param[in] size ؑΏۂ̃̕TCY(byte)
+   * @return G[R[h(JSONłERR_NONE)
+   * @remarks Validate(const std::string&)Q
+   * @attention ܂ł̃G[bZ[W⃏[jObZ[W
+   */
+  ERROR_CODE Validate(const char* data, size_t size);
+
+  /**
+   * JSON`̃t@C؂
+   * @param[in] path ؑΏۂ̃t@CpX
+   * @return G[R[h(JSONłERR_NONE)
+   * @remarks t@C͓ǂݍݐpŃ}bv. <br>
+   *          Validate(const std::string&)Q
+   * @attention ܂ł̃G[bZ[W⃏[jObZ[W
+   */
+  ERROR_CODE ValidateFile(const std::string& path);
+
+  /**
+   * OValidatẽG[R[h擾
+   * @return G[R[h(, ܂ValidateȊȌꍇERR_NONE)
+   */
+  ERROR_CODE ErrorCode() const;
+
+  /**
+   * OValidateŃG[oʒu擾
+   * @return ؑΏۂ̐擪̈ʒu(byte). ̓rŏIĂꍇ͌ؑΏۂ̃TCY
+   */
+  size_t ErrorOffset() const;
+
+  /**
+   * JSON`̕𕪊ē͂
+   * @param[in] data ̐擪(I[͕sv)
+   * @param[in] size ̃TCY(byte)
+   * @remarks lbg[NpCvȂ, Ŝ낤OɃf[^󂯎ꍇɎgp. <br>
+   *          ͂ێ, 󂯎p[Xi߂(l̓rŕĂĂ悢). <br>
+   *          ŌFinishĂŃp[Xʂ擾. @ƃG[bZ[WParseƓ.
+   * @attention OFinishȍ~, ŏFeedł܂ł̃G[bZ[W⃏[jObZ[W
+   */
+  void Feed(const char* data, size_t size);
+
+  /**
+   * ͂I, p[Xʂ擾
+   * @return JsonIuWFNg(G[null^)
+   */
+  Json Finish();
+
+  /**
+   * Xg[ǂݍ݂Ȃp[X
+   * @param[in,out] stream ̓Xg[
+   * @return JsonIuWFNg
+   * @remarks TCYǂݍFeed, ŏʂ̒lǂݏI_œǂݍ݂߂
+   * @attention ܂ł̃G[bZ[W⃏[jObZ[W
+   */
+  Json ParseStream(std::istream* stream);
+
+  /**
+   * Qƃ[hݒ肷
+   * @param[in] stringViewMode trueł, ȍ~ParsestringlRs[ɓ͂QƂ
+   * @remarks GXP[v܂܂Ȃstringl͓̓obt@QƂ, Rs[GetString̏Ăяo܂Œx点
+   *          (GetStringViewł΃Rs[Ȃ). GXP[v܂stringlobjectname͏ɃRs[. <br>
+   *          ParseFileł̓}bv̈p[Xʂƈꏏɕێ邽, ɃA[imۂ
+   *          (A[i[hƓ, vf, ô݂ێꍇ͍ŏʂ̒lێ邱). <br>
+   *          Feed, ParseStreamł͓͂ێȂ, {[h͎gpȂ.
+   * @attention Parse(const char*, size_t), Parse(const std::string&)ł, ̓obt@
+   *            p[X(Ƃ̃Rs[)SĔj܂ŗLł邱
+   */
+  void SetStringViewMode(bool stringViewMode);
+
+  /**
+   * Qƃ[hǂ
+   * @return Qƃ[hłtrue
+   */
+  bool IsStringViewMode() const;
+
+  /**
+   * p[XɎgpXbhݒ肷
+   * @param[in] threadCount Xbh(0ł΃n[hEFÃXbh. l1)
+   * @remarks 2ȏ̏ꍇ, ŏ(܂͂̒)̑傫arrayvf̋؂ŕ, XbhŃp[X.
+   *          p[Xʂ͌̏1arrayɂ܂Ƃ߂. ȓ͂1XbhŃp[X. <br>
+   *          , G[bZ[W, [jObZ[W1Xbh̏ꍇƓ. <br>
+   *          Parse, ParseFileRECURSIVÊ݂Ώ(ParseEvents, Feed, ParseStream͏1Xbh).
+   */
+  void SetThreadCount(size_t threadCount);
+
+  /**
+   * p[XɎgpXbh擾
+   * @return Xbh
+   */
+  size_t GetThreadCount() const;
+
+  /**
+   * A[i[hݒ肷
+   * @param[in] arenaMode trueł, ȍ~ParseőSĂ̒l1̃A[imۂ
+   * @remarks A[i̓p[T[ƃp[Xʂ̍ŏʂ̒l(Ƃ̃Rs[)L, SĔjꂽ_ł܂Ƃ߂ĉ
+   *          (lƂɂ̓A[iQƂȂ). <br>
+   *          ʂ̒lf[^p[Xꍇ, mۂƉ̉񐔂啝ɍ팸ł. <br>
+   *          ̃p[X̎_őÕp[XʂSĔjĂ, A[i͉ɍėp
+   *          (ȃf[^JԂp[Xꍇ, 2ڈȍ~͂قڃmۂȂ).
+   * @attention A[i̓XbhZ[tł͂Ȃ, p[Xʂarrayobjectւ̗vf̒ǉ
+   *            1̃Xbhs. <br>
+   *            p[Xʂ̗vf, ô݂ێꍇ, ŏʂ̒lێ邱
+   *            (ŏʂ̒lSĔj, ̃p[XŃA[iėp)
+   */
+  void SetArenaMode(bool arenaMode);
+
+  /**
+   * A[i[hǂ
+   * @return A[i[hłtrue
+   */
+  bool IsArenaMode() const;
+
+  /**
+   * ێĂobt@ƃA[i
+   * @remarks p[T[͍Ɨp̃obt@(ƃA[i)̗eʂێ܂, ̃p[Xōėp. <br>
+   *          傫ȃf[^p[X, ΂炭p[XȂꍇȂǂɌĂ.
+   * @attention ܂ł̃G[bZ[W⃏[jObZ[W
+   */
+  void ReleaseBuffers();
 
   /**
    * G[bZ[W擾
    * @return G[bZ[W̃Rei(ł΃TCY0)
+   * @remarks ValidatẽG[bZ[W͖{֐̏Ăяoɍ쐬
    */
   const std::vector<std::string>& ErrorMessage() const;
 
@@ -71,7 +370,6 @@ public:
  * @section JsonParser_exsample exsample
  * @code
  * #include "AnalysisDrive.h"
- * #include <fstream>
  * #include <iostream>
  *
  * // ̃f[^t@C"test.txt"ŗp
@@ -94,20 +392,12 @@ public:
  *
  * int main()
  * {
- *   // t@Cǂݍ
- *   std::ifstream ifs;
- *   ifs.open(file);
- *
- *   // obt@JSOÑf[^i[
- *   std::string buf("");
- *   std::string tmp("");
- *   while (std::getline(ifs, tmp)) buf += tmp;
- *
  *   // p[T[p
  *   adlib::JsonParser parser;
  *
- *   // p[XJSONIuWFNg擾
- *   auto json = parser.Parse(buf);
+ *   // t@Cp[XJSONIuWFNg擾
+ *   //  p[Xꍇparser.Parse(buf)gp
+ *   auto json = parser.ParseFile(file);
  *   // G[mF
  *   if (parser.ErrorMessage().size() > 0)
  *   {
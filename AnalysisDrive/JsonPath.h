@@ -0,0 +1,335 @@
+/**
+ * @file   JsonPath.h
+ * @brief  JSONIuWFNg̃pX(JSON Pointer)
+ * @author kyo
+ * @date   2026/10/17
+ */
+#ifndef ANALYSISDRIVE_JSONPATH_H_
+#define ANALYSISDRIVE_JSONPATH_H_
+
+#include "Json.h"
+#include "JsonKey.h"
+#include "JsonView.h"
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <vector>
+
+/** Analysis Drive */
+namespace adlib
+{
+/**
+ * JSONIuWFNg̃pX(JSON Pointer)
+ * @remarks u/method/timestepv̌`(RFC 6901)̃pXx͂, xł]ł. <br>
+ *          eKwname̓nbVlvZς݂JsonKeyƂ, array̓Y͐lƂĕێ. <br>
+ *          u*v̊Kwarray̑SĂ̗vf(object̏ꍇ͑SĂ̒l)Ɉv. <br>
+ *          ]const̎QƂ݂̂ōs, ݂ȂnameĂJsonIuWFNgύXȂ. <br>
+ *          vlJsonViewŕԂ(ÄɕێĂarray̗vf͒lRs[, vfƂJsonIuWFNg쐬Ȃ).
+ * @note naméu~vu/v͂ꂼu~0vu~1vƏ. u*vƂOname͎włȂ. <br>
+ *       u01v̂悤ɐ擪02ȏ̐, YƂĕs(RFC 6901)ȂߕsȃpXɂȂ.
+ */
+class JsonPath final
+{
+private:
+  //> G[bZ[Wi[obt@TCY
+  static const size_t BUFFER_SIZE;
+  //> YłȂꍇ̒l
+  static const size_t NPOS;
+  //> G[bZ[W --- pX'/'Ŏn܂ĂȂ
+  static const std::string ERR_MSG_NOT_START_WITH_SLASH;
+  //> G[bZ[W --- sȃGXP[v
+  static const std::string ERR_MSG_ESCAPE_CHARACTER_FAILURE;
+  //> G[bZ[W --- Y̐擪0
+  static const std::string ERR_MSG_LEADING_ZERO_INDEX;
+
+  //> pX̊Kw
+  struct Segment
+  {
+    JsonKey name;  //!< name(object̏ꍇ)
+    size_t index;  //!< Y(array̏ꍇ. YƂĕsłNPOS)
+    bool wildcard; //!< u*vłtrue
+  };
+
+  //> ChJ[hŗ񋓒array, object
+  struct Cursor
+  {
+    JsonView node;    //!< 񋓒array, object
+    size_t segment;   //!< ChJ[h̊Kw
+    size_t position;  //!< ɗ񋓂vf̈ʒu
+  };
+
+  //! pX
+  std::string m_pointer;
+  //! ͂Kw
+  std::vector<Segment> m_segments;
+  //! G[bZ[W(ł΋)
+  std::string m_errorMsg;
+
+private:
+  /** pX͂(sȃpXł΃G[bZ[Wthrow) */
+  void Compile();
+
+  /**
+   * G[bZ[W쐬
+   * @param[in] messageTemp G[bZ[W
+   * @return pX𖄂ߍ񂾃G[bZ[W
+   */
+  std::string MakeErrorMessage(const std::string& messageTemp) const;
+
+  /**
+   * array̓Y͂
+   * @param[in] token Kw̕
+   * @return Y(YƂĕsłNPOS)
+   */
+  static size_t ParseIndex(const std::string& token);
+
+  /**
+   * KwɈvq擾
+   * @param[in]  node    e̒l
+   * @param[in]  segment Kw
+   * @param[out] child   q
+   * @return qtrue
+   */
+  static bool Child(const JsonView& node, const Segment& segment, JsonView* child);
+
+  /**
+   * wʒu̎q擾(ChJ[hp)
+   * @param[in]  node     e̒l
+   * @param[in]  position ʒu
+   * @param[out] child    q
+   * @return qtrue
+   */
+  static bool ChildAt(const JsonView& node, size_t position, JsonView* child);
+
+public:
+  /** vl̃Ce[^(l񋓂邽тɎ̈vT) */
+  class Iterator
+  {
+  private:
+    //! pX
+    const JsonPath* m_path;
+    //! ]JsonIuWFNg
+    const Json* m_root;
+    //! ChJ[hŗ񋓒array, object(ł[)
+    std::vector<Cursor> m_stack;
+    //! vl
+    JsonView m_current;
+    //! vltrue(I[łfalse)
+    bool m_matched;
+
+    /**
+     * ẘKw疖̊Kw܂łǂ
+     * @param[in] node    ǂn߂l
+     * @param[in] segment ǂn߂Kw
+     * @return vtrue(ChJ[h̏ꍇ͗񋓂Jnfalse)
+     */
+    bool Descend(const JsonView& node, size_t segment);
+
+    /** ̈vT(ΏI[ɂȂ) */
+    void Next();
+
+  public:
+    //! Ce[^̎
+    typedef std::forward_iterator_tag iterator_category;
+    //! ľ^
+    typedef JsonView value_type;
+    //! ̌^
+    typedef std::ptrdiff_t difference_type;
+    //! |C^^
+    typedef const JsonView* pointer;
+    //! Qƌ^
+    typedef const JsonView& reference;
+
+    /** RXgN^(I[) */
+    Iterator() : m_path(nullptr), m_root(nullptr), m_matched(false) {}
+
+    /**
+     * RXgN^
+     * @param[in] path pX
+     * @param[in] root ]JsonIuWFNg
+     */
+    Iterator(const JsonPath* path, const Json* root);
+
+    /**
+     * vl擾
+     * @return vl
+     */
+    const JsonView& operator*() const
+    {
+      return m_current;
+    }
+
+    /**
+     * vl擾
+     * @return vl
+     */
+    const JsonView* operator->() const
+    {
+      return &m_current;
+    }
+
+    /**
+     * ̈vɐi߂
+     * @return {Ce[^
+     */
+    Iterator& operator++()
+    {
+      this->Next();
+      return *this;
+    }
+
+    /**
+     * vr
+     * @param[in] obj rΏ
+     * @return ʒu(܂͋ɏI[)łtrue
+     */
+    bool operator==(const Iterator& obj) const;
+
+    /**
+     * svr
+     * @param[in] obj rΏ
+     * @return قȂʒułtrue
+     */
+    bool operator!=(const Iterator& obj) const
+    {
+      return !(*this == obj);
+    }
+  };
+
+  /** vl͈̔(͈forŗ񋓂) */
+  class Range
+  {
+  private:
+    //! pX
+    const JsonPath* m_path;
+    //! ]JsonIuWFNg
+    const Json* m_root;
+
+  public:
+    /**
+     * RXgN^
+     * @param[in] path pX
+     * @param[in] root ]JsonIuWFNg
+     */
+    Range(const JsonPath* path, const Json* root) : m_path(path), m_root(root) {}
+
+    /**
+     * 擪̃Ce[^
+     * @return ŏɈvl(ōŏ̈vT)
+     */
+    Iterator begin() const
+    {
+      return Iterator(m_path, m_root);
+    }
+
+    /**
+     * I[̃Ce[^
+     * @return I[
+     */
+    Iterator end() const
+    {
+      return Iterator();
+    }
+  };
+
+public:
+  /** RXgN^(JsonIuWFNgŜwpX) */
+  JsonPath();
+
+  /**
+   * RXgN^
+   * @param[in] pointer pX(u/method/timestepv, u/node//coordv̌`)
+   * @remarks pX͂. sȃpXłIsValidfalseɂȂ, ]ĂvȂ.
+   */
+  explicit JsonPath(const std::string& pointer);
+
+  /**
+   * pXǂ
+   * @return ͂łĂtrue
+   */
+  bool IsValid() const;
+
+  /**
+   * G[bZ[W擾
+   * @return G[bZ[W(ł΋)
+   */
+  const std::string& ErrorMessage() const;
+
+  /**
+   * pX擾
+   * @return RXgN^Ŏw肵pX
+   */
+  const std::string& GetPointer() const;
+
+  /**
+   * ChJ[h܂ނǂ
+   * @return u*v̊Kwtrue
+   */
+  bool HasWildcard() const;
+
+  /**
+   * ŏɈvl擾
+   * @param[in]  root  ]JsonIuWFNg
+   * @param[out] value vl
+   * @return vtrue(vȂvalueύXȂ)
+   */
+  bool Find(const Json& root, JsonView* value) const;
+
+  /**
+   * ŏɈvl擾
+   * @param[in] root ]JsonIuWFNg
+   * @return vl(null)
+   */
+  JsonView Get(const Json& root) const;
+
+  /**
+   * vlSė񋓂
+   * @param[in] root ]JsonIuWFNg
+   * @return vl͈̔(񋓂邽тɎ̈vT)
+   * @attention rootƖ{IuWFNg, 񋓂I܂ŗLł邱
+   */
+  Range Select(const Json& root) const;
+
+  /**
+   * pX̒lݒ肷
+   * @param[in,out] root  ݒ肷JsonIuWFNg
+   * @param[in]     value l
+   * @return ݒ肷true(sȃpX, ChJ[h܂ރpX, r̊Kwꍇ͕ύXȂ)
+   * @remarks ̊KwobjectɖnamełΒǉ, array̗vfƓYłΖɒǉ. <br>
+   *          JsonIuWFNgƋLĂl, rootݒ肷l܂ł̌oĤ݃Rs[(ȊO͋L܂). <br>
+   *          ύX\ȎQƂԂȂ, ݒroot̃Rs[lL(Rs[͎QƃJEg̑̂)
+   */
+  bool Set(Json* root, Json value) const;
+};
+
+/**
+ * @class   JsonPath
+ * @section JsonPath_exsample exsample
+ * @code
+ * #include "AnalysisDrive.h"
+ * #include <iostream>
+ *
+ * int main()
+ * {
+ *   adlib::JsonParser parser;
+ *   // pX͈x͂
+ *   const adlib::JsonPath timestep("/method/timestep");
+ *   const adlib::JsonPath coord("/node//coord");
+ *
+ *   for (const auto& path : { "result1.json", "result2.json" })
+ *   {
+ *     const adlib::Json json = parser.ParseFile(path);
+ *     std::cout << "timestep " << timestep.Get(json).GetNumberInt() << std::endl;
+ *     // SĂnodecoordɎ擾
+ *     for (const adlib::JsonView& value : coord.Select(json))
+ *     {
+ *       std::cout << value.Size() << std::endl;
+ *     }
+ *   }
+ *   return 0;
+ * }
+ * @endcode
+ * @note Ĺuv͔ṕu*v
+ */
+}
+#endif // ANALYSISDRIVE_JSONPATH_H_
@@ -0,0 +1,130 @@
+/**
+ * @file   JsonSink.h
+ * @brief  JSONo͐
+ * @author kyo
+ * @date   2026/10/17
+ */
+#ifndef ANALYSISDRIVE_JSONSINK_H_
+#define ANALYSISDRIVE_JSONSINK_H_
+
+#include <cstddef>
+#include <cstdio>
+#include <ostream>
+#include <string>
+
+/** Analysis Drive */
+namespace adlib
+{
+/**
+ * JSONo͐
+ * @remarks JsonWriterobt@ɂ܂Ƃ߂o͂, 傫ȃubNPʂŎ󂯎. <br>
+ *          (JsonStringSink), FILE*(JsonFileSink), Xg[(JsonStreamSink)pӂĂ.
+ *          ȊȌo͖͐{NXpč쐬.
+ */
+class JsonSink
+{
+public:
+  /** RXgN^ */
+  JsonSink();
+
+  /** zfXgN^ */
+  virtual ~JsonSink();
+
+  /**
+   * o͂
+   * @param[in] data o͂f[^̐擪
+   * @param[in] size o͂f[^̃TCY(byte)
+   * @return o͂łtrue
+   */
+  virtual bool Write(const char* data, size_t size) = 0;
+
+  /**
+   * o͐ɔf
+   * @return fłtrue
+   */
+  virtual bool Flush();
+};
+
+/** JSONo͐() */
+class JsonStringSink final : public JsonSink
+{
+private:
+  //! o͐̕
+  std::string* m_str;
+
+public:
+  /**
+   * RXgN^
+   * @param[in,out] str o͐̕(ɒǉ)
+   */
+  explicit JsonStringSink(std::string* str);
+
+  /**
+   * o͂
+   * @param[in] data o͂f[^̐擪
+   * @param[in] size o͂f[^̃TCY(byte)
+   * @return true
+   */
+  bool Write(const char* data, size_t size) override;
+};
+
+/** JSONo͐(FILE*) */
+class JsonFileSink final : public JsonSink
+{
+private:
+  //! o͐̃t@C
+  std::FILE* m_file;
+
+public:
+  /**
+   * RXgN^
+   * @param[in,out] file o͐̃t@C(oCi[hŊJ. ̂͌Ăяo)
+   * @remarks t@CfBXNv^֏o͂ꍇ, _fdopen(fdopen)FILE*ɂēn
+   */
+  explicit JsonFileSink(std::FILE* file);
+
+  /**
+   * o͂
+   * @param[in] data o͂f[^̐擪
+   * @param[in] size o͂f[^̃TCY(byte)
+   * @return Sď߂true
+   */
+  bool Write(const char* data, size_t size) override;
+
+  /**
+   * o͐ɔf(fflush)
+   * @return fłtrue
+   */
+  bool Flush() override;
+};
+
+/** JSONo͐(Xg[) */
+class JsonStreamSink final : public JsonSink
+{
+private:
+  //! o͐̃Xg[
+  std::ostream* m_stream;
+
+public:
+  /**
+   * RXgN^
+   * @param[in,out] stream o͐̃Xg[
+   */
+  explicit JsonStreamSink(std::ostream* stream);
+
+  /**
+   * o͂
+   * @param[in] data o͂f[^̐擪
+   * @param[in] size o͂f[^̃TCY(byte)
+   * @return Xg[łtrue
+   */
+  bool Write(const char* data, size_t size) override;
+
+  /**
+   * o͐ɔf(std::flush)
+   * @return Xg[łtrue
+   */
+  bool Flush() override;
+};
+}
+#endif // ANALYSISDRIVE_JSONSINK_H_
@@ -0,0 +1,98 @@
+/**
+ * @file   JsonSpan.h
+ * @brief  JSONarray̘Ä̎Q
+ * @author kyo
+ * @date   2026/10/17
+ */
+#ifndef ANALYSISDRIVE_JSONSPAN_H_
+#define ANALYSISDRIVE_JSONSPAN_H_
+
+#include <cstddef>
+
+/** Analysis Drive */
+namespace adlib
+{
+/**
+ * JSONarray̘Ä̎Q
+ * @tparam T vf̌^
+ * @remarks vfRs[, 擪Ɨvfێ(std::span). <br>
+ *          Json::GetDoubleSpan, Json::GetInt64SpanŎ擾.
+ * @attention QƐarrayj, ύXꂽ͎gpȂ
+ */
+template <class T>
+class JsonSpan final
+{
+private:
+  //! 擪̗vf
+  const T* m_data;
+  //! vf
+  size_t m_size;
+
+public:
+  /** RXgN^() */
+  JsonSpan() : m_data(nullptr), m_size(0) {}
+
+  /**
+   * RXgN^
+   * @param[in] data 擪̗vf
+   * @param[in] size vf
+   */
+  JsonSpan(const T* data, size_t size) : m_data(data), m_size(size) {}
+
+  /**
+   * 擪̗vf擾
+   * @return 擪̗vf(łnullptr)
+   */
+  const T* Data() const
+  {
+    return m_data;
+  }
+
+  /**
+   * vf擾
+   * @return vf
+   */
+  size_t Size() const
+  {
+    return m_size;
+  }
+
+  /**
+   * 󂩂ǂ
+   * @return vftrue
+   */
+  bool Empty() const
+  {
+    return m_size == 0;
+  }
+
+  /**
+   * 擪̃Ce[^
+   * @return 擪̗vf
+   */
+  const T* begin() const
+  {
+    return m_data;
+  }
+
+  /**
+   * I[̃Ce[^
+   * @return Ō̗vf̎
+   */
+  const T* end() const
+  {
+    return m_data + m_size;
+  }
+
+  /**
+   * vf̎擾
+   * @param[in] i CfbNX
+   * @return vf
+   */
+  const T& operator[](size_t i) const
+  {
+    return m_data[i];
+  }
+};
+}
+#endif // ANALYSISDRIVE_JSONSPAN_H_
@@ -0,0 +1,165 @@
+/**
+ * @file   JsonStringView.h
+ * @brief  JSONstringl̎Q
+ * @author kyo
+ * @date   2026/10/17
+ */
+#ifndef ANALYSISDRIVE_JSONSTRINGVIEW_H_
+#define ANALYSISDRIVE_JSONSTRINGVIEW_H_
+
+#include <cstddef>
+#include <cstring>
+#include <ostream>
+#include <string>
+
+/** Analysis Drive */
+namespace adlib
+{
+/**
+ * JSONstringl̎Q
+ * @remarks Rs[, 擪ƃTCYێ(std::string_view). <br>
+ *          I[͕tȂ, CƂĈꍇToStringŃRs[邱.
+ * @attention QƐ̕񂪔jꂽ͎gpȂ
+ */
+class JsonStringView final
+{
+private:
+  //! ̐擪
+  const char* m_data;
+  //! ̃TCY(byte)
+  size_t m_size;
+
+public:
+  /** RXgN^(󕶎) */
+  JsonStringView() : m_data(""), m_size(0) {}
+
+  /**
+   * RXgN^
+   * @param[in] data ̐擪
+   * @param[in] size ̃TCY(byte)
+   */
+  JsonStringView(const char* data, size_t size) : m_data(data), m_size(size) {}
+
+  /**
+   * RXgN^
+   * @param[in] str QƂ镶
+   */
+  JsonStringView(const std::string& str) : m_data(str.data()), m_size(str.size()) {}
+
+  /**
+   * ̐擪擾
+   * @return ̐擪(I[͕tȂ)
+   */
+  const char* Data() const
+  {
+    return m_data;
+  }
+
+  /**
+   * ̃TCY擾
+   * @return TCY(byte)
+   */
+  size_t Size() const
+  {
+    return m_size;
+  }
+
+  /**
+   * 󕶎ǂ
+   * @return 󕶎Ȃtrue
+   */
+  bool Empty() const
+  {
+    return m_size == 0;
+  }
+
+  /**
+   * 擪̃Ce[^
+   * @return 擪̕
+   */
+  const char* begin() const
+  {
+    return m_data;
+  }
+
+  /**
+   * I[̃Ce[^
+   * @return Ō̎̕
+   */
+  const char* end() const
+  {
+    return m_data + m_size;
+  }
+
+  /**
+   * ̎擾
+   * @param[in] i CfbNX
+   * @return 
+   */
+  char operator[](size_t i) const
+  {
+    return m_data[i];
+  }
+
+  /**
+   * std::stringɃRs[
+   * @return Rs[
+   */
+  std::string ToString() const
+  {
+    return std::string(m_data, m_size);
+  }
+
+  /**
+   * vr
+   * @param[in] obj rΏ
+   * @return łtrue
+   */
+  bool operator==(const JsonStringView& obj) const
+  {
+    return m_size == obj.m_size && std::memcmp(m_data, obj.m_data, m_size) == 0;
+  }
+
+  /**
+   * svr
+   * @param[in] obj rΏ
+   * @return قȂ镶łtrue
+   */
+  bool operator!=(const JsonStringView& obj) const
+  {
+    return !(*this == obj);
+  }
+
+  /**
+   * vr(C)
+   * @param[in] str rΏ
+   * @return łtrue
+   */
+  bool operator==(const char* str) const
+  {
+    return *this == JsonStringView(str, std::strlen(str));
+  }
+
+  /**
+   * svr(C)
+   * @param[in] str rΏ
+   * @return قȂ镶łtrue
+   */
+  bool operator!=(const char* str) const
+  {
+    return !(*this == str);
+  }
+};
+
+/**
+ * Xg[ւ̏o
+ * @param[in,out] outStream o͐̃Xg[
+ * @param[in]     view      o͂镶
+ * @return o͐̃Xg[
+ */
+inline std::ostream& operator<<(std::ostream& outStream, const JsonStringView& view)
+{
+  return outStream.write(view.Data(), static_cast<std::streamsize>(view.Size()));
+}
+}
+#endif // ANALYSISDRIVE_JSONSTRINGVIEW_H_
@@ -0,0 +1,196 @@
+/**
+ * @file   JsonView.h
+ * @brief  JSONIuWFNg̎Q
+ * @author kyo
+ * @date   2026/10/17
+ */
+#ifndef ANALYSISDRIVE_JSONVIEW_H_
+#define ANALYSISDRIVE_JSONVIEW_H_
+
+#include "Json.h"
+#include "JsonKey.h"
+#include "JsonSpan.h"
+#include "JsonStringView.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/** Analysis Drive */
+namespace adlib
+{
+/**
+ * JSONIuWFNg̎Q
+ * @remarks JsonDocument::RootŎ擾, vf, oJsonViewƂĎ擾. <br>
+ *          JsonIuWFNgƈقȂQƃJEgȂ, Rs[ĂLf[^ɏ܂Ȃ
+ *          (XbhœhLgQƂĂȂ). <br>
+ *          ÄɕێĂarray̗vf, lRs[ĕێ(JsonIuWFNg쐬Ȃ).
+ * @attention QƐJsonDocumentjꂽ͎gpȂ
+ */
+class JsonView final
+{
+private:
+  //! QƐ(nullptrłm_scalar̒l)
+  const Json* m_node;
+  //! QƐȂl(ÄɕێĂarray̗vf, ܂null)
+  Json m_scalar;
+
+public:
+  /** RXgN^(null) */
+  JsonView() : m_node(nullptr) {}
+
+  /**
+   * RXgN^
+   * @param[in] node QƐ(nullptrłnull)
+   */
+  explicit JsonView(const Json* node) : m_node(node) {}
+
+  /**
+   * QƐJsonIuWFNg擾
+   * @return QƐ(DumpȂǂɎgp)
+   */
+  const Json& GetJson() const
+  {
+    return (m_node != nullptr) ? *m_node : m_scalar;
+  }
+
+  /**
+   * ^擾
+   * @return ^
+   */
+  Json::JSON_VALUE_TYPE GetValueType() const;
+
+  /**
+   * nullǂ
+   * @return nullȂtrue
+   */
+  bool IsNull() const;
+
+  /**
+   * stringǂ
+   * @return stringȂtrue
+   */
+  bool IsString() const;
+
+  /**
+   * number(int, int64 or double)ǂ
+   * @return numberȂtrue
+   */
+  bool IsNumber() const;
+
+  /**
+   * boolǂ
+   * @return boolȂtrue
+   */
+  bool IsBool() const;
+
+  /**
+   * arrayǂ
+   * @return arrayȂtrue
+   */
+  bool IsArray() const;
+
+  /**
+   * objectǂ
+   * @return objectȂtrue
+   */
+  bool IsObject() const;
+
+  /**
+   * stringlget
+   * @return stringl
+   */
+  const std::string& GetString() const;
+
+  /**
+   * stringl̎QƂget
+   * @return stringl̎Q(stringȊO͋󕶎)
+   */
+  JsonStringView GetStringView() const;
+
+  /**
+   * numberl(int)get
+   * @return numberl(int)
+   */
+  int GetNumberInt() const;
+
+  /**
+   * numberl(int64)get
+   * @return numberl(int64)
+   */
+  std::int64_t GetNumberInt64() const;
+
+  /**
+   * number(double)get
+   * @return numberl(double)
+   */
+  double GetNumberDouble() const;
+
+  /**
+   * boollget
+   * @return booll
+   */
+  bool GetBool() const;
+
+  /**
+   * arrayl(double̘Ä)get
+   * @return vf̎Q(ÄɕێĂȂ΋)
+   */
+  JsonSpan<double> GetDoubleSpan() const;
+
+  /**
+   * arrayl(int64̘Ä)get
+   * @return vf̎Q(ÄɕێĂȂ΋)
+   */
+  JsonSpan<std::int64_t> GetInt64Span() const;
+
+  /**
+   * vf擾
+   * @return array̗vf, object̃o(ȊO0)
+   */
+  size_t Size() const;
+
+  /**
+   * vf擾
+   * @param[in] index ʒu
+   * @return array̗vf, object̃o̒l(ǉ. ͈͊Ołnull)
+   * @remarks ÄɕێĂarraył, vfƂJsonIuWFNg쐬Ȃ
+   */
+  JsonView operator[](size_t index) const;
+
+  /**
+   * object̃oname擾
+   * @param[in] index ʒu(ǉ)
+   * @return name(objectłȂ, ܂͔͈͊Oł΋󕶎)
+   */
+  JsonStringView GetName(size_t index) const;
+
+  /**
+   * objectnameɑΉl擾
+   * @param[in] name name
+   * @return l(objectłȂ, ܂namenull)
+   */
+  JsonView At(const std::string& name) const;
+
+  /**
+   * objectnameɑΉl擾(C)
+   * @param[in] name name
+   * @return l(objectłȂ, ܂namenull)
+   */
+  JsonView At(const char* name) const;
+
+  /**
+   * objectnameɑΉl擾(JsonKey)
+   * @param[in] name name
+   * @return l(objectłȂ, ܂namenull)
+   */
+  JsonView At(const JsonKey& name) const;
+
+  /**
+   * objectname邩ǂ
+   * @param[in] name name
+   * @return true(lnullłtrue)
+   */
+  bool Contains(const std::string& name) const;
+};
+}
+#endif // ANALYSISDRIVE_JSONVIEW_H_
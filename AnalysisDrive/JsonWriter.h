@@ -0,0 +1,243 @@
+/**
+ * @file   JsonWriter.h
+ * @brief  JSON`̏̕o
+ * @author kyo
+ * @date   2026/10/17
+ */
+#ifndef ANALYSISDRIVE_JSONWRITER_H_
+#define ANALYSISDRIVE_JSONWRITER_H_
+
+#include "Json.h"
+#include "JsonHandler.h"
+#include "JsonSink.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/** Analysis Drive */
+namespace adlib
+{
+/**
+ * JSON`̏̕o
+ * @remarks ̃obt@ɕ쐬, obt@tɂȂ_ł܂Ƃ߂ďo͐(JsonSink)ɓn. <br>
+ *          WriteŒlŜo͂ق, JsonHandler̃Cxg(StartObject, Key, ...)ɌĂŏo͂ł
+ *          (JsonParser::ParseEvents̃nhɓn, ͂𐮌`ɏo͂). <br>
+ *          stringobjectname, '"', '\\'Ɛ䕶GXP[vďo͂.
+ * @note obt@Ɏco͂, Flush܂̓fXgN^ŏo͐ɓn
+ */
+class JsonWriter final : public JsonHandler
+{
+private:
+  //> obt@TCY̏l(byte)
+  static const size_t DEFAULT_BUFFER_SIZE;
+  //> 1̐l̏o͂ɕKvȍőTCY(byte)
+  static const size_t NUMBER_BUFFER_SIZE;
+  //> G[bZ[W --- o͐ɏ߂Ȃ
+  static const std::string ERR_MSG_WRITE_FAILURE;
+
+  //! o͐
+  JsonSink* m_sink;
+  //! obt@
+  std::vector<char> m_buffer;
+  //! obt@̎gpTCY(byte)
+  size_t m_used;
+  //! o͒array, object̗vf̃X^bN(Cxgɂo͗p)
+  std::vector<size_t> m_counts;
+  //! objectnameo͂łtrue(Cxgɂo͗p)
+  bool m_afterKey;
+  //! G[bZ[W(ł΋)
+  std::string m_errorMsg;
+
+private:
+  /* Rs[֎~ */
+  JsonWriter(const JsonWriter&);
+  /* ֎~ */
+  void operator=(const JsonWriter&);
+
+  /** obt@̓eo͐ɓn */
+  void FlushBuffer();
+
+  /**
+   * obt@̋󂫂mۂ
+   * @param[in] size KvȃTCY(byte. obt@TCYȉ)
+   * @return ݈ʒu
+   */
+  char* Reserve(size_t size);
+
+  /**
+   * 1o͂
+   * @param[in] c 
+   */
+  void Put(char c);
+
+  /**
+   * ̂܂܏o͂
+   * @param[in] data ̐擪
+   * @param[in] size ̃TCY(byte)
+   */
+  void Put(const char* data, size_t size);
+
+  /**
+   * o͂
+   * @param[in] value l
+   */
+  void PutInt64(std::int64_t value);
+
+  /**
+   * _o͂
+   * @param[in] value l
+   * @remarks ̒lɖ߂ŒZ10iŏo͂(FormatDouble). NaN, nullo͂
+   */
+  void PutDouble(double value);
+
+  /**
+   * GXP[v'"'ň͂ŏo͂
+   * @param[in] data ̐擪
+   * @param[in] size ̃TCY(byte)
+   */
+  void PutString(const char* data, size_t size);
+
+  /**
+   * lo͂(vf, oǂ)
+   * @param[in] json l
+   */
+  void PutValue(const Json& json);
+
+  /** Cxgɂl̏o͂̑O(Kvł','o͂) */
+  void BeginValue();
+
+public:
+  /**
+   * RXgN^
+   * @param[in,out] sink       o͐
+   * @param[in]     bufferSize obt@TCY(byte)
+   */
+  explicit JsonWriter(JsonSink* sink, size_t bufferSize = JsonWriter::DEFAULT_BUFFER_SIZE);
+
+  /** fXgN^(obt@Ɏco͂o͐ɓn) */
+  ~JsonWriter();
+
+  /**
+   * lŜo͂
+   * @param[in] json l
+   * @return ɏo͂łtrue
+   * @remarks ÄɕێĂarray, vfƂJsonIuWFNg쐬ɏo͂
+   */
+  bool Write(const Json& json);
+
+  /**
+   * obt@̓eo͐ɓn, o͐ɔf
+   * @return ɏo͂łtrue
+   */
+  bool Flush();
+
+  /**
+   * G[bZ[W擾
+   * @return G[bZ[W(ł΋)
+   */
+  const std::string& ErrorMessage() const;
+
+  /**
+   * nullo͂
+   * @return ɏo͂łtrue
+   */
+  bool Null() override;
+
+  /**
+   * boollo͂
+   * @param[in] value l
+   * @return ɏo͂łtrue
+   */
+  bool Bool(bool value) override;
+
+  /**
+   * numberl(int)o͂
+   * @param[in] value l
+   * @return ɏo͂łtrue
+   */
+  bool Int(int value) override;
+
+  /**
+   * numberl(int64)o͂
+   * @param[in] value l
+   * @return ɏo͂łtrue
+   */
+  bool Int64(std::int64_t value) override;
+
+  /**
+   * numberl(double)o͂
+   * @param[in] value l
+   * @return ɏo͂łtrue
+   */
+  bool Double(double value) override;
+
+  /**
+   * stringlo͂
+   * @param[in] value l
+   * @return ɏo͂łtrue
+   */
+  bool String(const std::string& value) override;
+
+  /**
+   * object̊Jn('{')o͂
+   * @return ɏo͂łtrue
+   */
+  bool StartObject() override;
+
+  /**
+   * objectnameo͂
+   * @param[in] name name
+   * @return ɏo͂łtrue
+   */
+  bool Key(const std::string& name) override;
+
+  /**
+   * object̏I('}')o͂
+   * @param[in] memberCount object̃o(gpȂ)
+   * @return ɏo͂łtrue
+   */
+  bool EndObject(size_t memberCount) override;
+
+  /**
+   * arraẙJn('[')o͂
+   * @return ɏo͂łtrue
+   */
+  bool StartArray() override;
+
+  /**
+   * array̏I(']')o͂
+   * @param[in] elementCount array̗vf(gpȂ)
+   * @return ɏo͂łtrue
+   */
+  bool EndArray(size_t elementCount) override;
+};
+
+/**
+ * @class   JsonWriter
+ * @section JsonWriter_exsample exsample
+ * @code
+ * #include "AnalysisDrive.h"
+ * #include <cstdio>
+ *
+ * int main()
+ * {
+ *   std::FILE* file = std::fopen("result.json", "wb");
+ *   adlib::JsonFileSink sink(file);
+ *   {
+ *     adlib::JsonWriter writer(&sink);
+ *     writer.StartObject();
+ *     writer.Key("timestep");
+ *     writer.Int(100);
+ *     writer.Key("node");
+ *     writer.Write(nodes); // 쐬ς݂JsonIuWFNg
+ *     writer.EndObject(0);
+ *     if (!writer.Flush()) std::printf("%s\n", writer.ErrorMessage().c_str());
+ *   }
+ *   std::fclose(file);
+ *   return 0;
+ * }
+ * @endcode
+ */
+}
+#endif // ANALYSISDRIVE_JSONWRITER_H_
@@ -7,6 +7,8 @@
 #ifndef ANALYSISDRIVE_MSGPACKPARSER_H_
 #define ANALYSISDRIVE_MSGPACKPARSER_H_
 
+#include "JsonBind.h"
+#include <iosfwd>
 #include <memory>
 #include <string>
 #include <vector>
@@ -16,6 +18,7 @@ namespace adlib
 {
 // O錾
 class Json;
+class JsonHandler;
 
 /**
  * MessagePackp[T[
@@ -33,6 +36,14 @@ private:
   /* ֎~ */
   void operator=(const MsgpackParser&);
 
+  /**
+   * MessagePack`̕p[X, i[ɒڊi[
+   * @param[in] target p[XΏۂ̕
+   * @param[in] value  i[
+   * @return Ō܂Ŋi[łtrue
+   */
+  bool ParseIntoTarget(const std::string& target, const JsonBindTarget& value);
+
 public:
   /** RXgN^ */
   MsgpackParser();
@@ -47,6 +58,98 @@ public:
    */
   Json Parse(const std::string& target);
 
+  /**
+   * MessagePack`̕p[X, ǂݍ񂾒lnhɒʒm
+   * @param[in]     target  p[XΏۂ̕
+   * @param[in,out] handler Cxg̒ʒm
+   * @return Ō܂Ńp[Xłtrue(G[, ܂̓nhɂ钆f̏ꍇfalse)
+   * @remarks JsonIuWFNg쐬, l̏handler̊֐Ă(ʒmlParsěʂƓ). <br>
+   *          string^͓͂QƂăfVACY. mapnamȅd͊mFȂ. <br>
+   *          nhɂ钆f̓G[ƂȂ(ErrorMessage()͋̂܂).
+   * @attention ܂ł̃G[bZ[W⃏[jObZ[W
+   */
+  bool ParseEvents(const std::string& target, JsonHandler* handler);
+
+  /**
+   * MessagePack`̕p[X, \̂Ȃǂɒڊi[
+   * @tparam T i[̌^(Bindꉻ\, ܂JsonBindTraitsɑΉ^)
+   * @param[in]  target p[XΏۂ̕
+   * @param[out] value  i[
+   * @return Ō܂Ŋi[łtrue
+   * @remarks JsonIuWFNg쐬, Bind̑Ήtɏ]Ċi[. <br>
+   *          ƃG[bZ[WJsonParser::ParseIntoƓ.
+   * @attention ܂ł̃G[bZ[W⃏[jObZ[W
+   */
+  template <class T>
+  bool ParseInto(const std::string& target, T* value)
+  {
+    return this->ParseIntoTarget(target, JsonBindTarget(value));
+  }
+
+  /**
+   * Xg[̓ǂݍ݂Jn
+   * @param[in,out] stream ̓Xg[(MessagePack`̃R[hA)
+   * @remarks ȍ~, ParseNext1R[hp[X. <br>
+   *          Xg[͈TCYǂݍނ, gp郁͍ő̃R[h̃TCYxɎ܂.
+   * @attention streamParseNextfalseԂ܂ŗLł邱. <br>
+   *            ܂ł̃G[bZ[W⃏[jObZ[W
+   *            (ȍ~̓Xg[ǂݏI܂Œ~ς).
+   */
+  void StartStream(std::istream* stream);
+
+  /**
+   * Xg[玟̃R[hp[X
+   * @param[out] record i[
+   * @return R[hp[Xłtrue(Xg[̍Ō, ܂̓G[̏ꍇfalse)
+   * @remarks G[̏ꍇErrorMessageɃbZ[Wi[. <br>
+   *          A[i[hł, R[hƂɕʂ̃A[igp
+   *          (ÕR[hSĔjĂ, ̃A[iėp).
+   */
+  bool ParseNext(Json* record);
+
+  /**
+   * Qƃ[hݒ肷
+   * @param[in] stringViewMode trueł, ȍ~ParsestringlRs[ɓ͂QƂ
+   * @remarks stringl̃Rs[GetString̏Ăяo܂Œx点(GetStringViewł΃Rs[Ȃ). <br>
+   *          mapname͏ɃRs[. ParseNextł̓obt@ėp邽, {[h͎gpȂ.
+   * @attention Parse̓͂, p[X(Ƃ̃Rs[)SĔj܂ŗLł邱
+   */
+  void SetStringViewMode(bool stringViewMode);
+
+  /**
+   * Qƃ[hǂ
+   * @return Qƃ[hłtrue
+   */
+  bool IsStringViewMode() const;
+
+  /**
+   * A[i[hݒ肷
+   * @param[in] arenaMode trueł, ȍ~ParseőSĂ̒l1̃A[imۂ
+   * @remarks A[i̓p[T[ƃp[Xʂ̍ŏʂ̒l(Ƃ̃Rs[)L, SĔjꂽ_ł܂Ƃ߂ĉ
+   *          (lƂɂ̓A[iQƂȂ). <br>
+   *          ʂ̒lf[^p[Xꍇ, mۂƉ̉񐔂啝ɍ팸ł. <br>
+   *          ̃p[X̎_őÕp[XʂSĔjĂ, A[i͉ɍėp.
+   * @attention A[i̓XbhZ[tł͂Ȃ, p[Xʂarrayobjectւ̗vf̒ǉ
+   *            1̃Xbhs. <br>
+   *            p[Xʂ̗vf, ô݂ێꍇ, ŏʂ̒lێ邱
+   *            (ŏʂ̒lSĔj, ̃p[XŃA[iėp)
+   */
+  void SetArenaMode(bool arenaMode);
+
+  /**
+   * A[i[hǂ
+   * @return A[i[hłtrue
+   */
+  bool IsArenaMode() const;
+
+  /**
+   * ێĂobt@ƃA[i
+   * @remarks p[T[̓fVACYp̗̈(ƃA[i)̗eʂێ܂, ̃p[Xōėp. <br>
+   *          傫ȃf[^p[X, ΂炭p[XȂꍇȂǂɌĂ.
+   * @attention ܂ł̃G[bZ[W⃏[jObZ[W
+   */
+  void ReleaseBuffers();
+
   /**
    * G[bZ[W擾
    * @return G[bZ[W̃Rei(ł΃TCY0)
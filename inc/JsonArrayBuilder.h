@@ -0,0 +1,122 @@
+/**
+ * @file   JsonArrayBuilder.h
+ * @brief  p[Xarray̍쐬
+ * @author kyo
+ * @date   2026/10/17
+ */
+#ifndef ANALYSISDRIVE_JSONARRAYBUILDER_H_
+#define ANALYSISDRIVE_JSONARRAYBUILDER_H_
+
+#include "Json.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/** Analysis Drive */
+namespace adlib
+{
+/**
+ * p[Xarray̍쐬
+ * @remarks vfSnumber(double), ܂͑Snumber(int, int64)łԂ͘Äɒǉ,
+ *          ȊO̗vf_JsonIuWFNgarrayɐ؂ւ. <br>
+ *          쐬array͌^tarray(Json::IsDoubleArray, Json::IsInt64Array)ɂȂ. <br>
+ *          vf̓p[T[Ƃ̍Ɨ̈(Stack)ɐςł, Buildŗvf傤ǂarrayɈڂ
+ *          (Lr̗̈A[iɎcȂ).
+ */
+class JsonArrayBuilder final
+{
+public:
+  /**
+   * 쐬rarray̗vfςލƗ̈
+   * @remarks 쐬rarray͓qɂȂ邽, ɍłarray̗vfς܂. <br>
+   *          eʂ͕ێ܂܍ėp(q[vmۂ).
+   */
+  struct Stack
+  {
+    std::vector<Json> values;         //!< vf(JsonIuWFNg)
+    std::vector<double> doubles;      //!< vf(double̘Ä)
+    std::vector<std::int64_t> int64s; //!< vf(int64̘Ä)
+
+    /** ςłvfSĔj(eʂ͕ێ) */
+    void Clear();
+  };
+
+private:
+  //> ǉ̗vf̕ێ`
+  enum STATE
+  {
+    STATE_EMPTY,  /*!< vfȂ                           */
+    STATE_DOUBLE, /*!< double̘Ä(Stack::doubles)   */
+    STATE_INT64,  /*!< int64̘Ä(Stack::int64s)     */
+    STATE_JSON    /*!< JsonIuWFNg(Stack::values)    */
+  };
+
+  //! ǉ̗vf̕ێ`
+  STATE m_state;
+  //! \񂷂vf(ێ`܂_Ŋmۂ)
+  size_t m_reserve;
+  //! 쐬arraẙmۂɎgpAP[^
+  Json::Allocator m_allocator;
+  //! vfςލƗ̈
+  Stack* m_stack;
+  //! Ɨ̈ł̐擪̗vf̈ʒu
+  size_t m_begin;
+
+private:
+  /** JsonIuWFNgarrayɐ؂ւ(Ä̗vfڂ) */
+  void ToJsonArray();
+
+  /**
+   * ێ`߂, Ɨ̈ł̐擪̈ʒuL^
+   * @param[in] state ێ`
+   */
+  void Start(STATE state);
+
+public:
+  /**
+   * RXgN^
+   * @attention Ɨ̈Ȃ, Ɨ̈w肵IuWFNgĂgp邱
+   */
+  JsonArrayBuilder();
+
+  /**
+   * RXgN^
+   * @param[in] alloc 쐬arraẙmۂɎgpAP[^
+   * @param[in] stack vfςލƗ̈
+   * @attention Ɨ̈gparray, ォvfǉn߂̂珇ɍ쐬邱
+   *            (rŔjꍇ, Ɨ̈Clear܂œƗ̈őarray쐬Ȃ)
+   */
+  JsonArrayBuilder(const Json::Allocator& alloc, Stack* stack);
+
+  /**
+   * vf\񂷂
+   * @param[in] n vf
+   */
+  void Reserve(size_t n);
+
+  /**
+   * ɗvfǉ
+   * @param[in] value vf([u)
+   */
+  void Append(Json&& value);
+
+  /**
+   * ɕʂarray̗vfSĒǉ
+   * @param[in,out] array ǉarray^JsonIuWFNg(vf[u)
+   */
+  void AppendElements(Json* array);
+
+  /**
+   * vf擾
+   * @return vf
+   */
+  size_t Size() const;
+
+  /**
+   * array쐬
+   * @return array^JsonIuWFNg(vf͈ڂ, {IuWFNg͋ɂȂ)
+   */
+  Json Build();
+};
+}
+#endif // ANALYSISDRIVE_JSONARRAYBUILDER_H_
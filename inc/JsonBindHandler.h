@@ -0,0 +1,119 @@
+/**
+ * @file   JsonBindHandler.h
+ * @brief  p[XCxg\̂Ɋi[nh
+ * @author kyo
+ * @date   2026/10/17
+ */
+#ifndef ANALYSISDRIVE_JSONBINDHANDLER_H_
+#define ANALYSISDRIVE_JSONBINDHANDLER_H_
+
+#include "JsonBind.h"
+#include "JsonHandler.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/** Analysis Drive */
+namespace adlib
+{
+/**
+ * p[XCxg\̂Ɋi[nh
+ * @remarks JsonParser::ParseInto, MsgpackParser::ParseIntoŎgp. <br>
+ *          Bindɖname̒l(lXgarray, object܂߂)ǂݔ΂. null͊i[ɏl̂܂܂Ƃ. <br>
+ *          ^vȂꍇ̓G[bZ[Wi[ăp[X𒆒f.
+ */
+class JsonBindHandler final : public JsonHandler
+{
+private:
+  //> G[bZ[Wi[obt@TCY
+  static const size_t BUFFER_SIZE;
+  //> G[bZ[W --- ľ^i[̌^ƈvȂ
+  static const std::string ERR_MSG_TYPE_MISMATCH;
+  //> G[bZ[W --- number^i[̌^͈̔͊O̒l
+  static const std::string ERR_MSG_OUT_OF_RANGE;
+
+  //> i[array, object
+  struct Frame
+  {
+    void* target;           //!< i[
+    const JsonBindOps* ops; //!< i[
+    bool isArray;           //!< arrayłtrue
+    const char* name;       //!< i[̃oname(object̂)
+    size_t count;           //!< ǉvf(arraŷ)
+  };
+
+  //> ŏʂ̊i[
+  JsonBindTarget m_root;
+  //> i[array, object̃X^bN
+  std::vector<Frame> m_stack;
+  //> ̒l̊i[(objectnameǂݍ񂾎_Őݒ肷. nullptrłΓǂݔ΂)
+  void* m_fieldTarget;
+  //> ̒l̊i[
+  const JsonBindOps* m_fieldOps;
+  //> ǂݔ΂array, object̃lXg̐[(0łΓǂݔ΂ĂȂ)
+  size_t m_skipDepth;
+  //> G[bZ[W(ł΋)
+  std::string m_errorMsg;
+
+private:
+  /* Rs[֎~ */
+  JsonBindHandler(const JsonBindHandler&);
+  /* ֎~ */
+  void operator=(const JsonBindHandler&);
+
+  /**
+   * ̒l̊i[擾
+   * @param[out] ops i[
+   * @return i[(ǂݔ΂ꍇnullptr)
+   * @remarks array̗vf̏ꍇ, ŗvfǉ
+   */
+  void* NextTarget(const JsonBindOps** ops);
+
+  /**
+   * i[̒l̃pX쐬
+   * @return pX(u$.node[3].coordv̌`)
+   */
+  std::string MakePath() const;
+
+  /**
+   * G[bZ[Wi[
+   * @param[in] messageTemp G[bZ[W
+   * @param[in] typeName    i[̌^̖O
+   * @return false(p[X𒆒f)
+   */
+  bool SetError(const std::string& messageTemp, const char* typeName);
+
+public:
+  /**
+   * RXgN^
+   * @param[in] root ŏʂ̊i[
+   */
+  explicit JsonBindHandler(const JsonBindTarget& root);
+
+  /** fXgN^ */
+  ~JsonBindHandler();
+
+  bool Null() override;
+  bool Bool(bool value) override;
+  bool Int(int value) override;
+  bool Int64(std::int64_t value) override;
+  bool Double(double value) override;
+  bool String(const std::string& value) override;
+  bool StartObject() override;
+  bool Key(const std::string& name) override;
+  bool EndObject(size_t memberCount) override;
+  bool StartArray() override;
+  bool EndArray(size_t elementCount) override;
+
+  /**
+   * G[bZ[W擾
+   * @return G[bZ[W(ł΋)
+   */
+  const std::string& ErrorMessage() const
+  {
+    return m_errorMsg;
+  }
+};
+}
+#endif // ANALYSISDRIVE_JSONBINDHANDLER_H_
@@ -0,0 +1,64 @@
+/**
+ * @file   JsonKeyTable.h
+ * @brief  JSONobjectnamẽC^[e[u
+ * @author kyo
+ * @date   2026/10/17
+ */
+#ifndef ANALYSISDRIVE_JSONKEYTABLE_H_
+#define ANALYSISDRIVE_JSONKEYTABLE_H_
+
+#include "JsonKey.h"
+#include <cstddef>
+#include <vector>
+
+/** Analysis Drive */
+namespace adlib
+{
+/**
+ * JSONobjectnamẽC^[e[u
+ * @remarks 1̃̕p[Xɏonameێ, nameɂ͓̂JsonKeyԂ. <br>
+ *          ̓obt@̕񂩂璼ڌ邽, o^ς݂namẽ͕Rs[쐬Ȃ. <br>
+ *          I[vAhX@̃nbVe[u, eʂ͎̃̕p[Xōėp.
+ */
+class JsonKeyTable final
+{
+private:
+  //! nbVe[ȕTCY(2ׂ̂)
+  static const size_t INITIAL_SLOTS;
+  //! o^name̍ő吔(͓o^JsonKey쐬)
+  static const size_t MAX_KEYS;
+
+  //! o^name(o^)
+  std::vector<JsonKey> m_keys;
+  //! nbVe[u(m_keys̓Y+1, 0ł΋)
+  std::vector<size_t> m_slots;
+
+private:
+  /** Rs[֎~ */
+  JsonKeyTable(const JsonKeyTable&);
+  /** ֎~ */
+  void operator=(const JsonKeyTable&);
+
+  /** nbVe[ug */
+  void Grow();
+
+public:
+  /** RXgN^ */
+  JsonKeyTable() {}
+
+  /**
+   * name擾(Γo^)
+   * @param[in] data ̐擪
+   * @param[in] size ̃TCY(byte)
+   * @return name(o^ς݂łΓ̂L)
+   */
+  JsonKey Intern(const char* data, size_t size);
+
+  /**
+   * o^nameSč폜
+   * @remarks nbVe[u̗eʂ͕ێ
+   */
+  void Clear();
+};
+}
+#endif // ANALYSISDRIVE_JSONKEYTABLE_H_
@@ -0,0 +1,47 @@
+/**
+ * @file   JsonNumber.h
+ * @brief  JSON̐lϊ
+ * @author kyo
+ * @date   2026/10/17
+ */
+#ifndef ANALYSISDRIVE_JSONNUMBER_H_
+#define ANALYSISDRIVE_JSONNUMBER_H_
+
+#include <cstddef>
+#include <cstdint>
+
+/** Analysis Drive */
+namespace adlib
+{
+/**
+ * JSON̐lϊ
+ * @remarks 10ỉƎwdouble^̒l𐳊m(ŋߐڋۂ߂)߂. <br>
+ *          P[Ɉˑ, OgpȂ.
+ */
+class JsonNumber final
+{
+private:
+  /** CX^X֎~ */
+  JsonNumber();
+
+public:
+  //> ƂĐmɕێł10i̍ő包
+  static const int MAX_MANTISSA_DIGITS = 19;
+
+  /**
+   * Ǝwdouble^̒l߂
+   * @param[in]  negative łtrue
+   * @param[in]  mantissa 10ỉ(擪19܂)
+   * @param[in]  exp10    10i̎w
+   * @param[in]  truncated 20ڈȍ~؂̂ĂĂtrue
+   * @param[in]  text     ϊO̕(ɌłȂꍇɎgp)
+   * @param[in]  textSize ϊÕ̕TCY
+   * @param[out] value    i[(͈͊Ȍꍇ́}, ܂0)
+   * @remarks قƂǂ̒lClinger̕@, ܂Eisel-Lemire̕@Ō肷. <br>
+   *          łȂꍇ̂textstrtodŕϊ(_̓P[ɍ킹Ēu).
+   */
+  static void ToDouble(bool negative, std::uint64_t mantissa, int exp10, bool truncated,
+    const char* text, size_t textSize, double* value);
+};
+}
+#endif // ANALYSISDRIVE_JSONNUMBER_H_
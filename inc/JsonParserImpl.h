@@ -0,0 +1,547 @@
+/**
+ * @file   JsonParserImpl.h
+ * @brief  JSONp[T[̎
+ * @author kyo
+ * @date   2026/10/17
+ */
+#ifndef ANALYSISDRIVE_JSONPARSERIMPL_H_
+#define ANALYSISDRIVE_JSONPARSERIMPL_H_
+
+#include "JsonParser.h"
+#include "Json.h"
+#include "JsonArena.h"
+#include "JsonArrayBuilder.h"
+#include "JsonKey.h"
+#include "JsonKeyTable.h"
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <vector>
+#include <string>
+
+/** Analysis Drive */
+namespace adlib
+{
+// O錾
+class JsonHandler;
+class JsonStructuralIndex;
+
+//> PimplCfBI
+class JsonParser::Impl
+{
+public:
+  //> ^[R[h
+  enum RETURN_CODE
+  {
+    SUCCESS, /*!<  */
+    FAILURE  /*!< s */
+  };
+
+  //> nhɂ钆f(OƂē)
+  struct StopParsing {};
+
+  //> ͂̏
+  enum FEED_STATE
+  {
+    FEED_BOM,            /*!< 擪BOMmF               */
+    FEED_TOP_VALUE,      /*!< ŏʂvaluȇO               */
+    FEED_OBJECT_FIRST,   /*!< object'{'̒             */
+    FEED_OBJECT_NAME,    /*!< object','̒             */
+    FEED_OBJECT_COLON,   /*!< objectname̒            */
+    FEED_OBJECT_VALUE,   /*!< object':'̒             */
+    FEED_ARRAY_FIRST,    /*!< array'['̒              */
+    FEED_ARRAY_VALUE,    /*!< array','̒              */
+    FEED_AFTER_VALUE,    /*!< array, objectvalue̒    */
+    FEED_STRING,         /*!< string^̓r                  */
+    FEED_STRING_ESCAPE,  /*!< string^̃GXP[v̒  */
+    FEED_STRING_UNICODE, /*!< string^̃GXP[vV[PX */
+    FEED_NUMBER,         /*!< number^̓r                  */
+    FEED_LITERAL,        /*!< true, false, null̓r         */
+    FEED_DONE,           /*!< ŏʂvalueǂݏI       */
+    FEED_FAILED          /*!< G[                          */
+  };
+
+  //> \CfbNXJSON̕@vȂ(OƂē, ċA~Ńp[X)
+  struct IndexMismatch {};
+
+  //> ͒array, object
+  struct FeedFrame
+  {
+    Json value;             //!< p[Xrobject(array̏ꍇnull)
+    Json* slot;             //!< object̏ꍇ, l҂Ăname̊i[
+    JsonArrayBuilder array; //!< array̏ꍇ, p[Xr̗vf
+  };
+
+  //> \CfbNXJsonIuWFNg쐬rarray, object
+  struct IndexFrame
+  {
+    Json value;             //!< 쐬robject(array̏ꍇnull)
+    Json::Object* object;   //!< object̏ꍇ, valueobjectl(array̏ꍇnullptr)
+    Json* slot;             //!< object̏ꍇ, l҂Ăname̊i[
+    JsonArrayBuilder array; //!< array̏ꍇ, 쐬r̗vf
+  };
+
+  //> UNICODEGXP[vV[PX4BYTË
+  static const size_t ESCAPE_SEQUENCE_4BYTE;
+  //> 16ï
+  static const int HEXADECIMAL_16;
+  //> UTF8BOMTCY
+  static const int BOM_UTF8_SIZE;
+  //> UTF8BOM
+  static const char BOM_UTF8[];
+  //> G[bZ[Wi[obt@TCY
+  static const size_t BUFFER_SIZE;
+  //> Xg[xɓǂݍރTCY
+  static const size_t STREAM_BUFFER_SIZE;
+  //> XbhŃp[Xarray̍ŏTCY(byte)
+  static const size_t PARALLEL_MIN_SIZE;
+  //> XbhŃp[Xarray̍ő̃lXg̐[(0ł΍ŏʂarraŷ)
+  static const size_t PARALLEL_MAX_DEPTH;
+  //> array̕ʒǔ̍ŏԊu(byte)
+  static const size_t PARALLEL_SPLIT_INTERVAL;
+  //> 1Xbh̕
+  static const size_t PARALLEL_CHUNKS_PER_THREAD;
+  //> ؃G[̃L[[hƂĕێőTCY
+  static const size_t MAX_ERROR_KEYWORD_SIZE;
+  //> number^̎w̑ł~ߒl(ȏ͔͈͊Om肷)
+  static const int MAX_EXPONENT;
+  //> G[bZ[W --- JSOÑp[Xs
+  static const std::string ERR_MSG_PARSE_FAILURE;
+  //> G[bZ[W --- 0ړnumber^
+  static const std::string ERR_MSG_0HEAD_NUMBER;
+  //> G[bZ[W --- number^ɖȕ܂܂Ă
+  static const std::string ERR_MSG_BAD_WORD_IN_NUMBER;
+  //> G[bZ[W --- number^(int^)͈͊O̒l
+  static const std::string ERR_MSG_INT_NUMBER_OUT_OF_RANGE;
+  //> G[bZ[W --- number^(double^)͈͊O̒l
+  static const std::string ERR_MSG_DOUBLE_NUMBER_OUT_OF_RANGE;
+  //> G[bZ[W --- '.'̌㑱ɐl
+  static const std::string ERR_MSG_NOT_DIGIT_FOLLOWER_DOT;
+  //> G[bZ[W --- 'e', 'E'̌㑱ɐl
+  static const std::string ERR_MSG_NOT_DIGIT_FOLLOWER_EXP;
+  //> G[bZ[W --- '"'Ȃ
+  static const std::string ERR_MSG_NOT_EXIST_DOUBLE_QUOTATION;
+  //> G[bZ[W --- sȃGXP[v
+  static const std::string ERR_MSG_ESCAPE_CHARACTER_FAILURE;
+  //> G[bZ[W --- TQ[g̈UNICODE
+  static const std::string ERR_MSG_EXIST_CODE_IN_SURROGATE;
+  //> G[bZ[W --- object'}'Ȃ
+  static const std::string ERR_MSG_NOT_EXIST_BRACKET_IN_OBJ;
+  //> G[bZ[W --- object2ڈȍ~̒l̑O','Ȃ
+  static const std::string ERR_MSG_NOT_EXIST_COMMA_IN_OBJ;
+  //> G[bZ[W --- objectɕJn'"'Ȃ
+  static const std::string ERR_MSG_NOT_EXIST_DOUBLE_QUOTATION_IN_OBJ;
+  //> G[bZ[W --- object':'Ȃ
+  static const std::string ERR_MSG_NOT_EXIST_COLON_IN_OBJ;
+  //> G[bZ[W --- array']'Ȃ
+  static const std::string ERR_MSG_NOT_EXIST_BRACKET_IN_ARRAY;
+  //> G[bZ[W --- array2ڈȍ~̒l̑O','Ȃ
+  static const std::string ERR_MSG_NOT_EXIST_COMMA_IN_ARRAY;
+  //> G[bZ[W --- sȒl
+  static const std::string ERR_MSG_VALUE_FAILURE;
+  //> G[bZ[W --- t@CJȂ
+  static const std::string ERR_MSG_FILE_OPEN_FAILURE;
+  //> [jObZ[W --- objectnamedĂ
+  static const std::string WRN_MSG_NAME_REPEATED;
+
+  //> G[bZ[WRei
+  std::vector<std::string> m_errorMsg;
+  //> [jObZ[WRei
+  std::vector<std::string> m_warningMsg;
+  //> objectnamedtO
+  bool m_nameRepeated;
+  //> p[XΏۂ̕(I[͕sv)
+  const char* m_target;
+  //> p[XΏۂ̃̕TCY
+  size_t m_targetSize;
+  //> p[XΏۂ̃̕J[\(ɓǂݍƂʒu)
+  size_t m_i;
+  //> A[i[h(trueł1̃A[iSĂ̒lmۂ)
+  bool m_arenaMode;
+  //> lmۂA[i(A[igpȂnullptr. p[Xʂ̍ŏʂ̒lL)
+  std::shared_ptr<JsonArena> m_arena;
+  //> JsonIuWFNg̊mۂɎgpAP[^
+  Json::Allocator m_allocator;
+  //> 쐬rarray̗vfςލƗ̈(eʂێ܂܍ėp)
+  JsonArrayBuilder::Stack m_arrayStack;
+  //> Qƃ[h(trueł΃GXP[v܂܂Ȃstringl͓̓obt@QƂ)
+  bool m_stringViewMode;
+  //> ؃G[̃G[R[h
+  ERROR_CODE m_errorCode;
+  //> ؃G[oʒu
+  size_t m_errorOffset;
+  //> ؃G[̃bZ[WɖߍރL[[h(ϊO̕)
+  std::string m_errorKeyWord;
+  //> p[XɎgpXbh(1łΌĂяõXbĥ)
+  size_t m_threadCount;
+  //> p[Xarray, object̃lXg̐[
+  size_t m_depth;
+  //> Cxgʒmpstringobt@(stringlƂɍėp)
+  std::string m_stringBuffer;
+  //> objectnamẽC^[e[u(p[XƂɋɂ)
+  JsonKeyTable m_keys;
+  //> GXP[v܂objectnameϊobt@(nameƂɍėp)
+  std::string m_nameBuffer;
+  //> ͒łtrue(FeedŊJn, FinishŏI)
+  bool m_feeding;
+  //> ͂̏
+  FEED_STATE m_feedState;
+  //> ͒array, object(ł. ǉŗvfڂȂ悤dequeɂ)
+  std::deque<FeedFrame> m_feedStack;
+  //> ͒stringlobjectnamełtrue(stringlm_stringBufferɂ߂)
+  bool m_feedStringIsName;
+  //> ͒̃g[N(BOM, number^, true/false/null, GXP[vV[PX)
+  std::string m_feedToken;
+  //> ͒̃e("true", "false", "null")
+  const char* m_feedLiteral;
+  //> ͂̃p[X
+  Json m_feedResult;
+  //> \CfbNXJsonIuWFNg쐬rarray, object(ł. ǉŗvfڂȂ悤dequeɂ)
+  std::deque<IndexFrame> m_indexStack;
+  //> ؒɊJĂarray, object('['܂'{', ł)
+  std::vector<char> m_validateStack;
+
+  /**
+   * RXgN^
+   * @param[in] target     p[XΏۂ̕
+   * @param[in] targetSize p[XΏۂ̃̕TCY
+   * @param[in] arenaMode  A[i[h
+   * @param[in] stringViewMode Qƃ[h
+   * @param[in] threadCount    p[XɎgpXbh
+   */
+  Impl(const char* target, size_t targetSize, bool arenaMode, bool stringViewMode, size_t threadCount)
+    :m_nameRepeated(false),
+     m_target(target),
+     m_targetSize(targetSize),
+     m_i(0),
+     m_arenaMode(arenaMode),
+     m_arena(arenaMode ? JsonArena::CreateShared() : nullptr),
+     m_allocator(m_arena.get()),
+     m_stringViewMode(stringViewMode),
+     m_errorCode(ERR_NONE),
+     m_errorOffset(0),
+     m_threadCount(threadCount),
+     m_depth(0),
+     m_feeding(false),
+     m_feedState(FEED_BOM),
+     m_feedStringIsName(false),
+     m_feedLiteral(nullptr)
+  {
+  }
+
+  /**
+   * ̃p[X̂߂ɏԂ
+   * @param[in] target     p[XΏۂ̕
+   * @param[in] targetSize p[XΏۂ̃̕TCY
+   * @remarks obt@͗eʂێ܂܍ėp. <br>
+   *          A[i[hł, Õp[XʂSĔjĂ΃A[iėp.
+   */
+  void Reset(const char* target, size_t targetSize);
+
+  /**
+   * G[bZ[W쐬
+   * @param[in] messageTemp G[bZ[W
+   * @param[in] keyWord     bZ[WɖߍރL[[h
+   * @return G[bZ[W
+   * @remarks messageTemṕu%sv̉ӏkeyWord𖄂ߍŕԂ
+   */
+  const std::string MakeErrorMsg(const std::string& messageTemp, const std::string& keyWord) const;
+
+  /**
+   * G[R[hG[bZ[W쐬
+   * @param[in] code    G[R[h
+   * @param[in] keyWord bZ[WɖߍރL[[h(L[[h𖄂ߍ܂ȂG[ł͎gpȂ)
+   * @return G[bZ[W
+   */
+  const std::string FormatErrorMsg(ERROR_CODE code, const std::string& keyWord) const;
+
+  /**
+   * wʒu1擾
+   * @param[in] i ʒu
+   * @return (͈͊Ȍꍇ'\0')
+   */
+  char At(size_t i) const
+  {
+    return (i < m_targetSize) ? m_target[i] : '\0';
+  }
+
+  /**
+   * 1擾(zCgXy[X̓XLbv)
+   * @param[out] word i[
+   * @return ^[R[h(擾SUCCESS)
+   * @remarks {֐I, J[\͎1w(zCgXy[X̓XLbv)
+   */
+  Impl::RETURN_CODE SkipWhitespaceAndGetWord(char* word);
+
+  /**
+   * UTF8BOM΃XLbv
+   */
+  void SkipBOM();
+
+  /**
+   * GXP[vV[PX16i4ǂݍ
+   * @param[in] hex 16i4̐擪
+   * @return l(16iłȂꍇ-1)
+   */
+  static int ReadHex4(const char* hex);
+
+  /**
+   * GXP[vV[PX𕶎ɕϊ
+   * @param[in] hex UNICODE16i
+   */
+  const std::string ConversionEscapeSequence(int hex);
+
+  /**
+   * string^ǂݍ
+   * @param[out] str i[(ɒǉ)
+   * @remarks {֐I, J[\string^̎1w
+   */
+  void ReadString(std::string* str);
+
+  /**
+   * string^p[X
+   * @remarks {֐I, J[\string^̎1w
+   */
+  Json ParseString();
+
+  /**
+   * number^ǂݍ(O𓊂Ȃ)
+   * @param[out] result i[
+   * @return G[R[h(ERR_NONE)
+   * @remarks {֐I, J[\number^̎1(G[̓G[oʒu)w. <br>
+   *          int^͈̔͊O̐int64^ɂ
+   */
+  ERROR_CODE ScanNumber(Json* result);
+
+  /**
+   * number^p[X
+   * @remarks {֐I, J[\number^̎1w
+   *          int^͈̔͊O̐int64^ɂ
+   */
+  Json ParseNumber();
+
+  /**
+   * object^p[X
+   * @remarks {֐I, J[\object^̎1w
+   */
+  Json ParseObject();
+
+  /**
+   * objectnameǂݍ
+   * @return name(C^[e[uɓo^)
+   * @remarks {֐I, J[\name̎1w. <br>
+   *          GXP[v܂܂Ȃ, ̓obt@璼ڃC^[e[u.
+   */
+  JsonKey ReadName();
+
+  /**
+   * objectnameo^
+   * @param[in,out] obj  o^
+   * @param[in]     name name([u)
+   * @return nameɑΉl̊i[
+   * @remarks namedĂꍇ̓[jObZ[Wi[, ̊i[Ԃ(̒lD悷).
+   *          namẽnbVl͓o^ς݂̂̂g, vZȂ.
+   */
+  Json* InsertName(Json::Object* obj, JsonKey&& name);
+
+  /**
+   * array^p[X
+   * @remarks {֐I, J[\array^̎1w
+   */
+  Json ParseArray();
+
+  /**
+   * 傫array^𕪊ĕXbhŃp[X
+   * @param[out] json i[
+   * @return p[Xłtrue(array, sJSONȂǂ̏ꍇfalse)
+   * @remarks truȅꍇ, {֐IJ[\array^̎1w. <br>
+   *          falsȅꍇ̓J[\ύXȂ(Ăяo1XbhŃp[X).
+   */
+  bool ParseArrayParallel(Json* json);
+
+  /**
+   * array^̗vf(','؂value)p[X
+   * @param[out] arr i[(ɒǉ)
+   * @remarks p[XΏۂ̍̕Ō܂œǂݍ(słΗO𓊂)
+   */
+  void ParseArrayElements(JsonArrayBuilder* arr);
+
+  /**
+   * l`FbN(lsȏꍇ͗O𓊂)
+   * @param[in] checkString `FbNl
+   * @remarks {֐I, J[\͒l̎1w
+   */
+  void CheckValue(const std::string& checkString);
+
+  /**
+   * lv邩mF(O𓊂Ȃ)
+   * @param[in] checkString `FbNl
+   * @return vtrue
+   * @remarks {֐I, J[\͒l̎1(sv̏ꍇ͈vȂ)w
+   */
+  bool MatchValue(const char* checkString);
+
+  /**
+   * string^؂(O𓊂Ȃ)
+   * @return G[R[h(ERR_NONE)
+   * @remarks ϊ͍쐬Ȃ. <br>
+   *          {֐I, J[\string^̎1(G[̓G[oʒu)w.
+   */
+  ERROR_CODE ValidateString();
+
+  /**
+   * objectname':'؂(O𓊂Ȃ)
+   * @return G[R[h(ERR_NONE)
+   * @remarks {֐Jn, J[\name̐擪w. {֐I, J[\':'̎1w.
+   */
+  ERROR_CODE ValidateName();
+
+  /**
+   * p[XΏۂ̕Ŝ؂(O𓊂Ȃ)
+   * @return G[R[h(ERR_NONE)
+   * @remarks JsonIuWFNg쐬, @݂̂mF(objectnamȅd͊mFȂ). <br>
+   *          G[m_errorCode, m_errorOffset, m_errorKeyWordɊi[(bZ[W͍쐬Ȃ).
+   */
+  ERROR_CODE ValidateDocument();
+
+  /**
+   * ؃G[i[
+   * @param[in] code         G[R[h
+   * @param[in] offset       G[oʒu
+   * @param[in] keyWordStart bZ[WɖߍރL[[h̊Jnʒu(L[[h̏I[̓J[\ʒu)
+   * @return G[R[h
+   */
+  ERROR_CODE SetValidateError(ERROR_CODE code, size_t offset, size_t keyWordStart);
+
+  /**
+   * ؃G[̃G[bZ[W쐬
+   * @return G[bZ[W
+   * @remarks string^̃G[ł, i[L[[h߂ēǂݍ, ParseƓbZ[Wɂ
+   */
+  const std::string FormatValidateErrorMsg() const;
+
+  /**
+   * valuep[X
+   */
+  Json ParseValue();
+
+  /**
+   * p[XΏۂ̕Ŝp[X
+   * @return JsonIuWFNg(snull^)
+   * @remarks G[bZ[Wm_errorMsgɊi[
+   */
+  Json ParseDocument();
+
+  /**
+   * p[XΏۂ̕Ŝ\CfbNXŃp[X
+   * @return JsonIuWFNg(snull^)
+   * @remarks , G[bZ[W, [jObZ[WParseDocumentƓ
+   */
+  Json ParseDocumentIndexed();
+
+  /**
+   * \CfbNXǂJsonIuWFNg쐬
+   * @return JsonIuWFNg
+   * @remarks sJSONłIndexMismatch, ܂̓G[bZ[W𓊂
+   */
+  Json ParseIndexedValues();
+
+  /**
+   * \CfbNX玟̒l, ܂͍\̈ʒu擾
+   * @param[in,out] index \CfbNX
+   * @return l, ܂͍\̐擪̕
+   * @remarks O̒l̏I肩玟̈ʒu܂ł̓zCgXy[XłȂ΂ȂȂ(Ԃ͓̕ǂݒȂ). <br>
+   *          {֐I, J[\͎擾ʒuw.
+   */
+  char NextIndexedToken(JsonStructuralIndex* index);
+
+  /**
+   * string^ȊO̒l(number^, true, false, null)ǂݍ
+   * @param[in]  word  l̐擪̕
+   * @param[out] value i[
+   * @remarks l̒オzCgXy[X, \, ̍Ō̂łȂΕsƂ. <br>
+   *          {֐I, J[\͒l̎1w
+   */
+  void ParseIndexedScalar(char word, Json* value);
+
+  /**
+   * PȌ`number^ǂݍ
+   * @param[out] number i[
+   * @return ǂݍ߂true(falsȅꍇ̓J[\ړȂ)
+   * @remarks 19ȉŎw3ȉdouble^, int^͈̔͂̐̂. ϊʂParseNumberƓɂȂ
+   */
+  bool ParseSimpleNumber(Json* number);
+
+  /**
+   * 쐬rarray, object̃t[ǉ
+   * @param[in] depth ǉʒu(JĂarray, object̐)
+   * @return t[(lnull, i[nullptr)
+   */
+  IndexFrame& PushIndexFrame(size_t depth);
+
+  /**
+   * nh̖߂lmF(falseł΃p[X𒆒f)
+   * @param[in] result nh̖߂l
+   */
+  void CheckHandlerResult(bool result)
+  {
+    if (!result) throw StopParsing();
+  }
+
+  /**
+   * object^p[XăCxgʒm
+   * @param[in,out] handler Cxg̒ʒm
+   * @remarks {֐I, J[\object^̎1w
+   */
+  void ParseObjectEvents(JsonHandler* handler);
+
+  /**
+   * array^p[XăCxgʒm
+   * @param[in,out] handler Cxg̒ʒm
+   * @remarks {֐I, J[\array^̎1w
+   */
+  void ParseArrayEvents(JsonHandler* handler);
+
+  /**
+   * valuep[XăCxgʒm
+   * @param[in,out] handler Cxg̒ʒm
+   */
+  void ParseValueEvents(JsonHandler* handler);
+
+  /**
+   * ͂ꂽp[X
+   * @param[in] data ̐擪
+   * @param[in] size ̃TCY
+   * @remarks rŏIl͏ԂƂĕێ, ̓͂őp[X
+   */
+  void FeedBytes(const char* data, size_t size);
+
+  /**
+   * ͂̏I(lrŏIĂΗO𓊂)
+   */
+  void FeedFinish();
+
+  /**
+   * ͒string^m肷
+   */
+  void FeedCompleteString();
+
+  /**
+   * ͒number^m肷
+   * @remarks number^ɑȂ܂ł߂Ăꍇ, ̕ȍ~͉߂ē͂
+   */
+  void FeedCompleteNumber();
+
+  /**
+   * ͒array, object
+   */
+  void FeedCloseContainer();
+
+  /**
+   * ͒Ɋm肵li[
+   * @param[in] value l([u)
+   */
+  void FeedCompleteValue(Json&& value);
+};
+}
+#endif // ANALYSISDRIVE_JSONPARSERIMPL_H_
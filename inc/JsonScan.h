@@ -0,0 +1,96 @@
+/**
+ * @file   JsonScan.h
+ * @brief  JSON̑(SIMD)
+ * @author kyo
+ * @date   2026/10/17
+ */
+#ifndef ANALYSISDRIVE_JSONSCAN_H_
+#define ANALYSISDRIVE_JSONSCAN_H_
+
+#include <cstddef>
+#include <cstdint>
+
+/** Analysis Drive */
+namespace adlib
+{
+/**
+ * JSON̑
+ * @remarks sCPU𔻒肵, AVX2 -> SSE2 -> XJ[̏Ŏgp\ȎI. <br>
+ *          ̊֐size𒴂ēǂݍނƂ͂Ȃ.
+ */
+class JsonScan final
+{
+private:
+  /** CX^X֎~ */
+  JsonScan();
+
+public:
+  //! ̎
+  enum SCAN_ISA
+  {
+    SCALAR, /*!< XJ[ */
+    SSE2,   /*!< SSE2      */
+    AVX2    /*!< AVX2      */
+  };
+
+  /**
+   * zCgXy[XXLbv
+   * @param[in] data ̐擪
+   * @param[in] size ̃TCY
+   * @param[in] i    ̊Jnʒu
+   * @return iȍ~ōŏ̃zCgXy[X(' ', '\\t', '\\r', '\\n')łȂʒu(size)
+   */
+  static size_t SkipWhitespace(const char* data, size_t size, size_t i);
+
+  /**
+   * '"'܂'\\'T
+   * @param[in] data ̐擪
+   * @param[in] size ̃TCY
+   * @param[in] i    ̊Jnʒu
+   * @return iȍ~ōŏ'"'܂'\\'̈ʒu(size)
+   */
+  static size_t FindQuoteOrBackslash(const char* data, size_t size, size_t i);
+
+  /**
+   * JSONo͎ɃGXP[vKvȕT
+   * @param[in] data ̐擪
+   * @param[in] size ̃TCY
+   * @param[in] i    ̊Jnʒu
+   * @return iȍ~ōŏ'"', '\\', 䕶(0x00`0x1F)̈ʒu(size)
+   */
+  static size_t FindEscapeCharacter(const char* data, size_t size, size_t i);
+
+  //! 64bytẽubN𕶎̎ނƂɃrbg}XN(bit iiڂɑΉ)
+  struct BlockMasks
+  {
+    std::uint64_t quote;      //!< '"'
+    std::uint64_t backslash;  //!< '\\'
+    std::uint64_t whitespace; //!< ' ', '\\t', '\\r', '\\n'
+    std::uint64_t op;         //!< '{', '}', '[', ']', ':', ','
+  };
+
+  //! ClassifyBlockňubÑTCY(byte)
+  static const size_t BLOCK_SIZE = 64;
+
+  /**
+   * 64bytẽubN𕶎̎ނƂɃrbg}XN
+   * @param[in]  block ubN̐擪(BLOCK_SIZEǂݍ߂邱)
+   * @param[out] masks i[
+   */
+  static void ClassifyBlock(const char* block, BlockMasks* masks);
+
+  /**
+   * gpĂ擾
+   * @return ̎
+   */
+  static SCAN_ISA Isa();
+
+  /**
+   * gp𐧌
+   * @param[in] isa gp̏(CPUΉĂȂΑΉĂɉ)
+   * @remarks x`}[N⌟ؗp
+   */
+  static void LimitIsa(SCAN_ISA isa);
+};
+}
+#endif // ANALYSISDRIVE_JSONSCAN_H_
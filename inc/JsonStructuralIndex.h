@@ -0,0 +1,92 @@
+/**
+ * @file   JsonStructuralIndex.h
+ * @brief  JSON̍\CfbNX
+ * @author kyo
+ * @date   2026/10/17
+ */
+#ifndef ANALYSISDRIVE_JSONSTRUCTURALINDEX_H_
+#define ANALYSISDRIVE_JSONSTRUCTURALINDEX_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/** Analysis Drive */
+namespace adlib
+{
+/**
+ * JSON̍\CfbNX
+ * @remarks 64bytẽubNƂɃrbg}XN쐬, string^̊Oɂ\('{', '}', '[', ']', ':', ','),
+ *          string^̊Jn'"', ̑̒l(number^, true, false, null)̐擪̈ʒuɗ񋓂. <br>
+ *          CfbNX͈TCYƂɍ쐬邽, Ŝ̃CfbNX͕ێȂ.
+ * @attention sJSONł͐ʒuɂȂȂꍇ(ĂяoŒlǂݍŊmF邱)
+ */
+class JsonStructuralIndex final
+{
+private:
+  //! xɃCfbNX쐬ubN
+  static const size_t CHUNK_BLOCKS;
+
+  //! ̐擪
+  const char* m_data;
+  //! ̃TCY
+  size_t m_size;
+  //! ɃCfbNX쐬ubN̐擪
+  size_t m_blockStart;
+  //! 쐬CfbNX(擪m_countL. ͎̈g)
+  std::vector<size_t> m_positions;
+  //! 쐬CfbNX̐
+  size_t m_count;
+  //! ɕԂCfbNX
+  size_t m_next;
+  //! ÕubN̍Ōオstring^̒łΑSrbg1
+  std::uint64_t m_prevInString;
+  //! ÕubN̍Ō'\\'Ŏ̕GXP[vĂ1
+  std::uint64_t m_prevEscaped;
+  //! ÕubN̍Ōオstring^ȊO̒l̓rł1
+  std::uint64_t m_prevScalar;
+
+private:
+  /** Rs[֎~ */
+  JsonStructuralIndex(const JsonStructuralIndex&);
+  /** ֎~ */
+  void operator=(const JsonStructuralIndex&);
+
+  /**
+   * ̃ubNQ̃CfbNX쐬
+   * @return 쐬łtrue(̍Ōłfalse)
+   */
+  bool IndexChunk();
+
+  /**
+   * 1ubÑCfbNX쐬
+   * @param[in] block ubN̐擪(64byteǂݍ߂邱)
+   * @param[in] start ubN̐擪̈ʒu
+   * @param[in] valid ubN̂Lbit
+   */
+  void IndexBlock(const char* block, size_t start, std::uint64_t valid);
+
+public:
+  /**
+   * RXgN^
+   * @param[in] data  ̐擪
+   * @param[in] size  ̃TCY
+   * @param[in] start CfbNX쐬Jnʒu
+   */
+  JsonStructuralIndex(const char* data, size_t size, size_t start);
+
+  /**
+   * ̍\̈ʒu擾
+   * @param[out] pos i[
+   * @return \true(̍Ōłfalse)
+   */
+  bool Next(size_t* pos)
+  {
+    if (m_next >= m_count && !this->IndexChunk()) return false;
+    *pos = m_positions[m_next];
+    ++m_next;
+    return true;
+  }
+};
+}
+#endif // ANALYSISDRIVE_JSONSTRUCTURALINDEX_H_
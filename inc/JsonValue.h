@@ -11,7 +11,9 @@
 #include <string>
 #include <vector>
 #include <unordered_map>
-#include <ostream>
+#include <atomic>
+#include <new>
+#include <utility>
 
 #undef GetObject
 
@@ -19,96 +21,212 @@
 namespace adlib
 {
 /**
- * JSON̒l
- * @remarks ۃNX
+ * JSON̒l(q[vɒul)
+ * @remarks string, array, object̎̂̊NX. <br>
+ *          null, number, boolJsonIuWFNgɒڕێ邽, {NX̔h͎Ȃ. <br>
+ *          QƃJEgɂ蕡JsonIuWFNg狤L, Ō̎QƂOꂽ_Ŕj. <br>
+ *          ^JsonIuWFNgێĂ邽, z֐͎Ȃ.
  */
 class JsonValue
 {
+private:
+  //! QƃJEg
+  std::atomic<long> m_refCount;
+  //! L֎~(ύX\ȎQƂԂl̓Rs[ɋLȂ)
+  bool m_unshareable;
+  //! A[ȉL(p[Xʂ̍ŏʂ̒lłtrue. jɃA[ȉL҂O)
+  bool m_arenaOwner;
+  //! mۂɎgpAP[^
+  Json::Allocator m_allocator;
+
+  //! ftHgnulll
+  static const Json DEFAULT_NULL;
+  //! ftHgstringl
+  static const std::string DEFAULT_STRING;
+  //! ftHgarrayl(const)
+  static const Json::Array DEFAULT_CONST_ARRAY;
+  //! ftHgobjectl(const)
+  static const Json::Object DEFAULT_CONST_OBJECT;
+  //! ftHgarrayl(const. ύXꂽꍇ̂ݏ)
+  static Json::Array s_defaultArray;
+  //! ftHgobjectl(const. ύXꂽꍇ̂ݏ)
+  static Json::Object s_defaultObject;
+
+private:
+  /** Rs[֎~ */
+  JsonValue(const JsonValue&);
+  /** ֎~ */
+  void operator=(const JsonValue&);
+
+protected:
+  /**
+   * RXgN^
+   * @param[in] alloc mۂɎgpAP[^
+   * @remarks QƃJEg1n܂
+   */
+  explicit JsonValue(const Json::Allocator& alloc) : m_refCount(1), m_unshareable(false), m_arenaOwner(false), m_allocator(alloc) {}
+
+  /** fXgN^ */
+  ~JsonValue() {}
+
 public:
-  /** zfXgN^ */
-  virtual ~JsonValue() {}
+  /**
+   * QƃJEg𑝂₷
+   */
+  void AddRef()
+  {
+    m_refCount.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  /**
+   * QƃJEg炷
+   * @return Ō̎QƂłtrue(ĂяoŔj邱)
+   */
+  bool RemoveRef()
+  {
+    return m_refCount.fetch_sub(1, std::memory_order_acq_rel) == 1;
+  }
+
+  /**
+   * JsonIuWFNgƋLĂ邩ǂ
+   * @return QƃJEg2ȏłtrue
+   */
+  bool IsShared() const
+  {
+    return m_refCount.load(std::memory_order_acquire) > 1;
+  }
+
+  /**
+   * L֎~
+   * @remarks array, object̕ύX\ȎQƂԂɌĂ(ȍ~̃Rs[ł͒lRs[)
+   */
+  void SetUnshareable()
+  {
+    m_unshareable = true;
+  }
+
+  /**
+   * L֎~Ă邩ǂ
+   * @return SetUnshareableĂłtrue
+   */
+  bool IsUnshareable() const
+  {
+    return m_unshareable;
+  }
+
+  /**
+   * A[iLĂ邩ǂ
+   * @return OwnArenaŏL҂ɂȂĂtrue
+   */
+  bool IsArenaOwner() const
+  {
+    return m_arenaOwner;
+  }
 
   /**
-   * ^擾
-   * @return ^
+   * AP[^擾
+   * @return mۂɎgpAP[^
    */
-  virtual Json::JSON_VALUE_TYPE GetValueType() const = 0;
+  const Json::Allocator& GetAllocator() const
+  {
+    return m_allocator;
+  }
 
   /**
-   * stringlget
-   * @return stringl
-   * @remarks I[o[ChȂꍇ̓ <br>
-   *          󕶎""Ԃ
+   * l쐬
+   * @tparam T 쐬ľ^(JsonValue̔hNX)
+   * @tparam V ľ^
+   * @param[in] value l(EӒlł΃[u)
+   * @param[in] alloc mۂɎgpAP[^
+   * @return 쐬l(QƃJEg1)
    */
-  virtual const std::string& GetString() const;
+  template <class T, class V>
+  static T* Create(V&& value, const Json::Allocator& alloc)
+  {
+    typename Json::Allocator::template rebind<T>::other allocator(alloc);
+    T* p = allocator.allocate(1);
+    try
+    {
+      ::new(static_cast<void*>(p)) T(std::forward<V>(value), alloc);
+    }
+    catch (...)
+    {
+      allocator.deallocate(p, 1);
+      throw;
+    }
+    return p;
+  }
 
   /**
-   * numberl(int)get
-   * @return numberl(int)
-   * @remarks I[o[ChȂꍇ̓ <br>
-   *          0Ԃ
+   * lj
+   * @tparam T jľ^(JsonValue̔hNX)
+   * @param[in] p jl
+   * @remarks LĂA[i, l(Ɨvf, o)jɏL҂O
    */
-  virtual int GetNumberInt() const;
+  template <class T>
+  static void Destroy(T* p)
+  {
+    typename Json::Allocator::template rebind<T>::other allocator(p->m_allocator);
+    JsonArena* const arena = p->m_arenaOwner ? p->m_allocator.Arena() : nullptr;
+    p->~T();
+    allocator.deallocate(p, 1);
+    if (arena != nullptr) JsonArena::ReleaseOwner(arena);
+  }
 
   /**
-   * numberl(double)get
-   * @return numberl(double)
-   * @remarks I[o[ChȂꍇ̓ <br>
-   *          0.0Ԃ
+   * QƂO(Ō̎QƂłΔj)
+   * @param[in] p    l
+   * @param[in] type ľ^
    */
-  virtual double GetNumberDouble() const;
+  static void Release(JsonValue* p, Json::JSON_VALUE_TYPE type);
 
   /**
-   * boollget
-   * @return booll
-   * @remarks I[o[ChȂꍇ̓ <br>
-   *          falseԂ
+   * l̊mۂɎgpA[iL
+   * @param[in] root p[Xʂ̍ŏʂ̒l
+   * @remarks A[i(JsonArena::CreateSharedō쐬)mۂstring, array, object݂̂Ώ. <br>
+   *          lj܂ŃA[i͔jȂ(l̃Rs[͓̂L, Cloneō쐬̂L).
    */
-  virtual bool GetBool() const;
+  static void OwnArena(const Json& root);
 
   /**
-   * arraylget
-   * @return arrayl
-   * @remarks I[o[ChȂꍇ̓ <br>
-   *          vectorԂ
+   * ftHgnulllget
+   * @return null
    */
-  virtual Json::Array& GetArray();
+  static const Json& DefaultNull();
 
   /**
-   * arraylget(const)
-   * @return arrayl
-   * @remarks I[o[ChȂꍇ̓ <br>
-   *          vectorԂ
+   * ftHgstringlget
+   * @return 󕶎
    */
-  virtual const Json::Array& GetArray() const;
+  static const std::string& DefaultString();
 
   /**
-   * objectlget
-   * @return objectl
-   * @remarks I[o[ChȂꍇ̓ <br>
-   *          mapԂ
+   * ftHgarraylget
+   * @return vector
+   * @attention Ԃl̓vOŜŋL. Xbh瓯ɌĂ΂Ȃ
+   *            (const̃o֐͌Ă΂Ȃ)
    */
-  virtual Json::Object& GetObject();
+  static Json::Array& DefaultArray();
 
   /**
-   * objectlget(const)
-   * @return objectl
-   * @remarks I[o[ChȂꍇ̓ <br>
-   *          mapԂ
+   * ftHgarraylget(const)
+   * @return vector
    */
-  virtual const Json::Object& GetObject() const;
+  static const Json::Array& DefaultConstArray();
 
   /**
-   * JSON`̕o
-   * @param[in,out] outStream o͐̃Xg[
+   * ftHgobjectlget
+   * @return map
+   * @attention Ԃl̓vOŜŋL. Xbh瓯ɌĂ΂Ȃ
+   *            (const̃o֐͌Ă΂Ȃ)
    */
-  virtual void Dump(std::ostream* outStream) const;
+  static Json::Object& DefaultObject();
 
   /**
-   * MessagePack`̃oCio
-   * @param[in,out] outStream o͐̃Xg[
+   * ftHgobjectlget(const)
+   * @return map
    */
-  virtual void DumpMsgpack(std::ostream* outStream) const;
+  static const Json::Object& DefaultConstObject();
 };
 }
 #endif // ANALYSISDRIVE_JSONVALUE_H_
@@ -10,120 +10,331 @@
 #include "JsonValue.h"
 #include "Json.h"
 #include "IncludeMsgpack.h"
+#include <atomic>
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <type_traits>
 #include <vector>
 
 /** Analysis Drive */
 namespace adlib
 {
-/** JSON̒l(array) */
+/**
+ * JSON̒l(array)
+ * @remarks vfSnumber(double), ܂͑Snumber(int, int64)array, vfÄɕێ(^tarray). <br>
+ *          JsonIuWFNgarrayƘÄ͓̈ɐ؂ւĔzu(^tarray̎̂). <br>
+ *          ^tarray, constGetArrayĂ΂ꂽ_ŏ߂ėvfƂJsonIuWFNgʂ̗̈ɍ쐬. <br>
+ *          쐬̓A[ił͂ȂɃq[vmۂ(A[i͔rsȂ,
+ *          hLg̕ʂarrayɑ΂ĕXbhconstGetArrayĂ΂ĂȂ悤ɂ).
+ */
 class JsonValueArray final : public JsonValue
 {
 private:
-  //! l
-  Json::Array m_value;
+  //> vf̕ێ`
+  enum STORAGE
+  {
+    STORAGE_JSON,   /*!< JsonIuWFNg(Json::Array)    */
+    STORAGE_DOUBLE, /*!< double̘Ä(Numbers)        */
+    STORAGE_INT64   /*!< int64̘Ä(Numbers)         */
+  };
+
+  //> ^tarray̗vf
+  struct Numbers
+  {
+    void* data;                                 //!< Ä(mۂɎgpAP[^vf傤ǂɊmۂ)
+    size_t size;                                //!< vf
+    mutable std::atomic<Json::Array*> expanded; //!< vfƂJsonIuWFNg(constGetArray̏ĂяoɃq[vɍ쐬)
+  };
+
+  //> vfzü̃TCY
+  static const size_t BUFFER_SIZE = (sizeof(Json::Array) > sizeof(Numbers)) ? sizeof(Json::Array) : sizeof(Numbers);
+  //> vfzü̃ACg
+  static const size_t BUFFER_ALIGN = (std::alignment_of<Json::Array>::value > std::alignment_of<Numbers>::value)
+    ? std::alignment_of<Json::Array>::value : std::alignment_of<Numbers>::value;
+
+  //! vf̕ێ`
+  STORAGE m_storage;
+  //! vf(ێ`ɂ, Json::Array܂Numberszu)
+  std::aligned_storage<BUFFER_SIZE, BUFFER_ALIGN>::type m_buffer;
 
 private:
+  /** ftHgRXgN^֎~ */
+  JsonValueArray();
   /** Rs[֎~ */
   JsonValueArray(const JsonValueArray&);
+  /** ֎~ */
+  void operator=(const JsonValueArray&);
 
-public:
-  /** RXgN^ */
-  JsonValueArray() {}
+  /**
+   * JsonIuWFNgarray擾
+   * @return vf(STORAGE_JSON̂)
+   */
+  Json::Array& Values()
+  {
+    return *reinterpret_cast<Json::Array*>(&m_buffer);
+  }
+
+  /**
+   * JsonIuWFNgarray擾(const)
+   * @return vf(STORAGE_JSON̂)
+   */
+  const Json::Array& Values() const
+  {
+    return *reinterpret_cast<const Json::Array*>(&m_buffer);
+  }
+
+  /**
+   * ^tarray̗vf擾
+   * @return vf(STORAGE_DOUBLE, STORAGE_INT64̂)
+   */
+  Numbers& TypedNumbers()
+  {
+    return *reinterpret_cast<Numbers*>(&m_buffer);
+  }
+
+  /**
+   * ^tarray̗vf擾(const)
+   * @return vf(STORAGE_DOUBLE, STORAGE_INT64̂)
+   */
+  const Numbers& TypedNumbers() const
+  {
+    return *reinterpret_cast<const Numbers*>(&m_buffer);
+  }
+
+  /**
+   * ̈ɔzuIuWFNgj
+   * @tparam T IuWFNǧ^
+   * @param[in] p IuWFNg
+   */
+  template <class T>
+  static void DestroyInPlace(T* p)
+  {
+    p->~T();
+  }
+
+  /**
+   * ^tarray̘Ä쐬
+   * @tparam T vf̌^
+   * @param[in] data 擪̗vf
+   * @param[in] size vf
+   */
+  template <class T>
+  void InitNumbers(const T* data, size_t size)
+  {
+    typename Json::Allocator::template rebind<T>::other allocator(this->GetAllocator());
+    T* const numbers = (size > 0) ? allocator.allocate(size) : nullptr;
+    if (size > 0) std::memcpy(numbers, data, size * sizeof(T));
+    Numbers* const p = new (&m_buffer) Numbers;
+    p->data = numbers;
+    p->size = size;
+    p->expanded.store(nullptr, std::memory_order_relaxed);
+  }
+
+  /**
+   * ^tarray̘Ä
+   * @tparam T vf̌^
+   */
+  template <class T>
+  void FreeNumbers()
+  {
+    Numbers& numbers = this->TypedNumbers();
+    typename Json::Allocator::template rebind<T>::other allocator(this->GetAllocator());
+    if (numbers.data != nullptr) allocator.deallocate(static_cast<T*>(numbers.data), numbers.size);
+    delete numbers.expanded.load(std::memory_order_relaxed);
+    DestroyInPlace(&numbers);
+  }
+
+  /**
+   * ^tarray̗vfƂJsonIuWFNg쐬
+   * @param[out] values i[(ɒǉ)
+   */
+  void Expand(Json::Array* values) const
+  {
+    const Numbers& numbers = this->TypedNumbers();
+    values->reserve(numbers.size);
+    if (m_storage == STORAGE_DOUBLE)
+    {
+      const double* const data = static_cast<const double*>(numbers.data);
+      for (size_t i = 0; i < numbers.size; ++i) values->emplace_back(data[i]);
+    }
+    else
+    {
+      // int^͈͓̔łnumber(int), ȊOnumber(int64)
+      const std::int64_t* const data = static_cast<const std::int64_t*>(numbers.data);
+      for (size_t i = 0; i < numbers.size; ++i)
+      {
+        if (data[i] >= INT_MIN && data[i] <= INT_MAX) values->emplace_back(static_cast<int>(data[i]));
+        else values->emplace_back(data[i]);
+      }
+    }
+  }
 
+public:
   /**
    * RXgN^
    * @tparam value l
+   * @tparam alloc mۂɎgpAP[^(vf̊mۂɂgp)
+   */
+  JsonValueArray(const Json::Array& value, const Json::Allocator& alloc)
+    : JsonValue(alloc), m_storage(STORAGE_JSON)
+  {
+    new (&m_buffer) Json::Array(value, alloc);
+  }
+
+  /**
+   * RXgN^([u)
+   * @tparam value l
+   * @tparam alloc mۂɎgpAP[^(valueƓłΗvf̂܂܈ڂ)
    */
-  explicit JsonValueArray(const Json::Array& value) : m_value(value) {}
+  JsonValueArray(Json::Array&& value, const Json::Allocator& alloc)
+    : JsonValue(alloc), m_storage(STORAGE_JSON)
+  {
+    new (&m_buffer) Json::Array(std::move(value), alloc);
+  }
 
-  /** zfXgN^ */
-  virtual ~JsonValueArray() {}
+  /**
+   * RXgN^(^tarray)
+   * @tparam value l(double̘Ä, Rs[)
+   * @tparam alloc mۂɎgpAP[^
+   */
+  JsonValueArray(JsonSpan<double> value, const Json::Allocator& alloc)
+    : JsonValue(alloc), m_storage(STORAGE_DOUBLE)
+  {
+    this->InitNumbers(value.Data(), value.Size());
+  }
 
   /**
-   * 
-   * @param[in] obj IuWFNg
+   * RXgN^(^tarray)
+   * @tparam value l(int64̘Ä, Rs[)
+   * @tparam alloc mۂɎgpAP[^
    */
-  JsonValueArray& operator=(const JsonValueArray& obj)
+  JsonValueArray(JsonSpan<std::int64_t> value, const Json::Allocator& alloc)
+    : JsonValue(alloc), m_storage(STORAGE_INT64)
+  {
+    this->InitNumbers(value.Data(), value.Size());
+  }
+
+  /** fXgN^ */
+  ~JsonValueArray()
   {
-    m_value = obj.m_value;
-    return *this;
+    if (m_storage == STORAGE_DOUBLE) this->FreeNumbers<double>();
+    else if (m_storage == STORAGE_INT64) this->FreeNumbers<std::int64_t>();
+    else DestroyInPlace(&this->Values());
   }
 
   /**
-   * ^擾
-   * @return ^
+   * double̘ÄɕێĂ邩ǂ
+   * @return ێĂtrue
    */
-  Json::JSON_VALUE_TYPE GetValueType() const override
+  bool IsDoubleArray() const
   {
-    return Json::JSON_VALUE_TYPE::ARRAY;
+    return m_storage == STORAGE_DOUBLE;
+  }
+
+  /**
+   * int64̘ÄɕێĂ邩ǂ
+   * @return ێĂtrue
+   */
+  bool IsInt64Array() const
+  {
+    return m_storage == STORAGE_INT64;
   }
 
   /**
    * arraylget
    * @return arrayl
+   * @remarks ^tarray͗vfƂJsonIuWFNgarrayɕς, Ä(ȍ~͕ύXĂ悢)
    */
-  Json::Array& GetArray() override
+  Json::Array& GetArray()
   {
-    return m_value;
+    if (m_storage != STORAGE_JSON)
+    {
+      Json::Array values(this->GetAllocator());
+      this->Expand(&values);
+      if (m_storage == STORAGE_DOUBLE) this->FreeNumbers<double>();
+      else this->FreeNumbers<std::int64_t>();
+      new (&m_buffer) Json::Array(std::move(values));
+      m_storage = STORAGE_JSON;
+    }
+    return this->Values();
   }
 
   /**
    * arraylget(const)
    * @return arrayl
+   * @remarks ^tarray͏̂ݗvfƂJsonIuWFNgq[vɍ쐬(Xbh瓯ɌĂ΂Ă悢). <br>
+   *          mۂꍇGetDoubleSpan, GetInt64Spangp
    */
-  const Json::Array& GetArray() const override
+  const Json::Array& GetArray() const
   {
-    return m_value;
+    if (m_storage == STORAGE_JSON) return this->Values();
+
+    const Numbers& numbers = this->TypedNumbers();
+    Json::Array* expanded = numbers.expanded.load(std::memory_order_acquire);
+    if (expanded != nullptr) return *expanded;
+    // 쐬ēo^(ɍ쐬ꍇ, ɓo^gp)
+    std::unique_ptr<Json::Array> values(new Json::Array());
+    this->Expand(values.get());
+    if (numbers.expanded.compare_exchange_strong(expanded, values.get(), std::memory_order_acq_rel, std::memory_order_acquire))
+    {
+      return *values.release();
+    }
+    return *expanded;
   }
 
   /**
-   * JSON`̕o
-   * @param[in,out] outStream o͐̃Xg[
+   * arrayl(double̘Ä)get
+   * @return vf(IsDoubleArrayłȂ΋)
    */
-  void Dump(std::ostream* outStream) const override
+  JsonSpan<double> GetDoubleSpan() const
   {
-    // O
-    *outStream << "[";
-    // vfꍇ̂ݏo͏s
-    if (m_value.size() > 0)
-    {
-      // Ce[^擾
-      auto it = m_value.begin();
-      // vf[v
-      while (true)
-      {
-        // o
-        it->Dump(outStream);
-        // Ce[^i߂
-        it++;
-        // IłȂꍇ
-        if (it != m_value.end())
-        {
-          // J}o
-          *outStream << ",";
-        }
-        // Ȉꍇ
-        else
-        {
-          break;
-        }
-      }
-    }
-    // ㊇
-    *outStream << "]" << std::flush;
+    if (m_storage != STORAGE_DOUBLE) return JsonSpan<double>();
+    const Numbers& numbers = this->TypedNumbers();
+    return JsonSpan<double>(static_cast<const double*>(numbers.data), numbers.size);
+  }
+
+  /**
+   * arrayl(int64̘Ä)get
+   * @return vf(IsInt64ArrayłȂ΋)
+   */
+  JsonSpan<std::int64_t> GetInt64Span() const
+  {
+    if (m_storage != STORAGE_INT64) return JsonSpan<std::int64_t>();
+    const Numbers& numbers = this->TypedNumbers();
+    return JsonSpan<std::int64_t>(static_cast<const std::int64_t*>(numbers.data), numbers.size);
   }
 
   /**
    * MessagePack`̃oCio
    * @param[in,out] outStream o͐̃Xg[
    */
-  void DumpMsgpack(std::ostream* outStream) const override
+  void DumpMsgpack(std::ostream* outStream) const
   {
     msgpack::packer<std::ostream> pk(outStream);
+    // ^tarray͘Ä悩o͂(vfƂɏo͂ꍇƓtH[}bg)
+    if (m_storage == STORAGE_DOUBLE)
+    {
+      const JsonSpan<double> numbers = this->GetDoubleSpan();
+      pk.pack_array(numbers.Size());
+      for (const double number : numbers) pk.pack_double(number);
+      return;
+    }
+    if (m_storage == STORAGE_INT64)
+    {
+      const JsonSpan<std::int64_t> numbers = this->GetInt64Span();
+      pk.pack_array(numbers.Size());
+      for (const std::int64_t number : numbers) pk.pack_int64(number);
+      return;
+    }
+
+    const Json::Array& values = this->Values();
     // arrayTCYw
-    pk.pack_array(m_value.size());
+    pk.pack_array(values.size());
     // vfo
-    for (auto it = m_value.begin(); it != m_value.end(); ++it)
+    for (auto it = values.begin(); it != values.end(); ++it)
     {
       // o
       it->DumpMsgpack(outStream);
@@ -1,86 +0,0 @@
-/**
- * @file   JsonValueBool.h
- * @brief  JSON̒l(bool)
- * @author kyo
- * @date   2015/05/05
- */
-#ifndef ANALYSISDRIVE_JSONVALUEBOOL_H_
-#define ANALYSISDRIVE_JSONVALUEBOOL_H_
-
-#include "JsonValue.h"
-#include "Json.h"
-#include "IncludeMsgpack.h"
-
-/** Analysis Drive */
-namespace adlib
-{
-/** JSON̒l(bool) */
-class JsonValueBool final : public JsonValue
-{
-private:
-  //! l
-  bool m_value;
-
-private:
-  /** ftHgRXgN^֎~ */
-  JsonValueBool() {}
-  /** Rs[֎~ */
-  JsonValueBool(const JsonValueBool&);
-  /** ֎~ */
-  void operator=(const JsonValueBool&);
-
-public:
-  /**
-   * RXgN^
-   * @tparam value l
-   */
-  explicit JsonValueBool(bool value) : m_value(value) {}
-
-  /** zfXgN^ */
-  virtual ~JsonValueBool() {}
-
-  /**
-   * ^擾
-   * @return ^
-   */
-  Json::JSON_VALUE_TYPE GetValueType() const override
-  {
-    return Json::JSON_VALUE_TYPE::BOOL;
-  }
-
-  /**
-   * boollget
-   * @return booll
-   */
-  bool GetBool() const override
-  {
-    return m_value;
-  }
-
-  /**
-   * JSON`̕o
-   * @param[in,out] outStream o͐̃Xg[
-   */
-  void Dump(std::ostream* outStream) const override
-  {
-    if (m_value)
-    {
-      *outStream << "true" << std::flush;
-    }
-    else
-    {
-      *outStream << "false" << std::flush;
-    }
-  }
-
-  /**
-   * MessagePack`̃oCio
-   * @param[in,out] outStream o͐̃Xg[
-   */
-  void DumpMsgpack(std::ostream* outStream) const override
-  {
-    msgpack::pack(outStream, m_value);
-  }
-};
-}
-#endif // ANALYSISDRIVE_JSONVALUEBOOL_H_
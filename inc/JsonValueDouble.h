@@ -1,88 +0,0 @@
-/**
- * @file   JsonValueDouble.h
- * @brief  JSON̒l(number(double))
- * @author kyo
- * @date   2015/05/05
- */
-#ifndef ANALYSISDRIVE_JSONVALUEDOUBLE_H_
-#define ANALYSISDRIVE_JSONVALUEDOUBLE_H_
-
-#include "JsonValue.h"
-#include "Json.h"
-#include "IncludeMsgpack.h"
-
-/** Analysis Drive */
-namespace adlib
-{
-/** JSON̒l(number(double)) */
-class JsonValueDouble final : public JsonValue
-{
-private:
-  //! l
-  double m_value;
-
-private:
-  /** ftHgRXgN^֎~ */
-  JsonValueDouble() {}
-  /** Rs[֎~ */
-  JsonValueDouble(const JsonValueDouble&);
-  /** ֎~ */
-  void operator=(const JsonValueDouble&);
-
-public:
-  /**
-   * RXgN^
-   * @tparam value l
-   */
-  explicit JsonValueDouble(double value) : m_value(value) {}
-
-  /** zfXgN^ */
-  virtual ~JsonValueDouble() {}
-
-  /**
-   * ^擾
-   * @return ^
-   */
-  Json::JSON_VALUE_TYPE GetValueType() const override
-  {
-    return Json::JSON_VALUE_TYPE::NUMBER_DOUBLE;
-  }
-
-  /**
-   * numberl(int)get
-   * @return numberl(int)
-   */
-  int GetNumberInt() const override
-  {
-    return static_cast<int>(m_value);
-  }
-
-  /**
-   * numberl(double)get
-   * @return numberl(double)
-   */
-  double GetNumberDouble() const override
-  {
-    return m_value;
-  }
-
-  /**
-   * JSON`̕o
-   * @param[in,out] outStream o͐̃Xg[
-   */
-  void Dump(std::ostream* outStream) const override
-  {
-    *outStream << m_value << std::flush;
-  }
-
-  /**
-   * MessagePack`̃oCio
-   * @param[in,out] outStream o͐̃Xg[
-   */
-  void DumpMsgpack(std::ostream* outStream) const override
-  {
-    msgpack::pack(outStream, m_value);
-  }
-};
-}
-#endif // ANALYSISDRIVE_JSONVALUEDOUBLE_H_
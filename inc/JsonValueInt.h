@@ -1,88 +0,0 @@
-/**
- * @file   JsonValueInt.h
- * @brief  JSON̒l(number(int))
- * @author kyo
- * @date   2015/05/05
- */
-#ifndef ANALYSISDRIVE_JSONVALUEINT_H_
-#define ANALYSISDRIVE_JSONVALUEINT_H_
-
-#include "JsonValue.h"
-#include "Json.h"
-#include "IncludeMsgpack.h"
-
-/** Analysis Drive */
-namespace adlib
-{
-/** JSON̒l(number(int)) */
-class JsonValueInt final : public JsonValue
-{
-private:
-  //! l
-  int m_value;
-
-private:
-  /** ftHgRXgN^֎~ */
-  JsonValueInt() {}
-  /** Rs[֎~ */
-  JsonValueInt(const JsonValueInt&);
-  /** ֎~ */
-  void operator=(const JsonValueInt&);
-
-public:
-  /**
-   * RXgN^
-   * @tparam value l
-   */
-  explicit JsonValueInt(int value) : m_value(value) {}
-
-  /** zfXgN^ */
-  virtual ~JsonValueInt() {}
-
-  /**
-   * ^擾
-   * @return ^
-   */
-  Json::JSON_VALUE_TYPE GetValueType() const override
-  {
-    return Json::JSON_VALUE_TYPE::NUMBER_INT;
-  }
-
-  /**
-   * numberl(int)get
-   * @return numberl(int)
-   */
-  int GetNumberInt() const override
-  {
-    return m_value;
-  }
-
-  /**
-   * numberl(double)get
-   * @return numberl(double)
-   */
-  double GetNumberDouble() const override
-  {
-    return static_cast<double>(m_value);
-  }
-
-  /**
-   * JSON`̕o
-   * @param[in,out] outStream o͐̃Xg[
-   */
-  void Dump(std::ostream* outStream) const override
-  {
-    *outStream << m_value << std::flush;
-  }
-
-  /**
-   * MessagePack`̃oCio
-   * @param[in,out] outStream o͐̃Xg[
-   */
-  void DumpMsgpack(std::ostream* outStream) const override
-  {
-    msgpack::pack(outStream, m_value);
-  }
-};
-}
-#endif // ANALYSISDRIVE_JSONVALUEINT_H_
@@ -1,66 +0,0 @@
-/**
- * @file   JsonValueNull.h
- * @brief  JSON̒l(null)
- * @author kyo
- * @date   2015/05/05
- */
-#ifndef ANALYSISDRIVE_JSONVALUENULL_H_
-#define ANALYSISDRIVE_JSONVALUENULL_H_
-
-#include "JsonValue.h"
-#include "Json.h"
-#include "IncludeMsgpack.h"
-
-/** Analysis Drive */
-namespace adlib
-{
-/** JSON̒l(bool) */
-class JsonValueNull final : public JsonValue
-{
-private:
-  /** ftHgRXgN^֎~ */
-  JsonValueNull() {}
-  /** Rs[֎~ */
-  JsonValueNull(const JsonValueNull&);
-  /** ֎~ */
-  void operator=(const JsonValueNull&);
-
-public:
-  /**
-   * RXgN^
-   * @tparam value nullptr
-   */
-  explicit JsonValueNull(std::nullptr_t value) {}
-
-  /** zfXgN^ */
-  virtual ~JsonValueNull() {}
-
-  /**
-   * ^擾
-   * @return ^
-   */
-  Json::JSON_VALUE_TYPE GetValueType() const override
-  {
-    return Json::JSON_VALUE_TYPE::NUL;
-  }
-
-  /**
-   * JSON`̕o
-   * @param[in,out] outStream o͐̃Xg[
-   */
-  void Dump(std::ostream* outStream) const override
-  {
-    *outStream << "null" << std::flush;
-  }
-
-  /**
-   * MessagePack`̃oCio
-   * @param[in,out] outStream o͐̃Xg[
-   */
-  void DumpMsgpack(std::ostream* outStream) const override
-  {
-    msgpack::pack(outStream, msgpack::type::nil());
-  }
-};
-}
-#endif // ANALYSISDRIVE_JSONVALUENULL_H_
@@ -24,46 +24,36 @@ private:
   Json::Object m_value;
 
 private:
+  /** ftHgRXgN^֎~ */
+  JsonValueObject();
   /** Rs[֎~ */
   JsonValueObject(const JsonValueObject&);
+  /** ֎~ */
+  void operator=(const JsonValueObject&);
 
 public:
-  /** RXgN^ */
-  JsonValueObject() {}
-
   /**
    * RXgN^
    * @tparam value l
+   * @tparam alloc mۂɎgpAP[^(vf̊mۂɂgp)
    */
-  explicit JsonValueObject(const Json::Object& value) : m_value(value) {}
-
-  /** zfXgN^ */
-  virtual ~JsonValueObject() {}
+  JsonValueObject(const Json::Object& value, const Json::Allocator& alloc) : JsonValue(alloc), m_value(value, alloc) {}
 
   /**
-   * 
-   * @param[in] obj IuWFNg
+   * RXgN^([u)
+   * @tparam value l
+   * @tparam alloc mۂɎgpAP[^(valueƓłΗvf̂܂܈ڂ)
    */
-  JsonValueObject& operator=(const JsonValueObject& obj)
-  {
-    m_value = obj.m_value;
-    return *this;
-  }
+  JsonValueObject(Json::Object&& value, const Json::Allocator& alloc) : JsonValue(alloc), m_value(std::move(value), alloc) {}
 
-  /**
-   * ^擾
-   * @return ^
-   */
-  Json::JSON_VALUE_TYPE GetValueType() const override
-  {
-    return Json::JSON_VALUE_TYPE::OBJECT;
-  }
+  /** fXgN^ */
+  ~JsonValueObject() {}
 
   /**
    * objectlget
    * @return objectl
    */
-  Json::Object& GetObject() override
+  Json::Object& GetObject()
   {
     return m_value;
   }
@@ -72,55 +62,16 @@ public:
    * objectlget(const)
    * @return objectl
    */
-  const Json::Object& GetObject() const override
+  const Json::Object& GetObject() const
   {
     return m_value;
   }
 
-  /**
-   * JSON`̕o
-   * @param[in,out] outStream o͐̃Xg[
-   */
-  void Dump(std::ostream* outStream) const override
-  {
-    // O
-    *outStream << "{";
-    // vfꍇ̂ݏo͏s
-    if (m_value.size() > 0)
-    {
-      // Ce[^擾
-      auto it = m_value.begin();
-      // vf[v
-      while (true)
-      {
-        // nameo
-        *outStream << "\"" << it->first << "\"" << ":";
-        // o
-        it->second.Dump(outStream);
-        // Ce[^i߂
-        it++;
-        // IłȂꍇ
-        if (it != m_value.end())
-        {
-          // J}o
-          *outStream << ",";
-        }
-        // Ȉꍇ
-        else
-        {
-          break;
-        }
-      }
-    }
-    // ㊇
-    *outStream << "}" << std::flush;
-  }
-
   /**
    * MessagePack`̃oCio
    * @param[in,out] outStream o͐̃Xg[
    */
-  void DumpMsgpack(std::ostream* outStream) const override
+  void DumpMsgpack(std::ostream* outStream) const
   {
     msgpack::packer<std::ostream> pk(outStream);
     // objectTCYw
@@ -129,7 +80,7 @@ public:
     for (auto it = m_value.begin(); it != m_value.end(); ++it)
     {
       // nameo
-      pk.pack(it->first);
+      pk.pack(it->first.GetString());
       // valueo
       it->second.DumpMsgpack(outStream);
     }
@@ -9,22 +9,33 @@
 
 #include "JsonValue.h"
 #include "Json.h"
+#include "JsonStringView.h"
 #include "IncludeMsgpack.h"
+#include <mutex>
 #include <string>
 
 /** Analysis Drive */
 namespace adlib
 {
-/** JSON̒l(string) */
+/**
+ * JSON̒l(string)
+ * @remarks ̓obt@QƂl(Qƃ[h), GetStringĂ΂ꂽ_ŏ߂ăRs[쐬
+ */
 class JsonValueString final : public JsonValue
 {
 private:
-  //! l
-  std::string m_value;
+  //! l(Qƃ[hłGetString̏Ăяoɍ쐬)
+  mutable std::string m_value;
+  //! l̎Q(Qƃ[hłȂm_valuew)
+  JsonStringView m_view;
+  //! Qƃ[hłtrue
+  bool m_isView;
+  //! Qƃ[hm_valuex쐬邽߂̃tO
+  mutable std::once_flag m_copyFlag;
 
 private:
   /** ftHgRXgN^֎~ */
-  JsonValueString() {}
+  JsonValueString();
   /** Rs[֎~ */
   JsonValueString(const JsonValueString&);
   /** ֎~ */
@@ -34,46 +45,59 @@ public:
   /**
    * RXgN^
    * @tparam value l
+   * @tparam alloc mۂɎgpAP[^
    */
-  explicit JsonValueString(const std::string& value) : m_value(value) {}
+  JsonValueString(const std::string& value, const Json::Allocator& alloc)
+    : JsonValue(alloc), m_value(value), m_view(m_value), m_isView(false) {}
 
-  /** zfXgN^ */
-  virtual ~JsonValueString() {}
+  /**
+   * RXgN^([u)
+   * @tparam value l
+   * @tparam alloc mۂɎgpAP[^
+   */
+  JsonValueString(std::string&& value, const Json::Allocator& alloc)
+    : JsonValue(alloc), m_value(std::move(value)), m_view(m_value), m_isView(false) {}
 
   /**
-   * ^擾
-   * @return ^
+   * RXgN^(Qƃ[h)
+   * @tparam value l̎Q(QƐ̓Rs[Ȃ)
+   * @tparam alloc mۂɎgpAP[^
    */
-  Json::JSON_VALUE_TYPE GetValueType() const override
-  {
-    return Json::JSON_VALUE_TYPE::STRING;
-  }
+  JsonValueString(const JsonStringView& value, const Json::Allocator& alloc)
+    : JsonValue(alloc), m_view(value), m_isView(true) {}
+
+  /** fXgN^ */
+  ~JsonValueString() {}
 
   /**
    * stringlget
    * @return stringl
    */
-  const std::string& GetString() const override
+  const std::string& GetString() const
   {
+    // Qƃ[hł͏̂݃Rs[쐬(Xbh瓯ɌĂ΂Ă悢)
+    if (m_isView) std::call_once(m_copyFlag, [this]() { m_value = m_view.ToString(); });
     return m_value;
   }
 
   /**
-   * JSON`̕o
-   * @param[in,out] outStream o͐̃Xg[
+   * stringl̎QƂget
+   * @return stringl̎Q(Rs[Ȃ)
    */
-  void Dump(std::ostream* outStream) const override
+  const JsonStringView& GetStringView() const
   {
-    *outStream << "\"" << m_value << "\"" << std::flush;
+    return m_view;
   }
 
   /**
    * MessagePack`̃oCio
    * @param[in,out] outStream o͐̃Xg[
    */
-  void DumpMsgpack(std::ostream* outStream) const override
+  void DumpMsgpack(std::ostream* outStream) const
   {
-    msgpack::pack(outStream, m_value);
+    msgpack::packer<std::ostream> packer(outStream);
+    packer.pack_str(static_cast<uint32_t>(m_view.Size()));
+    packer.pack_str_body(m_view.Data(), static_cast<uint32_t>(m_view.Size()));
   }
 };
 }
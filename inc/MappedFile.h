@@ -0,0 +1,67 @@
+/**
+ * @file   MappedFile.h
+ * @brief  ǂݍݐp̃}bvht@C
+ * @author kyo
+ * @date   2026/10/17
+ */
+#ifndef ANALYSISDRIVE_MAPPEDFILE_H_
+#define ANALYSISDRIVE_MAPPEDFILE_H_
+
+#include <memory>
+#include <string>
+
+/** Analysis Drive */
+namespace adlib
+{
+/**
+ * ǂݍݐp̃}bvht@C
+ * @remarks t@CŜǂݍݐpŃ}bv, jɃA}bv
+ */
+class MappedFile final
+{
+private:
+  //! PimplCfBI
+  class Impl;
+  std::unique_ptr<Impl> m_impl;
+
+private:
+  /** Rs[֎~ */
+  MappedFile(const MappedFile&);
+  /** ֎~ */
+  void operator=(const MappedFile&);
+
+public:
+  /** RXgN^ */
+  MappedFile();
+
+  /** zfXgN^ */
+  virtual ~MappedFile();
+
+  /**
+   * t@C}bv
+   * @param[in] path t@CpX
+   * @return true
+   * @remarks Ƀ}bvĂt@C̓A}bv. <br>
+   *          TCY0̃t@C̓}bvɐƂ(Data()nullptrɂȂ).
+   */
+  bool Open(const std::string& path);
+
+  /**
+   * A}bv
+   */
+  void Close();
+
+  /**
+   * }bv̈̐擪擾
+   * @return ̈̐擪(}bvĂȂnullptr)
+   */
+  const char* Data() const;
+
+  /**
+   * }bv̈̃TCY擾
+   * @return TCY(byte)
+   */
+  size_t Size() const;
+};
+}
+#endif // ANALYSISDRIVE_MAPPEDFILE_H_
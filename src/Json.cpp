@@ -5,202 +5,306 @@
  * @date   2015/05/03
  */
 #include "Json.h"
+#include "JsonDocument.h"
+#include "JsonSink.h"
 #include "JsonValue.h"
-#include "JsonValueNull.h"
 #include "JsonValueString.h"
-#include "JsonValueInt.h"
-#include "JsonValueDouble.h"
-#include "JsonValueBool.h"
 #include "JsonValueArray.h"
 #include "JsonValueObject.h"
+#include "JsonWriter.h"
+#include "IncludeMsgpack.h"
+#include <climits>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
 #include <unordered_map>
+#include <utility>
 
 /** Analysis Drive */
 namespace adlib
 {
-//! PimplCfBI
-class Json::Impl
+/**
+ * q[vɒu^ǂ
+ * @param[in] type ^
+ * @return string, array, objectłtrue
+ */
+static bool IsHeapType(Json::JSON_VALUE_TYPE type)
 {
-private:
-  /* ftHgRXgN^֎~ */
-  Impl();
-
-public:
-  //! JSON̒l
-  std::shared_ptr<JsonValue> m_jsonValue;
-
-  /**
-   * RXgN^
-   * @param[in] value l(null)
-   */
-  explicit Impl(std::nullptr_t value)
-    :m_jsonValue(std::make_shared<JsonValueNull>(value))
-  {
-  }
-
-  /**
-   * RXgN^
-   * @param[in] value l(string^)
-   */
-  explicit Impl(const std::string& value)
-    :m_jsonValue(std::make_shared<JsonValueString>(value))
-  {
-  }
+  return type == Json::JSON_VALUE_TYPE::STRING
+    || type == Json::JSON_VALUE_TYPE::ARRAY
+    || type == Json::JSON_VALUE_TYPE::OBJECT;
+}
 
-  /**
-   * RXgN^
-   * @param[in] value l(number^(int))
-   */
-  explicit Impl(int value)
-    :m_jsonValue(std::make_shared<JsonValueInt>(value))
-  {
-  }
+/**
+ * RXgN^
+ * @remarks Ȃ̃RXgN^łnullJSONIuWFNg쐬
+ * @note Json::Object𑶍݂ȂL[ŃANZXꍇ, <br>
+ *       {RXgN^ɂJsonVKo^. <br>
+ *       ɂ, ݂ȂL[ŃANZXnullƓl̒lɂȂ.
+ */
+Json::Json() :m_type(Json::JSON_VALUE_TYPE::NUL)
+{
+  m_value.m_heap = nullptr;
+}
 
-  /**
-   * RXgN^
-   * @param[in] value l(number^(double))
-   */
-  explicit Impl(double value)
-    :m_jsonValue(std::make_shared<JsonValueDouble>(value))
-  {
-  }
+/**
+ * RXgN^
+ * @param[in] value l(null)
+ */
+Json::Json(std::nullptr_t value) :m_type(Json::JSON_VALUE_TYPE::NUL)
+{
+  m_value.m_heap = value;
+}
 
-  /**
-   * RXgN^
-   * @param[in] value l(bool^)
-   */
-  explicit Impl(bool value)
-    :m_jsonValue(std::make_shared<JsonValueBool>(value))
-  {
-  }
+/**
+ * RXgN^
+ * @param[in] value l(string^)
+ * @param[in] alloc mۂɎgpAP[^(ȗ̓q[v)
+ */
+Json::Json(const std::string& value, const Json::Allocator& alloc) :m_type(Json::JSON_VALUE_TYPE::STRING)
+{
+  m_value.m_heap = JsonValue::Create<JsonValueString>(value, alloc);
+}
 
-  /**
-   * RXgN^
-   * @param[in] value l(array^)
-   */
-  explicit Impl(const Json::Array& value)
-    :m_jsonValue(std::make_shared<JsonValueArray>(value))
-  {
-  }
+/**
+ * RXgN^([u)
+ * @param[in] value l(string^)
+ * @param[in] alloc mۂɎgpAP[^(ȗ̓q[v)
+ */
+Json::Json(std::string&& value, const Json::Allocator& alloc) :m_type(Json::JSON_VALUE_TYPE::STRING)
+{
+  m_value.m_heap = JsonValue::Create<JsonValueString>(std::move(value), alloc);
+}
 
-  /**
-   * RXgN^
-   * @param[in] value l(object^)
-   */
-  explicit Impl(const Json::Object& value)
-    :m_jsonValue(std::make_shared<JsonValueObject>(value))
-  {
-  }
+/**
+ * RXgN^(Q)
+ * @param[in] value l(string^)̎Q
+ * @param[in] alloc mۂɎgpAP[^(ȗ̓q[v)
+ * @remarks ̓Rs[ɎQƂ(GetStringĂ񂾎_ŏ߂ăRs[)
+ */
+Json::Json(const JsonStringView& value, const Json::Allocator& alloc) :m_type(Json::JSON_VALUE_TYPE::STRING)
+{
+  m_value.m_heap = JsonValue::Create<JsonValueString>(value, alloc);
+}
 
-  /**
-   * Rs[RXgN^
-   * @param[in] obj Rs[
-   */
-  Impl(const Impl& obj)
-    :m_jsonValue(obj.m_jsonValue)
-  {
-  }
+/**
+ * RXgN^
+ * @param[in] value l(number^(int))
+ */
+Json::Json(int value) :m_type(Json::JSON_VALUE_TYPE::NUMBER_INT)
+{
+  m_value.m_int = value;
+}
 
-  /**
-   * [uRXgN^
-   * @param[in] obj [uIuWFNg
-   */
-  Impl(Impl&& obj)
-    :m_jsonValue(std::move(obj.m_jsonValue))
+/**
+ * RXgN^
+ * @param[in] value l(number^(int64))
+ */
+Json::Json(std::int64_t value)
+{
+  // p[XʂƓl, int^͈̔͂Ɏ܂number(int)ɂ
+  if (INT_MIN <= value && value <= INT_MAX)
   {
+    m_type = Json::JSON_VALUE_TYPE::NUMBER_INT;
+    m_value.m_int = static_cast<int>(value);
   }
-
-  /**
-   * 
-   * @param[in] obj IuWFNg
-   */
-  Impl& Impl::operator=(const Impl& obj)
+  else
   {
-    m_jsonValue = obj.m_jsonValue;
-    return *this;
+    m_type = Json::JSON_VALUE_TYPE::NUMBER_INT64;
+    m_value.m_int64 = value;
   }
-};
+}
 
 /**
  * RXgN^
- * @remarks Ȃ̃RXgN^łnullJSONIuWFNg쐬
- * @note Json::Object𑶍݂ȂL[ŃANZXꍇ, <br>
- *       {RXgN^ɂJsonVKo^. <br>
- *       ɂ, ݂ȂL[ŃANZXnullƓl̒lɂȂ.
+ * @param[in] value l(number^(double))
  */
-Json::Json() :m_impl(std::make_unique<Impl>(nullptr)) {}
+Json::Json(double value) :m_type(Json::JSON_VALUE_TYPE::NUMBER_DOUBLE)
+{
+  m_value.m_double = value;
+}
 
 /**
  * RXgN^
- * @param[in] value l(null)
+ * @param[in] value l(bool^)
  */
-Json::Json(std::nullptr_t value) :m_impl(std::make_unique<Impl>(value)) {}
+Json::Json(bool value) :m_type(Json::JSON_VALUE_TYPE::BOOL)
+{
+  m_value.m_bool = value;
+}
 
 /**
  * RXgN^
- * @param[in] value l(string^)
+ * @param[in] value l(array^)
+ * @param[in] alloc mۂɎgpAP[^(ȗ̓q[v)
  */
-Json::Json(const std::string& value) :m_impl(std::make_unique<Impl>(value)) {}
+Json::Json(const Json::Array& value, const Json::Allocator& alloc) :m_type(Json::JSON_VALUE_TYPE::ARRAY)
+{
+  m_value.m_heap = JsonValue::Create<JsonValueArray>(value, alloc);
+}
+
+/**
+ * RXgN^([u)
+ * @param[in] value l(array^)
+ * @remarks vf̓Rs[valueڂ. ̂valueƓAP[^Ŋmۂ.
+ */
+Json::Json(Json::Array&& value) :m_type(Json::JSON_VALUE_TYPE::ARRAY)
+{
+  const Json::Allocator alloc(value.get_allocator());
+  m_value.m_heap = JsonValue::Create<JsonValueArray>(std::move(value), alloc);
+}
 
 /**
  * RXgN^
- * @param[in] value l(number^(int))
+ * @param[in] value l(array^, vf͑Snumber(double))
+ * @param[in] alloc mۂɎgpAP[^(ȗ̓q[v)
+ * @remarks vfdouble̘Ä̂܂ܕێ
+ */
+Json::Json(const Json::DoubleArray& value, const Json::Allocator& alloc) :m_type(Json::JSON_VALUE_TYPE::ARRAY)
+{
+  m_value.m_heap = JsonValue::Create<JsonValueArray>(JsonSpan<double>(value.data(), value.size()), alloc);
+}
+
+/**
+ * RXgN^([u)
+ * @param[in] value l(array^, vf͑Snumber(double))
+ * @remarks vf͎̘̂ÄɃRs[. ̂valueƓAP[^Ŋmۂ.
  */
-Json::Json(int value) :m_impl(std::make_unique<Impl>(value)) {}
+Json::Json(Json::DoubleArray&& value) :m_type(Json::JSON_VALUE_TYPE::ARRAY)
+{
+  const Json::Allocator alloc(value.get_allocator());
+  m_value.m_heap = JsonValue::Create<JsonValueArray>(JsonSpan<double>(value.data(), value.size()), alloc);
+}
 
 /**
  * RXgN^
- * @param[in] value l(number^(double))
+ * @param[in] value l(array^̗vf. Snumber(double))
+ * @param[in] alloc mۂɎgpAP[^(ȗ̓q[v)
  */
-Json::Json(double value) :m_impl(std::make_unique<Impl>(value)) {}
+Json::Json(JsonSpan<double> value, const Json::Allocator& alloc) :m_type(Json::JSON_VALUE_TYPE::ARRAY)
+{
+  m_value.m_heap = JsonValue::Create<JsonValueArray>(value, alloc);
+}
 
 /**
  * RXgN^
- * @param[in] value l(bool^)
+ * @param[in] value l(array^, vf͑Snumber(int, int64))
+ * @param[in] alloc mۂɎgpAP[^(ȗ̓q[v)
+ * @remarks vfint64̘Ä̂܂ܕێ
  */
-Json::Json(bool value) :m_impl(std::make_unique<Impl>(value)) {}
+Json::Json(const Json::Int64Array& value, const Json::Allocator& alloc) :m_type(Json::JSON_VALUE_TYPE::ARRAY)
+{
+  m_value.m_heap = JsonValue::Create<JsonValueArray>(JsonSpan<std::int64_t>(value.data(), value.size()), alloc);
+}
+
+/**
+ * RXgN^([u)
+ * @param[in] value l(array^, vf͑Snumber(int, int64))
+ * @remarks vf͎̘̂ÄɃRs[. ̂valueƓAP[^Ŋmۂ.
+ */
+Json::Json(Json::Int64Array&& value) :m_type(Json::JSON_VALUE_TYPE::ARRAY)
+{
+  const Json::Allocator alloc(value.get_allocator());
+  m_value.m_heap = JsonValue::Create<JsonValueArray>(JsonSpan<std::int64_t>(value.data(), value.size()), alloc);
+}
 
 /**
  * RXgN^
- * @param[in] value l(array^)
+ * @param[in] value l(array^̗vf. Snumber(int, int64))
+ * @param[in] alloc mۂɎgpAP[^(ȗ̓q[v)
  */
-Json::Json(const Json::Array& value) :m_impl(std::make_unique<Impl>(value)) {}
+Json::Json(JsonSpan<std::int64_t> value, const Json::Allocator& alloc) :m_type(Json::JSON_VALUE_TYPE::ARRAY)
+{
+  m_value.m_heap = JsonValue::Create<JsonValueArray>(value, alloc);
+}
 
 /**
  * RXgN^
  * @param[in] value l(object^)
+ * @param[in] alloc mۂɎgpAP[^(ȗ̓q[v)
+ */
+Json::Json(const Json::Object& value, const Json::Allocator& alloc) :m_type(Json::JSON_VALUE_TYPE::OBJECT)
+{
+  m_value.m_heap = JsonValue::Create<JsonValueObject>(value, alloc);
+}
+
+/**
+ * RXgN^([u)
+ * @param[in] value l(object^)
+ * @remarks vf̓Rs[valueڂ. ̂valueƓAP[^Ŋmۂ.
  */
-Json::Json(const Json::Object& value) :m_impl(std::make_unique<Impl>(value)) {}
+Json::Json(Json::Object&& value) :m_type(Json::JSON_VALUE_TYPE::OBJECT)
+{
+  const Json::Allocator alloc(value.get_allocator());
+  m_value.m_heap = JsonValue::Create<JsonValueObject>(std::move(value), alloc);
+}
 
 /**
  * Rs[RXgN^
  * @param[in] obj Rs[
+ * @remarks string, array, object̎̂̓Rs[ƋL(ύX\ȎQƂԂarray, object̓Rs[)
  */
-Json::Json(const Json& obj) :m_impl(std::make_unique<Impl>(*(obj.m_impl)))
+Json::Json(const Json& obj) :m_type(obj.m_type), m_value(obj.m_value)
 {
+  if (!IsHeapType(m_type)) return;
+  // ύX\ȎQƂԂarray, object, QƂʂύXRs[ɋy΂Ȃ悤ɃRs[
+  if (m_value.m_heap->IsUnshareable())
+  {
+    m_type = Json::JSON_VALUE_TYPE::NUL;
+    m_value.m_heap = nullptr;
+    *this = obj.Clone();
+    return;
+  }
+  // q[v̒lłΎQƃJEg𑝂₷
+  m_value.m_heap->AddRef();
 }
 
 /**
  * [uRXgN^
  * @param[in] obj [uIuWFNg
+ * @remarks [unullɂȂ
  */
-Json::Json(Json&& obj) :m_impl(std::move(obj.m_impl)) {}
+Json::Json(Json&& obj) :m_type(obj.m_type), m_value(obj.m_value)
+{
+  obj.m_type = Json::JSON_VALUE_TYPE::NUL;
+  obj.m_value.m_heap = nullptr;
+}
 
 /**
  * 
  * @param[in] obj IuWFNg
+ * @remarks string, array, object̎̂͑ƋL
  */
 Json& Json::operator=(const Json& obj)
 {
-  *(this->m_impl) = *(obj.m_impl);
+  // ȑłSȂ悤, ɃRs[Ăւ
+  Json tmp(obj);
+  std::swap(m_type, tmp.m_type);
+  std::swap(m_value, tmp.m_value);
+  return *this;
+}
+
+/**
+ * [u
+ * @param[in] obj [uIuWFNg
+ * @remarks [unullɂȂ
+ */
+Json& Json::operator=(Json&& obj)
+{
+  // ւ, ̒lobjƈꏏɔj
+  Json tmp(std::move(obj));
+  std::swap(m_type, tmp.m_type);
+  std::swap(m_value, tmp.m_value);
   return *this;
 }
 
-/** zfXgN^ */
-Json::~Json() {}
+/** fXgN^ */
+Json::~Json()
+{
+  // q[v̒lłΎQƂO
+  if (IsHeapType(m_type)) JsonValue::Release(m_value.m_heap, m_type);
+}
 
 /**
  * ^擾
@@ -208,7 +312,7 @@ Json::~Json() {}
  */
 Json::JSON_VALUE_TYPE Json::GetValueType() const
 {
-  return m_impl->m_jsonValue->GetValueType();
+  return m_type;
 }
 
 /**
@@ -217,7 +321,7 @@ Json::JSON_VALUE_TYPE Json::GetValueType() const
  */
 bool Json::IsNull() const
 {
-  return m_impl->m_jsonValue->GetValueType() == Json::JSON_VALUE_TYPE::NUL;
+  return m_type == Json::JSON_VALUE_TYPE::NUL;
 }
 
 /**
@@ -226,17 +330,18 @@ bool Json::IsNull() const
  */
 bool Json::IsString() const
 {
-  return m_impl->m_jsonValue->GetValueType() == Json::JSON_VALUE_TYPE::STRING;
+  return m_type == Json::JSON_VALUE_TYPE::STRING;
 }
 
 /**
- * number(int or double)ǂ
+ * number(int, int64 or double)ǂ
  * @return numberȂtrue
  */
 bool Json::IsNumber() const
 {
-  Json::JSON_VALUE_TYPE type = m_impl->m_jsonValue->GetValueType();
-  return (type == Json::JSON_VALUE_TYPE::NUMBER_INT) || (type == Json::JSON_VALUE_TYPE::NUMBER_DOUBLE);
+  return (m_type == Json::JSON_VALUE_TYPE::NUMBER_INT)
+    || (m_type == Json::JSON_VALUE_TYPE::NUMBER_INT64)
+    || (m_type == Json::JSON_VALUE_TYPE::NUMBER_DOUBLE);
 }
 
 /**
@@ -245,7 +350,16 @@ bool Json::IsNumber() const
  */
 bool Json::IsNumberInt() const
 {
-  return m_impl->m_jsonValue->GetValueType() == Json::JSON_VALUE_TYPE::NUMBER_INT;
+  return m_type == Json::JSON_VALUE_TYPE::NUMBER_INT;
+}
+
+/**
+ * number(int64)ǂ
+ * @return number(int64)Ȃtrue
+ */
+bool Json::IsNumberInt64() const
+{
+  return m_type == Json::JSON_VALUE_TYPE::NUMBER_INT64;
 }
 
 /**
@@ -254,7 +368,7 @@ bool Json::IsNumberInt() const
  */
 bool Json::IsNumberDouble() const
 {
-  return m_impl->m_jsonValue->GetValueType() == Json::JSON_VALUE_TYPE::NUMBER_DOUBLE;
+  return m_type == Json::JSON_VALUE_TYPE::NUMBER_DOUBLE;
 }
 
 /**
@@ -263,7 +377,7 @@ bool Json::IsNumberDouble() const
  */
 bool Json::IsBool() const
 {
-  return m_impl->m_jsonValue->GetValueType() == Json::JSON_VALUE_TYPE::BOOL;
+  return m_type == Json::JSON_VALUE_TYPE::BOOL;
 }
 
 /**
@@ -272,7 +386,7 @@ bool Json::IsBool() const
  */
 bool Json::IsArray() const
 {
-  return m_impl->m_jsonValue->GetValueType() == Json::JSON_VALUE_TYPE::ARRAY;
+  return m_type == Json::JSON_VALUE_TYPE::ARRAY;
 }
 
 /**
@@ -281,7 +395,25 @@ bool Json::IsArray() const
  */
 bool Json::IsObject() const
 {
-  return m_impl->m_jsonValue->GetValueType() == Json::JSON_VALUE_TYPE::OBJECT;
+  return m_type == Json::JSON_VALUE_TYPE::OBJECT;
+}
+
+/**
+ * vfdouble̘ÄɕێĂarrayǂ
+ * @return vfSnumber(double)array, ÄɕێĂtrue
+ */
+bool Json::IsDoubleArray() const
+{
+  return m_type == Json::JSON_VALUE_TYPE::ARRAY && static_cast<const JsonValueArray*>(m_value.m_heap)->IsDoubleArray();
+}
+
+/**
+ * vfint64̘ÄɕێĂarrayǂ
+ * @return vfSnumber(int, int64)array, ÄɕێĂtrue
+ */
+bool Json::IsInt64Array() const
+{
+  return m_type == Json::JSON_VALUE_TYPE::ARRAY && static_cast<const JsonValueArray*>(m_value.m_heap)->IsInt64Array();
 }
 
 /**
@@ -290,7 +422,20 @@ bool Json::IsObject() const
  */
 const std::string& Json::GetString() const
 {
-  return m_impl->m_jsonValue->GetString();
+  // stringȊO͋󕶎Ԃ
+  if (m_type != Json::JSON_VALUE_TYPE::STRING) return JsonValue::DefaultString();
+  return static_cast<const JsonValueString*>(m_value.m_heap)->GetString();
+}
+
+/**
+ * stringl̎QƂget
+ * @return stringl̎Q(stringȊO͋󕶎)
+ */
+JsonStringView Json::GetStringView() const
+{
+  // stringȊO͋󕶎Ԃ
+  if (m_type != Json::JSON_VALUE_TYPE::STRING) return JsonStringView();
+  return static_cast<const JsonValueString*>(m_value.m_heap)->GetStringView();
 }
 
 /**
@@ -299,7 +444,24 @@ const std::string& Json::GetString() const
  */
 int Json::GetNumberInt() const
 {
-  return m_impl->m_jsonValue->GetNumberInt();
+  // intȊOint64, doubleϊ邩0Ԃ
+  if (m_type == Json::JSON_VALUE_TYPE::NUMBER_INT) return m_value.m_int;
+  if (m_type == Json::JSON_VALUE_TYPE::NUMBER_INT64) return static_cast<int>(m_value.m_int64);
+  if (m_type == Json::JSON_VALUE_TYPE::NUMBER_DOUBLE) return static_cast<int>(m_value.m_double);
+  return 0;
+}
+
+/**
+ * numberl(int64)get
+ * @return numberl(int64)
+ */
+std::int64_t Json::GetNumberInt64() const
+{
+  // int64ȊOint, doubleϊ邩0Ԃ
+  if (m_type == Json::JSON_VALUE_TYPE::NUMBER_INT64) return m_value.m_int64;
+  if (m_type == Json::JSON_VALUE_TYPE::NUMBER_INT) return m_value.m_int;
+  if (m_type == Json::JSON_VALUE_TYPE::NUMBER_DOUBLE) return static_cast<std::int64_t>(m_value.m_double);
+  return 0;
 }
 
 /**
@@ -308,7 +470,11 @@ int Json::GetNumberInt() const
  */
 double Json::GetNumberDouble() const
 {
-  return m_impl->m_jsonValue->GetNumberDouble();
+  // doubleȊOint, int64ϊ邩0.0Ԃ
+  if (m_type == Json::JSON_VALUE_TYPE::NUMBER_DOUBLE) return m_value.m_double;
+  if (m_type == Json::JSON_VALUE_TYPE::NUMBER_INT) return static_cast<double>(m_value.m_int);
+  if (m_type == Json::JSON_VALUE_TYPE::NUMBER_INT64) return static_cast<double>(m_value.m_int64);
+  return 0.0;
 }
 
 /**
@@ -317,7 +483,81 @@ double Json::GetNumberDouble() const
  */
 bool Json::GetBool() const
 {
-  return m_impl->m_jsonValue->GetBool();
+  // boolȊOfalseԂ
+  if (m_type != Json::JSON_VALUE_TYPE::BOOL) return false;
+  return m_value.m_bool;
+}
+
+/**
+ * array, object̒lRs[
+ * @return Rs[(Rs[ƓAP[^ō쐬)
+ * @remarks vf, o̒l̓Rs[ɋL(ύX鎞_, ꂼꂪ؂藣)
+ */
+Json Json::Clone() const
+{
+  Json copy;
+  if (m_type == Json::JSON_VALUE_TYPE::ARRAY)
+  {
+    const JsonValueArray* const array = static_cast<const JsonValueArray*>(m_value.m_heap);
+    if (this->IsDoubleArray()) copy = Json(array->GetDoubleSpan(), array->GetAllocator());
+    else if (this->IsInt64Array()) copy = Json(array->GetInt64Span(), array->GetAllocator());
+    else copy = Json(array->GetArray(), array->GetAllocator());
+  }
+  else
+  {
+    const JsonValueObject* const object = static_cast<const JsonValueObject*>(m_value.m_heap);
+    copy = Json(object->GetObject(), object->GetAllocator());
+  }
+  // p[Xʂ̍ŏʂ̒l̃Rs[, A[iL(Rs[jĂvfQƂł悤)
+  if (m_value.m_heap->IsArenaOwner()) JsonValue::OwnArena(copy);
+  return copy;
+}
+
+/**
+ * LĂl؂藣(JsonIuWFNgƋLĂ΃Rs[)
+ * @remarks vf, o̒l̓Rs[ɋL(ύX鎞_, ꂼꂪ؂藣)
+ */
+void Json::Detach()
+{
+  if (!m_value.m_heap->IsShared()) return;
+  // LĂl̎QƂO
+  *this = this->Clone();
+}
+
+/**
+ * ύXarrayl擾(LĂ΃Rs[)
+ * @return arrayl(arrayłȂnullptr)
+ * @remarks L֎~Ȃ, ύX̃Rs[͒lL
+ */
+Json::Array* Json::EditArray()
+{
+  if (m_type != Json::JSON_VALUE_TYPE::ARRAY) return nullptr;
+  this->Detach();
+  return &static_cast<JsonValueArray*>(m_value.m_heap)->GetArray();
+}
+
+/**
+ * ύXobjectl擾(LĂ΃Rs[)
+ * @return objectl(objectłȂnullptr)
+ * @remarks L֎~Ȃ, ύX̃Rs[͒lL
+ */
+Json::Object* Json::EditObject()
+{
+  if (m_type != Json::JSON_VALUE_TYPE::OBJECT) return nullptr;
+  this->Detach();
+  return &static_cast<JsonValueObject*>(m_value.m_heap)->GetObject();
+}
+
+/**
+ * l{IuWFNĝ݂QƂԂɂ(LĂ, ܂͕ύX\ȎQƂԂarray, object̓Rs[)
+ * @remarks vf, o̒l̓Rs[ɋL(Ăяołǂ)
+ */
+void Json::Isolate()
+{
+  if (m_type != Json::JSON_VALUE_TYPE::ARRAY && m_type != Json::JSON_VALUE_TYPE::OBJECT) return;
+  if (!m_value.m_heap->IsShared() && !m_value.m_heap->IsUnshareable()) return;
+  // Rs[͋L֎~ĂȂVlɂȂ(̒l̎QƂO)
+  *this = this->Clone();
 }
 
 /**
@@ -326,7 +566,13 @@ bool Json::GetBool() const
  */
 Json::Array& Json::GetArray()
 {
-  return m_impl->m_jsonValue->GetArray();
+  // arrayȊO͋vectorԂ
+  if (m_type != Json::JSON_VALUE_TYPE::ARRAY) return JsonValue::DefaultArray();
+  // ύX邽, LĂ΃Rs[
+  this->Detach();
+  // ԂQƂʂĕύX邽, ȍ~͋LȂ
+  m_value.m_heap->SetUnshareable();
+  return static_cast<JsonValueArray*>(m_value.m_heap)->GetArray();
 }
 
 /**
@@ -335,7 +581,31 @@ Json::Array& Json::GetArray()
  */
 const Json::Array& Json::GetArray() const
 {
-  return m_impl->m_jsonValue->GetArray();
+  // arrayȊO͋vectorԂ
+  if (m_type != Json::JSON_VALUE_TYPE::ARRAY) return JsonValue::DefaultConstArray();
+  return static_cast<const JsonValueArray*>(m_value.m_heap)->GetArray();
+}
+
+/**
+ * arrayl(double̘Ä)get
+ * @return vf̎Q(IsDoubleArrayłȂ΋)
+ */
+JsonSpan<double> Json::GetDoubleSpan() const
+{
+  // double̘ÄɕێĂarrayȊO͋Ԃ
+  if (!this->IsDoubleArray()) return JsonSpan<double>();
+  return static_cast<const JsonValueArray*>(m_value.m_heap)->GetDoubleSpan();
+}
+
+/**
+ * arrayl(int64̘Ä)get
+ * @return vf̎Q(IsInt64ArrayłȂ΋)
+ */
+JsonSpan<std::int64_t> Json::GetInt64Span() const
+{
+  // int64̘ÄɕێĂarrayȊO͋Ԃ
+  if (!this->IsInt64Array()) return JsonSpan<std::int64_t>();
+  return static_cast<const JsonValueArray*>(m_value.m_heap)->GetInt64Span();
 }
 
 /**
@@ -344,7 +614,13 @@ const Json::Array& Json::GetArray() const
  */
 Json::Object& Json::GetObject()
 {
-  return m_impl->m_jsonValue->GetObject();
+  // objectȊO͋mapԂ
+  if (m_type != Json::JSON_VALUE_TYPE::OBJECT) return JsonValue::DefaultObject();
+  // ύX邽, LĂ΃Rs[
+  this->Detach();
+  // ԂQƂʂĕύX邽, ȍ~͋LȂ
+  m_value.m_heap->SetUnshareable();
+  return static_cast<JsonValueObject*>(m_value.m_heap)->GetObject();
 }
 
 /**
@@ -353,7 +629,157 @@ Json::Object& Json::GetObject()
  */
 const Json::Object& Json::GetObject() const
 {
-  return m_impl->m_jsonValue->GetObject();
+  // objectȊO͋mapԂ
+  if (m_type != Json::JSON_VALUE_TYPE::OBJECT) return JsonValue::DefaultConstObject();
+  return static_cast<const JsonValueObject*>(m_value.m_heap)->GetObject();
+}
+
+/**
+ * objectnameɑΉl
+ * @param[in] name name
+ * @return l(objectłȂ, ܂namenullptr)
+ */
+const Json* Json::Find(const std::string& name) const
+{
+  if (m_type != Json::JSON_VALUE_TYPE::OBJECT) return nullptr;
+  const Json::Object& object = static_cast<const JsonValueObject*>(m_value.m_heap)->GetObject();
+  // JsonKey쐬Ɍ
+  const auto it = object.find(name);
+  return (it != object.end()) ? &it->second : nullptr;
+}
+
+/**
+ * objectnameɑΉl(C)
+ * @param[in] name name
+ * @return l(objectłȂ, ܂namenullptr)
+ */
+const Json* Json::Find(const char* name) const
+{
+  if (m_type != Json::JSON_VALUE_TYPE::OBJECT) return nullptr;
+  const Json::Object& object = static_cast<const JsonValueObject*>(m_value.m_heap)->GetObject();
+  // JsonKey쐬Ɍ
+  const auto it = object.find(name);
+  return (it != object.end()) ? &it->second : nullptr;
+}
+
+/**
+ * objectnameɑΉl(JsonKey)
+ * @param[in] name name
+ * @return l(objectłȂ, ܂namenullptr)
+ */
+const Json* Json::Find(const JsonKey& name) const
+{
+  if (m_type != Json::JSON_VALUE_TYPE::OBJECT) return nullptr;
+  const Json::Object& object = static_cast<const JsonValueObject*>(m_value.m_heap)->GetObject();
+  const auto it = object.find(name);
+  return (it != object.end()) ? &it->second : nullptr;
+}
+
+/**
+ * objectnameɑΉl擾
+ * @param[in] name name
+ * @return l(objectłȂ, ܂name΋Lnull)
+ */
+const Json& Json::At(const std::string& name) const
+{
+  const Json* const value = this->Find(name);
+  return (value != nullptr) ? *value : JsonValue::DefaultNull();
+}
+
+/**
+ * objectnameɑΉl擾(C)
+ * @param[in] name name
+ * @return l(objectłȂ, ܂name΋Lnull)
+ */
+const Json& Json::At(const char* name) const
+{
+  const Json* const value = this->Find(name);
+  return (value != nullptr) ? *value : JsonValue::DefaultNull();
+}
+
+/**
+ * objectnameɑΉl擾(JsonKey)
+ * @param[in] name name
+ * @return l(objectłȂ, ܂name΋Lnull)
+ */
+const Json& Json::At(const JsonKey& name) const
+{
+  const Json* const value = this->Find(name);
+  return (value != nullptr) ? *value : JsonValue::DefaultNull();
+}
+
+/**
+ * objectnameɒlݒ肷
+ * @param[in] name  name
+ * @param[in] value l(nameΒǉ)
+ * @return objectłtrue(objectȊO͕ύXȂ)
+ */
+bool Json::Set(const std::string& name, Json value)
+{
+  Json::Object* const object = this->EditObject();
+  if (object == nullptr) return false;
+  (*object)[name] = std::move(value);
+  return true;
+}
+
+/**
+ * objectnameɒlݒ肷(C)
+ * @param[in] name  name
+ * @param[in] value l(nameΒǉ)
+ * @return objectłtrue(objectȊO͕ύXȂ)
+ */
+bool Json::Set(const char* name, Json value)
+{
+  Json::Object* const object = this->EditObject();
+  if (object == nullptr) return false;
+  (*object)[name] = std::move(value);
+  return true;
+}
+
+/**
+ * objectname폜
+ * @param[in] name name
+ * @return 폜true(objectłȂ, ܂nameΕύXȂ)
+ */
+bool Json::Erase(const std::string& name)
+{
+  // name΃Rs[Ȃ
+  if (this->Find(name) == nullptr) return false;
+  return this->EditObject()->erase(name) != 0;
+}
+
+/**
+ * objectname폜(C)
+ * @param[in] name name
+ * @return 폜true(objectłȂ, ܂nameΕύXȂ)
+ */
+bool Json::Erase(const char* name)
+{
+  // name΃Rs[Ȃ
+  if (this->Find(name) == nullptr) return false;
+  return this->EditObject()->erase(name) != 0;
+}
+
+/**
+ * array̖ɗvfǉ
+ * @param[in] value vf
+ * @return arrayłtrue(arrayȊO͕ύXȂ)
+ */
+bool Json::Append(Json value)
+{
+  Json::Array* const array = this->EditArray();
+  if (array == nullptr) return false;
+  array->push_back(std::move(value));
+  return true;
+}
+
+/**
+ * (ύXłȂJsonhLgɂ)
+ * @return JsonhLg({IuWFNg̒lڂ)
+ */
+JsonDocument Json::Freeze()
+{
+  return JsonDocument(std::move(*this));
 }
 
 /**
@@ -362,7 +788,20 @@ const Json::Object& Json::GetObject() const
  */
 void Json::Dump(std::ostream* outStream) const
 {
-  m_impl->m_jsonValue->Dump(outStream);
+  JsonStreamSink sink(outStream);
+  this->Dump(&sink);
+}
+
+/**
+ * JSON`̕o
+ * @param[in,out] sink o͐
+ */
+void Json::Dump(JsonSink* sink) const
+{
+  // obt@ɂ܂Ƃ߂ďo͂, Ō1xo͐ɔf
+  JsonWriter writer(sink);
+  writer.Write(*this);
+  writer.Flush();
 }
 
 /**
@@ -371,6 +810,34 @@ void Json::Dump(std::ostream* outStream) const
  */
 void Json::DumpMsgpack(std::ostream* outStream) const
 {
-  m_impl->m_jsonValue->DumpMsgpack(outStream);
+  // ^ɉďo
+  switch (m_type)
+  {
+    case Json::JSON_VALUE_TYPE::STRING:
+      static_cast<const JsonValueString*>(m_value.m_heap)->DumpMsgpack(outStream);
+      break;
+    case Json::JSON_VALUE_TYPE::NUMBER_INT:
+      msgpack::pack(outStream, m_value.m_int);
+      break;
+    case Json::JSON_VALUE_TYPE::NUMBER_INT64:
+      // lɉčŏ̃tH[}bg(fixint, int8 ~ int64, uint8 ~ uint64)ŏo͂
+      msgpack::pack(outStream, m_value.m_int64);
+      break;
+    case Json::JSON_VALUE_TYPE::NUMBER_DOUBLE:
+      msgpack::pack(outStream, m_value.m_double);
+      break;
+    case Json::JSON_VALUE_TYPE::BOOL:
+      msgpack::pack(outStream, m_value.m_bool);
+      break;
+    case Json::JSON_VALUE_TYPE::ARRAY:
+      static_cast<const JsonValueArray*>(m_value.m_heap)->DumpMsgpack(outStream);
+      break;
+    case Json::JSON_VALUE_TYPE::OBJECT:
+      static_cast<const JsonValueObject*>(m_value.m_heap)->DumpMsgpack(outStream);
+      break;
+    default:
+      msgpack::pack(outStream, msgpack::type::nil());
+      break;
+  }
 }
 }
@@ -0,0 +1,253 @@
+/**
+ * @file   JsonArena.cpp
+ * @brief  JSONIuWFNgpA[i
+ * @author kyo
+ * @date   2026/10/17
+ */
+#include "JsonArena.h"
+#include <atomic>
+#include <memory>
+#include <utility>
+#include <vector>
+#include <cstdint>
+
+/** Analysis Drive */
+namespace adlib
+{
+//! PimplCfBI
+class JsonArena::Impl
+{
+public:
+  //! ftHg̃ubNTCY(byte)
+  static const size_t DEFAULT_BLOCK_SIZE;
+  //! ubNTCY̏(byte)
+  static const size_t MAX_BLOCK_SIZE;
+  //! p̃ubNɊmۂTCỶ(byte)
+  static const size_t LARGE_SIZE;
+
+  //! mۂubN
+  std::vector<std::unique_ptr<char[]>> m_blocks;
+  //! A[iƈꏏɕێ郊\[X
+  std::vector<std::shared_ptr<void>> m_resources;
+  //! ɊmۂubÑTCY
+  size_t m_nextBlockSize;
+  //! ݂̃ubN̖gp̈̐擪
+  char* m_cursor;
+  //! ݂̃ubN̏I[
+  char* m_end;
+  //! AllocateŐ؂oTCY̍v
+  size_t m_usedSize;
+  //! mۂubÑTCY̍v
+  size_t m_reservedSize;
+  //! L҂̐(CreateSharedō쐬ꍇ̂ݎgp)
+  std::atomic<long> m_ownerCount;
+
+  /**
+   * RXgN^
+   * @param[in] blockSize ŏɊmۂubÑTCY
+   */
+  explicit Impl(size_t blockSize)
+    :m_nextBlockSize(blockSize > 0 ? blockSize : DEFAULT_BLOCK_SIZE),
+     m_cursor(nullptr),
+     m_end(nullptr),
+     m_usedSize(0),
+     m_reservedSize(0),
+     m_ownerCount(0)
+  {
+  }
+
+  /**
+   * VubNmۂ
+   * @param[in] minSize ŒKvȃTCY
+   */
+  void AddBlock(size_t minSize);
+
+  /**
+   * p̃ubNmۂ
+   * @param[in] size mۂTCY
+   * @return ubN̐擪
+   */
+  char* AddLargeBlock(size_t size);
+};
+
+//! ftHg̃ubNTCY(byte)
+const size_t JsonArena::Impl::DEFAULT_BLOCK_SIZE = 64 * 1024;
+//! ubNTCY̏(byte)
+const size_t JsonArena::Impl::MAX_BLOCK_SIZE = 16 * 1024 * 1024;
+//! p̃ubNɊmۂTCỶ(byte)
+const size_t JsonArena::Impl::LARGE_SIZE = 16 * 1024;
+
+/**
+ * VubNmۂ
+ * @param[in] minSize ŒKvȃTCY
+ * @remarks ubNTCY͏܂Ŕ{Xɑ₷(ubN}邽)
+ */
+void JsonArena::Impl::AddBlock(size_t minSize)
+{
+  // mۂTCY
+  size_t size = m_nextBlockSize;
+  if (size < minSize) size = minSize;
+  // ubNm
+  m_blocks.emplace_back(new char[size]);
+  m_cursor = m_blocks.back().get();
+  m_end = m_cursor + size;
+  m_reservedSize += size;
+  // ̃ubNTCYXV
+  if (m_nextBlockSize < MAX_BLOCK_SIZE) m_nextBlockSize *= 2;
+}
+
+/**
+ * p̃ubNmۂ
+ * @param[in] size mۂTCY
+ * @return ubN̐擪
+ * @remarks ݂̃ubN()̑Oɒǉ, ݂̃ubN̎c͈gp
+ */
+char* JsonArena::Impl::AddLargeBlock(size_t size)
+{
+  std::unique_ptr<char[]> block(new char[size]);
+  char* const head = block.get();
+  m_blocks.emplace(m_blocks.end() - 1, std::move(block));
+  m_reservedSize += size;
+  return head;
+}
+
+/** RXgN^ */
+JsonArena::JsonArena()
+  :m_impl(std::make_unique<Impl>(Impl::DEFAULT_BLOCK_SIZE))
+{
+}
+
+/**
+ * RXgN^
+ * @param[in] blockSize ŏɊmۂubÑTCY(byte)
+ */
+JsonArena::JsonArena(size_t blockSize)
+  :m_impl(std::make_unique<Impl>(blockSize))
+{
+}
+
+/** zfXgN^ */
+JsonArena::~JsonArena() {}
+
+/**
+ * L҂𐔂A[i쐬
+ * @return A[i(L҂1lƂĎQƂ. QƂSĊOꂽ, ̏L҂ȂȂ_Ŕj)
+ */
+std::shared_ptr<JsonArena> JsonArena::CreateShared()
+{
+  JsonArena* const arena = new JsonArena();
+  arena->AddOwner();
+  // shared_ptr̍쐬Ɏsꍇ폜qŏL҂O(Ō̏L҂̂ߔj)
+  return std::shared_ptr<JsonArena>(arena, &JsonArena::ReleaseOwner);
+}
+
+/**
+ * L҂ǉ
+ */
+void JsonArena::AddOwner()
+{
+  m_impl->m_ownerCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+/**
+ * L҂O(Ō̏L҂ł΃A[ij)
+ * @param[in] arena A[i(CreateSharedō쐬)
+ */
+void JsonArena::ReleaseOwner(JsonArena* arena)
+{
+  if (arena->m_impl->m_ownerCount.fetch_sub(1, std::memory_order_acq_rel) == 1) delete arena;
+}
+
+/**
+ * L҂̐擾
+ * @return L҂̐
+ */
+long JsonArena::OwnerCount() const
+{
+  return m_impl->m_ownerCount.load(std::memory_order_acquire);
+}
+
+/**
+ * mۂ
+ * @param[in] size      mۂTCY(byte)
+ * @param[in] alignment ACg(2ׂ̂)
+ * @return mۂ̈̐擪
+ */
+void* JsonArena::Allocate(size_t size, size_t alignment)
+{
+  // ACg킹擪߂
+  uintptr_t address = reinterpret_cast<uintptr_t>(m_impl->m_cursor);
+  uintptr_t aligned = (address + (alignment - 1)) & ~static_cast<uintptr_t>(alignment - 1);
+  // ݂̃ubNɎ܂ȂΐVubNmۂ
+  if (m_impl->m_cursor == nullptr
+    || aligned + size > reinterpret_cast<uintptr_t>(m_impl->m_end))
+  {
+    // 傫ȗ̈͐p̃ubNɊmۂ(݂̃ubN̎ĉĂȂ)
+    if (m_impl->m_cursor != nullptr && size >= Impl::LARGE_SIZE)
+    {
+      address = reinterpret_cast<uintptr_t>(m_impl->AddLargeBlock(size + alignment));
+      aligned = (address + (alignment - 1)) & ~static_cast<uintptr_t>(alignment - 1);
+      m_impl->m_usedSize += size;
+      return reinterpret_cast<void*>(aligned);
+    }
+    m_impl->AddBlock(size + alignment);
+    address = reinterpret_cast<uintptr_t>(m_impl->m_cursor);
+    aligned = (address + (alignment - 1)) & ~static_cast<uintptr_t>(alignment - 1);
+  }
+  // ؂oăJ[\i߂
+  m_impl->m_cursor = reinterpret_cast<char*>(aligned + size);
+  m_impl->m_usedSize += size;
+  return reinterpret_cast<void*>(aligned);
+}
+
+/**
+ * \[XA[iƈꏏɕێ
+ * @param[in] resource ێ郊\[X
+ */
+void JsonArena::Retain(const std::shared_ptr<void>& resource)
+{
+  m_impl->m_resources.emplace_back(resource);
+}
+
+/**
+ * mۂ̈SĖgpɖ߂
+ * @remarks ŌɊmۂubN(ő̃ubN)݂̂cčėp, ێĂ\[X
+ */
+void JsonArena::Reset()
+{
+  // ێĂ\[X
+  m_impl->m_resources.clear();
+  // ubNΉȂ
+  if (m_impl->m_blocks.empty()) return;
+
+  // ŌɊmۂubN(݂̃ubN)̂ݎc
+  if (m_impl->m_blocks.size() > 1)
+  {
+    std::unique_ptr<char[]> last(std::move(m_impl->m_blocks.back()));
+    m_impl->m_blocks.clear();
+    m_impl->m_blocks.emplace_back(std::move(last));
+  }
+  // ubN̐擪ɖ߂
+  m_impl->m_cursor = m_impl->m_blocks.back().get();
+  m_impl->m_usedSize = 0;
+  m_impl->m_reservedSize = static_cast<size_t>(m_impl->m_end - m_impl->m_cursor);
+}
+
+/**
+ * mۍς݂̃TCY擾
+ * @return AllocateŐ؂oTCY̍v(byte)
+ */
+size_t JsonArena::UsedSize() const
+{
+  return m_impl->m_usedSize;
+}
+
+/**
+ * \ς݂̃TCY擾
+ * @return mۂubÑTCY̍v(byte)
+ */
+size_t JsonArena::ReservedSize() const
+{
+  return m_impl->m_reservedSize;
+}
+}
@@ -0,0 +1,284 @@
+/**
+ * @file   JsonArrayBuilder.cpp
+ * @brief  p[Xarray̍쐬
+ * @author kyo
+ * @date   2026/10/17
+ */
+#include "JsonArrayBuilder.h"
+#include "Json.h"
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+/** Analysis Drive */
+namespace adlib
+{
+namespace
+{
+/**
+ * Ɨ̗̈eʂmۂ
+ * @param[in,out] stack Ɨ̈
+ * @param[in]     n     Kvȗvf
+ * @remarks qarrayƂɗ\񂵂ĂĊmۂJԂȂ悤, eʂ͔{Xɑ₷
+ */
+template <class T>
+void ReserveStack(std::vector<T>* stack, size_t n)
+{
+  if (n > stack->capacity()) stack->reserve(std::max(n, stack->capacity() * 2));
+}
+
+/**
+ * JsonIuWFNg쐬
+ * @param[in] number 
+ * @return int^͈͓̔łnumber(int), ȊOnumber(int64)
+ */
+Json MakeInteger(std::int64_t number)
+{
+  if (number >= INT_MIN && number <= INT_MAX) return Json(static_cast<int>(number));
+  return Json(number);
+}
+}
+
+/** ςłvfSĔj(eʂ͕ێ) */
+void JsonArrayBuilder::Stack::Clear()
+{
+  values.clear();
+  doubles.clear();
+  int64s.clear();
+}
+
+/**
+ * RXgN^
+ * @attention Ɨ̈Ȃ, Ɨ̈w肵IuWFNgĂgp邱
+ */
+JsonArrayBuilder::JsonArrayBuilder()
+  :m_state(STATE_EMPTY),
+   m_reserve(0),
+   m_stack(nullptr),
+   m_begin(0)
+{
+}
+
+/**
+ * RXgN^
+ * @param[in] alloc 쐬arraẙmۂɎgpAP[^
+ * @param[in] stack vfςލƗ̈
+ */
+JsonArrayBuilder::JsonArrayBuilder(const Json::Allocator& alloc, Stack* stack)
+  :m_state(STATE_EMPTY),
+   m_reserve(0),
+   m_allocator(alloc),
+   m_stack(stack),
+   m_begin(0)
+{
+}
+
+/**
+ * vf\񂷂
+ * @param[in] n vf
+ */
+void JsonArrayBuilder::Reserve(size_t n)
+{
+  switch (m_state)
+  {
+    case STATE_DOUBLE:
+      ReserveStack(&m_stack->doubles, m_begin + n);
+      break;
+    case STATE_INT64:
+      ReserveStack(&m_stack->int64s, m_begin + n);
+      break;
+    case STATE_JSON:
+      ReserveStack(&m_stack->values, m_begin + n);
+      break;
+    default:
+      // ێ`܂_Ŋmۂ
+      m_reserve = n;
+      break;
+  }
+}
+
+/**
+ * ێ`߂, Ɨ̈ł̐擪̈ʒuL^
+ * @param[in] state ێ`
+ */
+void JsonArrayBuilder::Start(STATE state)
+{
+  m_state = state;
+  switch (state)
+  {
+    case STATE_DOUBLE:
+      m_begin = m_stack->doubles.size();
+      break;
+    case STATE_INT64:
+      m_begin = m_stack->int64s.size();
+      break;
+    default:
+      m_begin = m_stack->values.size();
+      break;
+  }
+  this->Reserve(m_reserve);
+}
+
+/**
+ * ɗvfǉ
+ * @param[in] value vf([u)
+ */
+void JsonArrayBuilder::Append(Json&& value)
+{
+  const Json::JSON_VALUE_TYPE type = value.GetValueType();
+
+  // ŏ̗vfŕێ`߂
+  if (m_state == STATE_EMPTY)
+  {
+    if (type == Json::JSON_VALUE_TYPE::NUMBER_DOUBLE)
+    {
+      this->Start(STATE_DOUBLE);
+    }
+    else if (type == Json::JSON_VALUE_TYPE::NUMBER_INT || type == Json::JSON_VALUE_TYPE::NUMBER_INT64)
+    {
+      this->Start(STATE_INT64);
+    }
+    else
+    {
+      this->Start(STATE_JSON);
+    }
+  }
+
+  // ÄɒǉłvfłΒǉ
+  if (m_state == STATE_DOUBLE && type == Json::JSON_VALUE_TYPE::NUMBER_DOUBLE)
+  {
+    m_stack->doubles.push_back(value.GetNumberDouble());
+    return;
+  }
+  if (m_state == STATE_INT64 && (type == Json::JSON_VALUE_TYPE::NUMBER_INT || type == Json::JSON_VALUE_TYPE::NUMBER_INT64))
+  {
+    m_stack->int64s.push_back(value.GetNumberInt64());
+    return;
+  }
+
+  // ȊOJsonIuWFNgarrayɒǉ
+  if (m_state != STATE_JSON) this->ToJsonArray();
+  m_stack->values.emplace_back(std::move(value));
+}
+
+/**
+ * ɕʂarray̗vfSĒǉ
+ * @param[in,out] array ǉarray^JsonIuWFNg(vf[u)
+ */
+void JsonArrayBuilder::AppendElements(Json* array)
+{
+  // Äł΂܂Ƃ߂Ēǉ
+  if (array->IsDoubleArray())
+  {
+    const JsonSpan<double> numbers = array->GetDoubleSpan();
+    if (m_state == STATE_EMPTY) this->Start(STATE_DOUBLE);
+    if (m_state == STATE_DOUBLE)
+    {
+      m_stack->doubles.insert(m_stack->doubles.end(), numbers.begin(), numbers.end());
+      return;
+    }
+    for (const double number : numbers) this->Append(Json(number));
+    return;
+  }
+  if (array->IsInt64Array())
+  {
+    const JsonSpan<std::int64_t> numbers = array->GetInt64Span();
+    if (m_state == STATE_EMPTY) this->Start(STATE_INT64);
+    if (m_state == STATE_INT64)
+    {
+      m_stack->int64s.insert(m_stack->int64s.end(), numbers.begin(), numbers.end());
+      return;
+    }
+    for (const std::int64_t number : numbers) this->Append(MakeInteger(number));
+    return;
+  }
+
+  // ȊO͗vfƂɒǉ(ǉarray͑ƋLĂȂ, vf[u)
+  Json::Array& values = array->GetArray();
+  for (auto& value : values) this->Append(std::move(value));
+}
+
+/**
+ * vf擾
+ * @return vf
+ */
+size_t JsonArrayBuilder::Size() const
+{
+  switch (m_state)
+  {
+    case STATE_DOUBLE:
+      return m_stack->doubles.size() - m_begin;
+    case STATE_INT64:
+      return m_stack->int64s.size() - m_begin;
+    case STATE_JSON:
+      return m_stack->values.size() - m_begin;
+    default:
+      return 0;
+  }
+}
+
+/**
+ * array쐬
+ * @return array^JsonIuWFNg(vf͈ڂ, {IuWFNg͋ɂȂ)
+ * @remarks Ɨ̈ɐς񂾗vf, vf傤ǂ̗̈Ɉڂ
+ */
+Json JsonArrayBuilder::Build()
+{
+  const STATE state = m_state;
+  m_state = STATE_EMPTY;
+  m_reserve = 0;
+  switch (state)
+  {
+    case STATE_DOUBLE:
+    {
+      std::vector<double>& stack = m_stack->doubles;
+      Json numbers(JsonSpan<double>(stack.data() + m_begin, stack.size() - m_begin), m_allocator);
+      stack.resize(m_begin);
+      return numbers;
+    }
+    case STATE_INT64:
+    {
+      std::vector<std::int64_t>& stack = m_stack->int64s;
+      Json numbers(JsonSpan<std::int64_t>(stack.data() + m_begin, stack.size() - m_begin), m_allocator);
+      stack.resize(m_begin);
+      return numbers;
+    }
+    case STATE_JSON:
+    {
+      std::vector<Json>& stack = m_stack->values;
+      Json::Array values(std::make_move_iterator(stack.begin() + m_begin), std::make_move_iterator(stack.end()), m_allocator);
+      stack.erase(stack.begin() + m_begin, stack.end());
+      return Json(std::move(values));
+    }
+    default:
+      return Json(Json::Array(m_allocator));
+  }
+}
+
+/** JsonIuWFNgarrayɐ؂ւ(Ä̗vfڂ) */
+void JsonArrayBuilder::ToJsonArray()
+{
+  std::vector<Json>& values = m_stack->values;
+  const size_t begin = values.size();
+  if (m_state == STATE_DOUBLE)
+  {
+    std::vector<double>& doubles = m_stack->doubles;
+    ReserveStack(&values, begin + std::max(m_reserve, doubles.size() - m_begin + 1));
+    for (size_t i = m_begin; i < doubles.size(); ++i) values.emplace_back(doubles[i]);
+    doubles.resize(m_begin);
+  }
+  else if (m_state == STATE_INT64)
+  {
+    // int^͈͓̔łnumber(int), ȊOnumber(int64)
+    std::vector<std::int64_t>& int64s = m_stack->int64s;
+    ReserveStack(&values, begin + std::max(m_reserve, int64s.size() - m_begin + 1));
+    for (size_t i = m_begin; i < int64s.size(); ++i) values.emplace_back(MakeInteger(int64s[i]));
+    int64s.resize(m_begin);
+  }
+  m_state = STATE_JSON;
+  m_begin = begin;
+}
+}
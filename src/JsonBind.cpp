@@ -0,0 +1,34 @@
+/**
+ * @file   JsonBind.cpp
+ * @brief  JSONC++̌^̑Ήt
+ * @author kyo
+ * @date   2026/10/17
+ */
+#include "JsonBind.h"
+#include <cstdint>
+#include <string>
+
+/** Analysis Drive */
+namespace adlib
+{
+// ֐e[u(bool)
+const JsonBindOps JsonBindTraits<bool>::OPS =
+  { "bool", &JsonBindTraits<bool>::SetBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr };
+// ֐e[u(int)
+const JsonBindOps JsonBindTraits<int>::OPS =
+  { "int", nullptr, &JsonBindTraits<int>::SetInt, nullptr, nullptr, nullptr, nullptr, nullptr };
+// ֐e[u(int64)
+const JsonBindOps JsonBindTraits<std::int64_t>::OPS =
+  { "int64", nullptr, &JsonBindTraits<std::int64_t>::SetInt, nullptr, nullptr, nullptr, nullptr, nullptr };
+// ֐e[u(double)
+const JsonBindOps JsonBindTraits<double>::OPS =
+  { "double", nullptr, &JsonBindTraits<double>::SetInt, &JsonBindTraits<double>::SetDouble,
+    nullptr, nullptr, nullptr, nullptr };
+// ֐e[u(float)
+const JsonBindOps JsonBindTraits<float>::OPS =
+  { "float", nullptr, &JsonBindTraits<float>::SetInt, &JsonBindTraits<float>::SetDouble,
+    nullptr, nullptr, nullptr, nullptr };
+// ֐e[u(std::string)
+const JsonBindOps JsonBindTraits<std::string>::OPS =
+  { "string", nullptr, nullptr, nullptr, &JsonBindTraits<std::string>::SetString, nullptr, nullptr, nullptr };
+}
@@ -0,0 +1,281 @@
+/**
+ * @file   JsonBindHandler.cpp
+ * @brief  p[XCxg\̂Ɋi[nh
+ * @author kyo
+ * @date   2026/10/17
+ */
+#include "JsonBindHandler.h"
+#include "JsonBind.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/** Analysis Drive */
+namespace adlib
+{
+//> G[bZ[Wi[obt@TCY
+const size_t JsonBindHandler::BUFFER_SIZE = 256;
+//> G[bZ[W --- ľ^i[̌^ƈvȂ
+const std::string JsonBindHandler::ERR_MSG_TYPE_MISMATCH("\"%s\" is not %s Type.");
+//> G[bZ[W --- number^i[̌^͈̔͊O̒l
+const std::string JsonBindHandler::ERR_MSG_OUT_OF_RANGE("\"%s\" is out of %s Range.");
+
+/**
+ * RXgN^
+ * @param[in] root ŏʂ̊i[
+ */
+JsonBindHandler::JsonBindHandler(const JsonBindTarget& root)
+  :m_root(root),
+   m_fieldTarget(nullptr),
+   m_fieldOps(nullptr),
+   m_skipDepth(0)
+{
+}
+
+/** fXgN^ */
+JsonBindHandler::~JsonBindHandler() {}
+
+/**
+ * ̒l̊i[擾
+ * @param[out] ops i[
+ * @return i[(ǂݔ΂ꍇnullptr)
+ * @remarks array̗vf̏ꍇ, ŗvfǉ
+ */
+void* JsonBindHandler::NextTarget(const JsonBindOps** ops)
+{
+  // ǂݔ΂
+  if (m_skipDepth > 0) return nullptr;
+
+  // ŏʂ̒l
+  if (m_stack.empty())
+  {
+    *ops = &m_root.Ops();
+    return m_root.Target();
+  }
+
+  // array̗vf(ɒǉ)
+  Frame& frame = m_stack.back();
+  if (frame.isArray)
+  {
+    ++frame.count;
+    return frame.ops->appendElement(frame.target, ops);
+  }
+
+  // object̃o(KeyŐݒς)
+  *ops = m_fieldOps;
+  return m_fieldTarget;
+}
+
+/**
+ * i[̒l̃pX쐬
+ * @return pX(u$.node[3].coordv̌`)
+ */
+std::string JsonBindHandler::MakePath() const
+{
+  std::string path("$");
+  for (const auto& frame : m_stack)
+  {
+    if (frame.isArray)
+    {
+      path += '[';
+      path += std::to_string(frame.count - 1);
+      path += ']';
+    }
+    else if (frame.name != nullptr)
+    {
+      path += '.';
+      path += frame.name;
+    }
+  }
+  return path;
+}
+
+/**
+ * G[bZ[Wi[
+ * @param[in] messageTemp G[bZ[W
+ * @param[in] typeName    i[̌^̖O
+ * @return false(p[X𒆒f)
+ */
+bool JsonBindHandler::SetError(const std::string& messageTemp, const char* typeName)
+{
+  // obt@p
+  char buf[JsonBindHandler::BUFFER_SIZE];
+  // G[bZ[W쐬
+  sprintf_s(buf, sizeof(buf), messageTemp.c_str(), this->MakePath().c_str(), typeName);
+  m_errorMsg = buf;
+  return false;
+}
+
+/**
+ * nullǂݍ
+ * @return p[X𑱂ꍇtrue
+ * @remarks i[ɏl̂܂܂Ƃ(array̗vf̏ꍇ͏l̗vfǉ)
+ */
+bool JsonBindHandler::Null()
+{
+  const JsonBindOps* ops = nullptr;
+  this->NextTarget(&ops);
+  return true;
+}
+
+/**
+ * boollǂݍ
+ * @param[in] value l
+ * @return p[X𑱂ꍇtrue
+ */
+bool JsonBindHandler::Bool(bool value)
+{
+  const JsonBindOps* ops = nullptr;
+  void* const target = this->NextTarget(&ops);
+  if (target == nullptr) return true;
+  if (ops->setBool == nullptr) return this->SetError(JsonBindHandler::ERR_MSG_TYPE_MISMATCH, ops->typeName);
+  ops->setBool(target, value);
+  return true;
+}
+
+/**
+ * numberl(int)ǂݍ
+ * @param[in] value l
+ * @return p[X𑱂ꍇtrue
+ */
+bool JsonBindHandler::Int(int value)
+{
+  return this->Int64(value);
+}
+
+/**
+ * numberl(int64)ǂݍ
+ * @param[in] value l
+ * @return p[X𑱂ꍇtrue
+ */
+bool JsonBindHandler::Int64(std::int64_t value)
+{
+  const JsonBindOps* ops = nullptr;
+  void* const target = this->NextTarget(&ops);
+  if (target == nullptr) return true;
+  if (ops->setInt == nullptr) return this->SetError(JsonBindHandler::ERR_MSG_TYPE_MISMATCH, ops->typeName);
+  if (!ops->setInt(target, value)) return this->SetError(JsonBindHandler::ERR_MSG_OUT_OF_RANGE, ops->typeName);
+  return true;
+}
+
+/**
+ * numberl(double)ǂݍ
+ * @param[in] value l
+ * @return p[X𑱂ꍇtrue
+ */
+bool JsonBindHandler::Double(double value)
+{
+  const JsonBindOps* ops = nullptr;
+  void* const target = this->NextTarget(&ops);
+  if (target == nullptr) return true;
+  if (ops->setDouble == nullptr) return this->SetError(JsonBindHandler::ERR_MSG_TYPE_MISMATCH, ops->typeName);
+  if (!ops->setDouble(target, value)) return this->SetError(JsonBindHandler::ERR_MSG_OUT_OF_RANGE, ops->typeName);
+  return true;
+}
+
+/**
+ * stringlǂݍ
+ * @param[in] value l
+ * @return p[X𑱂ꍇtrue
+ */
+bool JsonBindHandler::String(const std::string& value)
+{
+  const JsonBindOps* ops = nullptr;
+  void* const target = this->NextTarget(&ops);
+  if (target == nullptr) return true;
+  if (ops->setString == nullptr) return this->SetError(JsonBindHandler::ERR_MSG_TYPE_MISMATCH, ops->typeName);
+  ops->setString(target, value);
+  return true;
+}
+
+/**
+ * object̊Jn('{')ǂݍ
+ * @return p[X𑱂ꍇtrue
+ */
+bool JsonBindHandler::StartObject()
+{
+  const JsonBindOps* ops = nullptr;
+  void* const target = this->NextTarget(&ops);
+  if (target == nullptr)
+  {
+    // ǂݔ΂
+    ++m_skipDepth;
+    return true;
+  }
+  if (ops->findField == nullptr) return this->SetError(JsonBindHandler::ERR_MSG_TYPE_MISMATCH, ops->typeName);
+
+  const Frame frame = { target, ops, false, nullptr, 0 };
+  m_stack.push_back(frame);
+  return true;
+}
+
+/**
+ * objectnameǂݍ
+ * @param[in] name name
+ * @return p[X𑱂ꍇtrue
+ * @remarks Bindɖnameł, lǂݔ΂
+ */
+bool JsonBindHandler::Key(const std::string& name)
+{
+  if (m_skipDepth > 0) return true;
+
+  Frame& frame = m_stack.back();
+  m_fieldTarget = frame.ops->findField(frame.target, name, &m_fieldOps, &frame.name);
+  return true;
+}
+
+/**
+ * object̏I('}')ǂݍ
+ * @param[in] memberCount object̃o
+ * @return p[X𑱂ꍇtrue
+ */
+bool JsonBindHandler::EndObject(size_t /*memberCount*/)
+{
+  if (m_skipDepth > 0)
+  {
+    --m_skipDepth;
+    return true;
+  }
+  m_stack.pop_back();
+  return true;
+}
+
+/**
+ * arraẙJn('[')ǂݍ
+ * @return p[X𑱂ꍇtrue
+ */
+bool JsonBindHandler::StartArray()
+{
+  const JsonBindOps* ops = nullptr;
+  void* const target = this->NextTarget(&ops);
+  if (target == nullptr)
+  {
+    // ǂݔ΂
+    ++m_skipDepth;
+    return true;
+  }
+  if (ops->startArray == nullptr) return this->SetError(JsonBindHandler::ERR_MSG_TYPE_MISMATCH, ops->typeName);
+
+  // ̗vf폜, vf̊i[Jn
+  ops->startArray(target);
+  const Frame frame = { target, ops, true, nullptr, 0 };
+  m_stack.push_back(frame);
+  return true;
+}
+
+/**
+ * array̏I(']')ǂݍ
+ * @param[in] elementCount array̗vf
+ * @return p[X𑱂ꍇtrue
+ */
+bool JsonBindHandler::EndArray(size_t /*elementCount*/)
+{
+  if (m_skipDepth > 0)
+  {
+    --m_skipDepth;
+    return true;
+  }
+  m_stack.pop_back();
+  return true;
+}
+}
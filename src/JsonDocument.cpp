@@ -0,0 +1,71 @@
+/**
+ * @file   JsonDocument.cpp
+ * @brief  JSONhLg
+ * @author kyo
+ * @date   2026/10/17
+ */
+#include "JsonDocument.h"
+#include "JsonObject.h"
+#include <utility>
+
+/** Analysis Drive */
+namespace adlib
+{
+/**
+ * RXgN^
+ * @param[in] root ŏʂ̒l([uē)
+ */
+JsonDocument::JsonDocument(Json&& root)
+  :m_root(std::move(root))
+{
+  JsonDocument::FreezeValue(m_root);
+}
+
+/**
+ * l𓀌(vf, oǂ)
+ * @param[in,out] value l(LĂ, ܂͕ύX\ȎQƂԂarray, object̓Rs[ɒu)
+ * @remarks eRs[_Ŏq͐ẽRs[ƂL邽, e珇ɒuĂqǂ
+ */
+void JsonDocument::FreezeValue(Json& value)
+{
+  // ̓obt@QƂĂ镶Rs[Ă(stringl͕ύXłȂ, L܂܂ł悢)
+  if (value.IsString())
+  {
+    value.GetString();
+    return;
+  }
+  if (!value.IsArray() && !value.IsObject()) return;
+
+  // O̎Q, Rs[ύXȂ悤, {hLĝ݂QƂlɂ
+  value.Isolate();
+
+  // Ä̗vfJsonIuWFNgł͂Ȃ, ǂKv͂Ȃ
+  if (value.IsDoubleArray() || value.IsInt64Array()) return;
+  if (value.IsArray())
+  {
+    for (auto& element : *value.EditArray()) JsonDocument::FreezeValue(element);
+  }
+  else
+  {
+    for (auto& member : *value.EditObject()) JsonDocument::FreezeValue(member.second);
+  }
+}
+
+/**
+ * ŏʂ̒l擾
+ * @return ŏʂ̒l̎Q
+ */
+JsonView JsonDocument::Root() const
+{
+  return JsonView(&m_root);
+}
+
+/**
+ * ŏʂ̒l擾(JsonIuWFNg)
+ * @return ŏʂ̒l(DumpȂǂɎgp)
+ */
+const Json& JsonDocument::GetJson() const
+{
+  return m_root;
+}
+}
@@ -0,0 +1,126 @@
+/**
+ * @file   JsonHandler.cpp
+ * @brief  JSONp[XCxg̃nh
+ * @author kyo
+ * @date   2026/10/17
+ */
+#include "JsonHandler.h"
+#include <cstdint>
+#include <string>
+
+/** Analysis Drive */
+namespace adlib
+{
+/** RXgN^ */
+JsonHandler::JsonHandler() {}
+
+/** zfXgN^ */
+JsonHandler::~JsonHandler() {}
+
+/**
+ * nullǂݍ
+ * @return p[X𑱂ꍇtrue
+ */
+bool JsonHandler::Null()
+{
+  return true;
+}
+
+/**
+ * boollǂݍ
+ * @param[in] value l
+ * @return p[X𑱂ꍇtrue
+ */
+bool JsonHandler::Bool(bool /*value*/)
+{
+  return true;
+}
+
+/**
+ * numberl(int)ǂݍ
+ * @param[in] value l
+ * @return p[X𑱂ꍇtrue
+ */
+bool JsonHandler::Int(int /*value*/)
+{
+  return true;
+}
+
+/**
+ * numberl(int64)ǂݍ
+ * @param[in] value l
+ * @return p[X𑱂ꍇtrue
+ */
+bool JsonHandler::Int64(std::int64_t /*value*/)
+{
+  return true;
+}
+
+/**
+ * numberl(double)ǂݍ
+ * @param[in] value l
+ * @return p[X𑱂ꍇtrue
+ */
+bool JsonHandler::Double(double /*value*/)
+{
+  return true;
+}
+
+/**
+ * stringlǂݍ
+ * @param[in] value l
+ * @return p[X𑱂ꍇtrue
+ */
+bool JsonHandler::String(const std::string& /*value*/)
+{
+  return true;
+}
+
+/**
+ * object̊Jn('{')ǂݍ
+ * @return p[X𑱂ꍇtrue
+ */
+bool JsonHandler::StartObject()
+{
+  return true;
+}
+
+/**
+ * objectnameǂݍ
+ * @param[in] name name
+ * @return p[X𑱂ꍇtrue
+ */
+bool JsonHandler::Key(const std::string& /*name*/)
+{
+  return true;
+}
+
+/**
+ * object̏I('}')ǂݍ
+ * @param[in] memberCount object̃o
+ * @return p[X𑱂ꍇtrue
+ */
+bool JsonHandler::EndObject(size_t /*memberCount*/)
+{
+  return true;
+}
+
+/**
+ * arraẙJn('[')ǂݍ
+ * @return p[X𑱂ꍇtrue
+ */
+bool JsonHandler::StartArray()
+{
+  return true;
+}
+
+/**
+ * array̏I(']')ǂݍ
+ * @param[in] elementCount array̗vf
+ * @return p[X𑱂ꍇtrue
+ */
+bool JsonHandler::EndArray(size_t /*elementCount*/)
+{
+  return true;
+}
+}
@@ -0,0 +1,133 @@
+/**
+ * @file   JsonKey.cpp
+ * @brief  JSONobjectname
+ * @author kyo
+ * @date   2026/10/17
+ */
+#include "JsonKey.h"
+#include <cstdint>
+#include <string>
+#include <utility>
+
+/** Analysis Drive */
+namespace adlib
+{
+//! 󕶎(̂ꍇɎQƂ)
+const std::string JsonKey::EMPTY_STRING;
+
+/**
+ * RXgN^(nbVlvZς)
+ * @param[in] data ̐擪
+ * @param[in] size ̃TCY(byte)
+ * @param[in] hash nbVl(HashŌvZ)
+ */
+JsonKey::JsonKey(const char* data, size_t size, size_t hash)
+  :m_entry(new Entry)
+{
+  m_entry->refCount = 1;
+  m_entry->hash = hash;
+  try
+  {
+    m_entry->str.assign(data, size);
+  }
+  catch (...)
+  {
+    delete m_entry;
+    throw;
+  }
+}
+
+/**
+ * RXgN^
+ * @param[in] str 
+ */
+JsonKey::JsonKey(const std::string& str)
+  :JsonKey(str.data(), str.size(), JsonKey::Hash(str.data(), str.size()))
+{
+}
+
+/**
+ * RXgN^([u)
+ * @param[in] str 
+ */
+JsonKey::JsonKey(std::string&& str)
+  :m_entry(new Entry)
+{
+  m_entry->refCount = 1;
+  m_entry->hash = JsonKey::Hash(str.data(), str.size());
+  m_entry->str = std::move(str);
+}
+
+/**
+ * RXgN^
+ * @param[in] str C
+ */
+JsonKey::JsonKey(const char* str)
+  :JsonKey(str, std::strlen(str), JsonKey::Hash(str, std::strlen(str)))
+{
+}
+
+/**
+ * 
+ * @param[in] obj IuWFNg
+ */
+JsonKey& JsonKey::operator=(const JsonKey& obj)
+{
+  // ɎQƂ𑝂₷(ȑłjȂ悤)
+  Entry* const entry = obj.m_entry;
+  if (entry != nullptr) entry->refCount.fetch_add(1, std::memory_order_relaxed);
+  if (m_entry != nullptr) this->Release();
+  m_entry = entry;
+  return *this;
+}
+
+/**
+ * [u
+ * @param[in] obj [uIuWFNg
+ * @remarks [u͋󕶎ɂȂ
+ */
+JsonKey& JsonKey::operator=(JsonKey&& obj)
+{
+  if (this != &obj)
+  {
+    if (m_entry != nullptr) this->Release();
+    m_entry = obj.m_entry;
+    obj.m_entry = nullptr;
+  }
+  return *this;
+}
+
+/** ̂̎QƂO(Ō̎QƂłΔj) */
+void JsonKey::Release()
+{
+  if (m_entry->refCount.fetch_sub(1, std::memory_order_acq_rel) == 1) delete m_entry;
+  m_entry = nullptr;
+}
+
+/**
+ * get
+ * @return 
+ */
+const std::string& JsonKey::GetString() const
+{
+  return (m_entry != nullptr) ? m_entry->str : JsonKey::EMPTY_STRING;
+}
+
+/**
+ * ̃nbVlvZ
+ * @param[in] data ̐擪
+ * @param[in] size ̃TCY(byte)
+ * @return nbVl
+ * @remarks FNV-1a(64bit)
+ */
+size_t JsonKey::Hash(const char* data, size_t size)
+{
+  std::uint64_t hash = 14695981039346656037ULL;
+  for (size_t i = 0; i < size; ++i)
+  {
+    hash ^= static_cast<unsigned char>(data[i]);
+    hash *= 1099511628211ULL;
+  }
+  return static_cast<size_t>(hash ^ (hash >> 32));
+}
+}
@@ -0,0 +1,80 @@
+/**
+ * @file   JsonKeyTable.cpp
+ * @brief  JSONobjectnamẽC^[e[u
+ * @author kyo
+ * @date   2026/10/17
+ */
+#include "JsonKeyTable.h"
+#include "JsonKey.h"
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+/** Analysis Drive */
+namespace adlib
+{
+//! nbVe[ȕTCY(2ׂ̂)
+const size_t JsonKeyTable::INITIAL_SLOTS = 64;
+//! o^name̍ő吔(͓o^JsonKey쐬)
+const size_t JsonKeyTable::MAX_KEYS = 64 * 1024;
+
+/**
+ * name擾(Γo^)
+ * @param[in] data ̐擪
+ * @param[in] size ̃TCY(byte)
+ * @return name(o^ς݂łΓ̂L)
+ * @remarks name̎ނ(objectAzzƂĎgĂ)ꍇ,
+ *          ő吔𒴂o^JsonKey쐬.
+ */
+JsonKey JsonKeyTable::Intern(const char* data, size_t size)
+{
+  const size_t hash = JsonKey::Hash(data, size);
+  if (m_slots.empty()) m_slots.resize(JsonKeyTable::INITIAL_SLOTS, 0);
+
+  // `Tœname󂫂T
+  const size_t mask = m_slots.size() - 1;
+  size_t pos = hash & mask;
+  while (m_slots[pos] != 0)
+  {
+    const JsonKey::Entry* entry = m_keys[m_slots[pos] - 1].m_entry;
+    if (entry->hash == hash && entry->str.size() == size && std::memcmp(entry->str.data(), data, size) == 0)
+    {
+      return m_keys[m_slots[pos] - 1];
+    }
+    pos = (pos + 1) & mask;
+  }
+
+  // ő吔𒴂ĂΓo^Ȃ
+  if (m_keys.size() >= JsonKeyTable::MAX_KEYS) return JsonKey(data, size, hash);
+
+  // o^(gp1/2𒴂g)
+  m_keys.emplace_back(JsonKey(data, size, hash));
+  m_slots[pos] = m_keys.size();
+  if (m_keys.size() * 2 > m_slots.size()) this->Grow();
+  return m_keys.back();
+}
+
+/**
+ * o^nameSč폜
+ * @remarks nbVe[u̗eʂ͕ێ
+ */
+void JsonKeyTable::Clear()
+{
+  m_keys.clear();
+  std::fill(m_slots.begin(), m_slots.end(), 0);
+}
+
+/** nbVe[ug */
+void JsonKeyTable::Grow()
+{
+  std::vector<size_t> slots(m_slots.size() * 2, 0);
+  const size_t mask = slots.size() - 1;
+  for (size_t n = 0; n < m_keys.size(); ++n)
+  {
+    size_t pos = m_keys[n].m_entry->hash & mask;
+    while (slots[pos] != 0) pos = (pos + 1) & mask;
+    slots[pos] = n + 1;
+  }
+  m_slots.swap(slots);
+}
+}
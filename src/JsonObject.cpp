@@ -0,0 +1,796 @@
+/**
+ * @file   JsonObject.cpp
+ * @brief  JSONIuWFNgobject^
+ * @author kyo
+ * @date   2026/10/17
+ */
+#include "JsonObject.h"
+#include "Json.h"
+#include "JsonKey.h"
+#include <algorithm>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+/** Analysis Drive */
+namespace adlib
+{
+//! 쐬vf(葽Ȃ΍쐬)
+const size_t JsonObject::INDEX_THRESHOLD = 8;
+//! ŏɗvfǉ鎞Ɋmۂvf
+const size_t JsonObject::INITIAL_CAPACITY = 4;
+//! Ȃꍇ̈ʒu
+const size_t JsonObject::NPOS = static_cast<size_t>(-1);
+//! ubN̐擪ɒuBlock̑傫(vfP)
+const size_t JsonObject::BLOCK_HEADER = (sizeof(JsonObject::Block) + sizeof(JsonObject::value_type) - 1) / sizeof(JsonObject::value_type);
+
+/**
+ * Rs[RXgN^
+ * @param[in] obj Rs[
+ * @remarks vf̓q[vɍ쐬(AP[^̓Rs[Ȃ)
+ */
+JsonObject::JsonObject(const JsonObject& obj)
+  :m_blocks(nullptr),
+   m_table(nullptr)
+{
+  this->Assign(obj);
+}
+
+/**
+ * RXgN^(Rs[)
+ * @param[in] obj   Rs[
+ * @param[in] alloc mۂɎgpAP[^
+ */
+JsonObject::JsonObject(const JsonObject& obj, const allocator_type& alloc)
+  :m_allocator(alloc),
+   m_blocks(nullptr),
+   m_table(nullptr)
+{
+  this->Assign(obj);
+}
+
+/**
+ * [uRXgN^
+ * @param[in] obj [uIuWFNg
+ */
+JsonObject::JsonObject(JsonObject&& obj)
+  :m_allocator(obj.m_allocator),
+   m_blocks(obj.m_blocks),
+   m_table(obj.m_table)
+{
+  obj.m_blocks = nullptr;
+  obj.m_table = nullptr;
+}
+
+/**
+ * RXgN^([u)
+ * @param[in] obj   [uIuWFNg
+ * @param[in] alloc mۂɎgpAP[^(objƓłΗvf̂܂܈ڂ)
+ */
+JsonObject::JsonObject(JsonObject&& obj, const allocator_type& alloc)
+  :m_allocator(alloc),
+   m_blocks(nullptr),
+   m_table(nullptr)
+{
+  if (obj.m_allocator == alloc)
+  {
+    this->swap(obj);
+    return;
+  }
+
+  // AP[^قȂ, l[uč쐬(namê͎L)
+  this->reserve(obj.size());
+  for (auto& member : obj) this->Append(JsonKey(member.first), std::move(member.second));
+  obj.clear();
+}
+
+/**
+ * 
+ * @param[in] obj IuWFNg
+ * @remarks AP[^͕ςȂ
+ */
+JsonObject& JsonObject::operator=(const JsonObject& obj)
+{
+  // vfnameconst̂, 쐬Č
+  JsonObject copy(obj, this->get_allocator());
+  this->swap(copy);
+  return *this;
+}
+
+/**
+ * [u
+ * @param[in] obj [uIuWFNg
+ * @remarks AP[^ڂ
+ */
+JsonObject& JsonObject::operator=(JsonObject&& obj)
+{
+  JsonObject moved(std::move(obj));
+  this->swap(moved);
+  return *this;
+}
+
+/** SĂ̗vf폜 */
+void JsonObject::clear()
+{
+  this->Release();
+}
+
+/**
+ * vf̗̈\񂷂
+ * @param[in] n vf
+ * @remarks 󂫂Ȃ, Ȃ̃ubNǉ
+ */
+void JsonObject::reserve(size_t n)
+{
+  if (n <= this->size()) return;
+
+  // 1̃ubNɎ܂Ԃ, ǉƍ쐬Ȃ
+  if (m_table == nullptr)
+  {
+    if (n <= JsonObject::INDEX_THRESHOLD)
+    {
+      if (m_blocks == nullptr) this->AddBlock(n);
+      if (n <= m_blocks->capacity) return;
+    }
+    this->MakeTable();
+  }
+  m_table->order.reserve(n + m_table->erased);
+  const size_t vacant = (m_blocks != nullptr) ? m_blocks->capacity - m_blocks->used : 0;
+  if (n - this->size() > vacant) this->AddBlock(n - this->size() - vacant);
+}
+
+/**
+ * ǉł̈ʒu̗vf擾
+ * @param[in] index ʒu(폜vf͐Ȃ)
+ * @return vf(͈͊Ołend)
+ * @remarks 폜ς݂̗vfO(1), ΐ擪琔
+ */
+JsonObject::const_iterator JsonObject::nth(size_t index) const
+{
+  if (index >= this->size()) return this->end();
+  if (m_table == nullptr || m_table->erased == 0) return const_iterator(this, index);
+  const_iterator it = this->begin();
+  for (size_t n = 0; n < index; ++n) ++it;
+  return it;
+}
+
+/**
+ * name
+ * @param[in] key name
+ * @return vf(end)
+ */
+JsonObject::iterator JsonObject::find(const JsonKey& key)
+{
+  const size_t pos = this->Search(key);
+  return (pos != NPOS) ? iterator(this, pos) : this->end();
+}
+
+/**
+ * name(const)
+ * @param[in] key name
+ * @return vf(end)
+ */
+JsonObject::const_iterator JsonObject::find(const JsonKey& key) const
+{
+  const size_t pos = this->Search(key);
+  return (pos != NPOS) ? const_iterator(this, pos) : this->end();
+}
+
+/**
+ * name(. const)
+ * @param[in] data name̐擪
+ * @param[in] size namẽTCY(byte)
+ * @return vf(end)
+ */
+JsonObject::const_iterator JsonObject::find(const char* data, size_t size) const
+{
+  const size_t pos = this->Search(data, size, JsonKey::Hash(data, size));
+  return (pos != NPOS) ? const_iterator(this, pos) : this->end();
+}
+
+/**
+ * name(std::string)
+ * @param[in] name name
+ * @return vf(end)
+ */
+JsonObject::iterator JsonObject::find(const std::string& name)
+{
+  const size_t pos = this->Search(name);
+  return (pos != NPOS) ? iterator(this, pos) : this->end();
+}
+
+/**
+ * name(std::string. const)
+ * @param[in] name name
+ * @return vf(end)
+ */
+JsonObject::const_iterator JsonObject::find(const std::string& name) const
+{
+  const size_t pos = this->Search(name);
+  return (pos != NPOS) ? const_iterator(this, pos) : this->end();
+}
+
+/**
+ * name(C)
+ * @param[in] name name
+ * @return vf(end)
+ */
+JsonObject::iterator JsonObject::find(const char* name)
+{
+  const size_t pos = this->Search(name);
+  return (pos != NPOS) ? iterator(this, pos) : this->end();
+}
+
+/**
+ * name(C. const)
+ * @param[in] name name
+ * @return vf(end)
+ */
+JsonObject::const_iterator JsonObject::find(const char* name) const
+{
+  const size_t pos = this->Search(name);
+  return (pos != NPOS) ? const_iterator(this, pos) : this->end();
+}
+
+/**
+ * name̐擾
+ * @param[in] key name
+ * @return 1, 0
+ */
+size_t JsonObject::count(const JsonKey& key) const
+{
+  return (this->Search(key) != NPOS) ? 1 : 0;
+}
+
+/**
+ * name̐擾(std::string)
+ * @param[in] name name
+ * @return 1, 0
+ */
+size_t JsonObject::count(const std::string& name) const
+{
+  return (this->Search(name) != NPOS) ? 1 : 0;
+}
+
+/**
+ * name̐擾(C)
+ * @param[in] name name
+ * @return 1, 0
+ */
+size_t JsonObject::count(const char* name) const
+{
+  return (this->Search(name) != NPOS) ? 1 : 0;
+}
+
+/**
+ * nameɑΉl擾(nullǉ)
+ * @param[in] key name
+ * @return l
+ */
+Json& JsonObject::operator[](const JsonKey& key)
+{
+  const size_t pos = this->Search(key);
+  if (pos != NPOS) return this->Member(pos)->second;
+  return this->Append(JsonKey(key), Json())->second;
+}
+
+/**
+ * nameɑΉl擾(nullǉ)
+ * @param[in] key name(ǉꍇ̓[u)
+ * @return l
+ */
+Json& JsonObject::operator[](JsonKey&& key)
+{
+  const size_t pos = this->Search(key);
+  if (pos != NPOS) return this->Member(pos)->second;
+  return this->Append(std::move(key), Json())->second;
+}
+
+/**
+ * nameɑΉl擾(nullǉ. std::string)
+ * @param[in] name name
+ * @return l
+ */
+Json& JsonObject::operator[](const std::string& name)
+{
+  return this->Subscript(name.data(), name.size());
+}
+
+/**
+ * nameɑΉl擾(nullǉ. C)
+ * @param[in] name name
+ * @return l
+ */
+Json& JsonObject::operator[](const char* name)
+{
+  return this->Subscript(name, std::strlen(name));
+}
+
+/**
+ * nameɑΉl擾
+ * @param[in] key name
+ * @return l
+ * @remarks std::out_of_range𓊂
+ */
+Json& JsonObject::at(const JsonKey& key)
+{
+  const size_t pos = this->Search(key);
+  if (pos == NPOS) throw std::out_of_range("JsonObject::at");
+  return this->Member(pos)->second;
+}
+
+/**
+ * nameɑΉl擾(const)
+ * @param[in] key name
+ * @return l
+ * @remarks std::out_of_range𓊂
+ */
+const Json& JsonObject::at(const JsonKey& key) const
+{
+  const size_t pos = this->Search(key);
+  if (pos == NPOS) throw std::out_of_range("JsonObject::at");
+  return this->Member(pos)->second;
+}
+
+/**
+ * nameɑΉl擾(std::string)
+ * @param[in] name name
+ * @return l
+ * @remarks std::out_of_range𓊂
+ */
+Json& JsonObject::at(const std::string& name)
+{
+  const size_t pos = this->Search(name);
+  if (pos == NPOS) throw std::out_of_range("JsonObject::at");
+  return this->Member(pos)->second;
+}
+
+/**
+ * nameɑΉl擾(std::string. const)
+ * @param[in] name name
+ * @return l
+ * @remarks std::out_of_range𓊂
+ */
+const Json& JsonObject::at(const std::string& name) const
+{
+  const size_t pos = this->Search(name);
+  if (pos == NPOS) throw std::out_of_range("JsonObject::at");
+  return this->Member(pos)->second;
+}
+
+/**
+ * nameɑΉl擾(C)
+ * @param[in] name name
+ * @return l
+ * @remarks std::out_of_range𓊂
+ */
+Json& JsonObject::at(const char* name)
+{
+  const size_t pos = this->Search(name);
+  if (pos == NPOS) throw std::out_of_range("JsonObject::at");
+  return this->Member(pos)->second;
+}
+
+/**
+ * nameɑΉl擾(C. const)
+ * @param[in] name name
+ * @return l
+ * @remarks std::out_of_range𓊂
+ */
+const Json& JsonObject::at(const char* name) const
+{
+  const size_t pos = this->Search(name);
+  if (pos == NPOS) throw std::out_of_range("JsonObject::at");
+  return this->Member(pos)->second;
+}
+
+/**
+ * vfǉ
+ * @param[in] value vf
+ * @return ǉvf(ɂ΂̗vf), ǉǂ
+ */
+std::pair<JsonObject::iterator, bool> JsonObject::insert(const value_type& value)
+{
+  return this->emplace(value.first, value.second);
+}
+
+/**
+ * vf폜
+ * @param[in] pos 폜vf
+ * @return 폜vf̎
+ * @remarks ̗vfl߂(ǉ͕ۂ)
+ */
+JsonObject::iterator JsonObject::erase(const_iterator pos)
+{
+  if (m_table == nullptr) this->MakeTable();
+  std::vector<value_type*, JsonAllocator<value_type*>>& order = m_table->order;
+  size_t n = pos.m_pos;
+  this->UnindexMember(n);
+
+  // vfj, ͎̈ɒǉvfɎg
+  value_type* const member = order[n];
+  member->~value_type();
+  this->FreeMember(member);
+  order[n] = nullptr;
+  ++m_table->erased;
+
+  // 폜ς݂𒴂lߒ(̗vf̈ʒu͋l߂̈ʒuɂ)
+  if (m_table->erased * 2 > order.size())
+  {
+    n -= static_cast<size_t>(std::count(order.begin(), order.begin() + n, nullptr));
+    this->Compact();
+  }
+  return iterator(this, n);
+}
+
+/**
+ * vf폜
+ * @param[in] key 폜name
+ * @return 폜vf(0܂1)
+ */
+size_t JsonObject::erase(const JsonKey& key)
+{
+  return this->EraseAt(this->Search(key));
+}
+
+/**
+ * vf폜(std::string)
+ * @param[in] name 폜name
+ * @return 폜vf(0܂1)
+ */
+size_t JsonObject::erase(const std::string& name)
+{
+  return this->EraseAt(this->Search(name));
+}
+
+/**
+ * vf폜(C)
+ * @param[in] name 폜name
+ * @return 폜vf(0܂1)
+ */
+size_t JsonObject::erase(const char* name)
+{
+  return this->EraseAt(this->Search(name));
+}
+
+/**
+ * 
+ * @param[in,out] obj IuWFNg
+ */
+void JsonObject::swap(JsonObject& obj)
+{
+  std::swap(m_allocator, obj.m_allocator);
+  std::swap(m_blocks, obj.m_blocks);
+  std::swap(m_table, obj.m_table);
+}
+
+/**
+ * name
+ * @param[in] key name
+ * @return vf̈ʒu(NPOS)
+ * @remarks ΐ擪珇ɔr. name̔r͎, nbVl, ̏ɍs.
+ */
+size_t JsonObject::Search(const JsonKey& key) const
+{
+  // vfȂΐ擪珇ɔr(폜ς݂͔΂)
+  if (m_table == nullptr || m_table->index.empty())
+  {
+    const size_t count = this->Count();
+    for (size_t n = 0; n < count; ++n)
+    {
+      const value_type* const member = this->Member(n);
+      if (member != nullptr && member->first == key) return n;
+    }
+    return NPOS;
+  }
+
+  // `T(ɂ͍폜ς݂̗vf͖)
+  const std::vector<size_t, JsonAllocator<size_t>>& index = m_table->index;
+  const size_t mask = index.size() - 1;
+  for (size_t slot = key.GetHash() & mask; index[slot] != 0; slot = (slot + 1) & mask)
+  {
+    const size_t n = index[slot] - 1;
+    if (m_table->order[n]->first == key) return n;
+  }
+  return NPOS;
+}
+
+/**
+ * name()
+ * @param[in] data name̐擪
+ * @param[in] size namẽTCY(byte)
+ * @param[in] hash namẽnbVl(JsonKey::HashŌvZ)
+ * @return vf̈ʒu(NPOS)
+ */
+size_t JsonObject::Search(const char* data, size_t size, size_t hash) const
+{
+  // nbVlvvf̂ݕr
+  const auto equals = [&](const JsonKey& key)
+  {
+    if (key.GetHash() != hash) return false;
+    const std::string& str = key.GetString();
+    return str.size() == size && std::memcmp(str.data(), data, size) == 0;
+  };
+
+  // vfȂΐ擪珇ɔr(폜ς݂͔΂)
+  if (m_table == nullptr || m_table->index.empty())
+  {
+    const size_t count = this->Count();
+    for (size_t n = 0; n < count; ++n)
+    {
+      const value_type* const member = this->Member(n);
+      if (member != nullptr && equals(member->first)) return n;
+    }
+    return NPOS;
+  }
+
+  // `T(ɂ͍폜ς݂̗vf͖)
+  const std::vector<size_t, JsonAllocator<size_t>>& index = m_table->index;
+  const size_t mask = index.size() - 1;
+  for (size_t slot = hash & mask; index[slot] != 0; slot = (slot + 1) & mask)
+  {
+    const size_t n = index[slot] - 1;
+    if (equals(m_table->order[n]->first)) return n;
+  }
+  return NPOS;
+}
+
+/**
+ * nameɑΉl擾(nullǉ. )
+ * @param[in] data name̐擪
+ * @param[in] size namẽTCY(byte)
+ * @return l
+ */
+Json& JsonObject::Subscript(const char* data, size_t size)
+{
+  // vZnbVl͒ǉnameɂg
+  const size_t hash = JsonKey::Hash(data, size);
+  const size_t pos = this->Search(data, size, hash);
+  if (pos != NPOS) return this->Member(pos)->second;
+  return this->Append(JsonKey(data, size, hash), Json())->second;
+}
+
+/**
+ * nameɑΉvf폜
+ * @param[in] pos vf̈ʒu(NPOS)
+ * @return 폜vf(0܂1)
+ */
+size_t JsonObject::EraseAt(size_t pos)
+{
+  if (pos == NPOS) return 0;
+  this->erase(const_iterator(this, pos));
+  return 1;
+}
+
+/**
+ * ɗvfǉ(nameƂ͊mFς)
+ * @param[in] key   name([u)
+ * @param[in] value l([u)
+ * @return ǉvf
+ */
+JsonObject::iterator JsonObject::Append(JsonKey&& key, Json&& value)
+{
+  // 1̃ubNɎ܂Ԃ, ubNɒǉɕׂ
+  if (m_table == nullptr)
+  {
+    if (m_blocks == nullptr) this->AddBlock(JsonObject::INITIAL_CAPACITY);
+    if (m_blocks->used < m_blocks->capacity && m_blocks->used < JsonObject::INDEX_THRESHOLD)
+    {
+      ::new (static_cast<void*>(JsonObject::Members(m_blocks) + m_blocks->used)) value_type(std::move(key), std::move(value));
+      return iterator(this, m_blocks->used++);
+    }
+    this->MakeTable();
+  }
+
+  // vf͈ړȂ̈ɍ쐬, ǉɈʒuL^
+  std::vector<value_type*, JsonAllocator<value_type*>>& order = m_table->order;
+  order.push_back(nullptr);
+  value_type* member;
+  try
+  {
+    member = this->AllocateMember();
+  }
+  catch (...)
+  {
+    order.pop_back();
+    throw;
+  }
+  ::new (static_cast<void*>(member)) value_type(std::move(key), std::move(value));
+  order.back() = member;
+
+  // XV(gp1/2𒴂쐬)
+  const size_t pos = order.size() - 1;
+  if (m_table->index.empty())
+  {
+    if (this->size() > JsonObject::INDEX_THRESHOLD) this->RebuildIndex();
+  }
+  else if (this->size() * 2 > m_table->index.size())
+  {
+    this->RebuildIndex();
+  }
+  else
+  {
+    this->IndexMember(pos);
+  }
+  return iterator(this, pos);
+}
+
+/**
+ * vf̗̈擾(폜̈悪΍ėp)
+ * @return vf̗̈(\z)
+ */
+JsonObject::value_type* JsonObject::AllocateMember()
+{
+  if (m_table->free != nullptr)
+  {
+    value_type* const member = m_table->free;
+    m_table->free = *reinterpret_cast<value_type**>(member);
+    return member;
+  }
+
+  // 󂫂, ܂ł̗vfƓ̃ubNǉ
+  if (m_blocks == nullptr || m_blocks->used == m_blocks->capacity)
+  {
+    this->AddBlock(std::max(this->size(), JsonObject::INITIAL_CAPACITY));
+  }
+  return JsonObject::Members(m_blocks) + m_blocks->used++;
+}
+
+/**
+ * vf̗̈Ԃ(ɒǉvfɎg)
+ * @param[in] member vf̗̈(jς)
+ * @remarks ̈Ɏ̋󂫂ւ̃|C^Ōq
+ */
+void JsonObject::FreeMember(value_type* member)
+{
+  ::new (static_cast<void*>(member)) value_type*(m_table->free);
+  m_table->free = member;
+}
+
+/**
+ * ubNǉ
+ * @param[in] capacity vf
+ */
+void JsonObject::AddBlock(size_t capacity)
+{
+  // ̃ubN̋󂫂, 폜̈Ɠėp
+  if (m_blocks != nullptr)
+  {
+    while (m_blocks->used < m_blocks->capacity) this->FreeMember(JsonObject::Members(m_blocks) + m_blocks->used++);
+  }
+
+  void* const memory = m_allocator.allocate(JsonObject::BLOCK_HEADER + capacity);
+  Block* const block = ::new (memory) Block;
+  block->next = m_blocks;
+  block->capacity = capacity;
+  block->used = 0;
+  m_blocks = block;
+}
+
+/**
+ * ǉƍ쐬
+ * @remarks ŏ̃ubNɕłvf, ǉƂċL^
+ */
+void JsonObject::MakeTable()
+{
+  JsonAllocator<Table> alloc(m_allocator);
+  Table* const table = ::new (static_cast<void*>(alloc.allocate(1))) Table(m_allocator);
+  try
+  {
+    const size_t count = this->Count();
+    table->order.reserve(std::max(count * 2, JsonObject::INITIAL_CAPACITY));
+    for (size_t n = 0; n < count; ++n) table->order.push_back(JsonObject::Members(m_blocks) + n);
+  }
+  catch (...)
+  {
+    table->~Table();
+    alloc.deallocate(table, 1);
+    throw;
+  }
+  m_table = table;
+  this->RebuildIndex();
+}
+
+/** SĂ̗vfj, ubN */
+void JsonObject::Release()
+{
+  const size_t count = this->Count();
+  for (size_t n = 0; n < count; ++n)
+  {
+    value_type* const member = this->Member(n);
+    if (member != nullptr) member->~value_type();
+  }
+  if (m_table != nullptr)
+  {
+    JsonAllocator<Table> alloc(m_allocator);
+    m_table->~Table();
+    alloc.deallocate(m_table, 1);
+    m_table = nullptr;
+  }
+  while (m_blocks != nullptr)
+  {
+    Block* const block = m_blocks;
+    m_blocks = block->next;
+    m_allocator.deallocate(reinterpret_cast<value_type*>(block), JsonObject::BLOCK_HEADER + block->capacity);
+  }
+}
+
+/**
+ * vfSĒǉ
+ * @param[in] obj ǉ(nameƒlRs[)
+ */
+void JsonObject::Assign(const JsonObject& obj)
+{
+  this->reserve(obj.size());
+  for (const auto& member : obj) this->Append(JsonKey(member.first), Json(member.second));
+}
+
+/**
+ * ɗvfo^
+ * @param[in] pos vf̈ʒu
+ */
+void JsonObject::IndexMember(size_t pos)
+{
+  std::vector<size_t, JsonAllocator<size_t>>& index = m_table->index;
+  const size_t mask = index.size() - 1;
+  size_t slot = m_table->order[pos]->first.GetHash() & mask;
+  while (index[slot] != 0) slot = (slot + 1) & mask;
+  index[slot] = pos + 1;
+}
+
+/**
+ * vfO
+ * @param[in] pos vf̈ʒu
+ * @remarks Ő󂫂ɂ, {̈ʒuHȂȂ㑱̗vfl߂
+ */
+void JsonObject::UnindexMember(size_t pos)
+{
+  std::vector<size_t, JsonAllocator<size_t>>& index = m_table->index;
+  if (index.empty()) return;
+  const size_t mask = index.size() - 1;
+  size_t hole = m_table->order[pos]->first.GetHash() & mask;
+  while (index[hole] != pos + 1) hole = (hole + 1) & mask;
+
+  for (size_t slot = (hole + 1) & mask; index[slot] != 0; slot = (slot + 1) & mask)
+  {
+    // {̈ʒu󂫂(󂫂猻݂̈ʒů)ł, ̂܂ܒH
+    const size_t home = m_table->order[index[slot] - 1]->first.GetHash() & mask;
+    if (((slot - home) & mask) < ((slot - hole) & mask)) continue;
+    index[hole] = index[slot];
+    hole = slot;
+  }
+  index[hole] = 0;
+}
+
+/** 쐬(vfȂ΍폜) */
+void JsonObject::RebuildIndex()
+{
+  std::vector<size_t, JsonAllocator<size_t>>& index = m_table->index;
+  if (this->size() <= JsonObject::INDEX_THRESHOLD)
+  {
+    index.clear();
+    return;
+  }
+
+  // gp1/4ȉɂȂTCY(2ׂ̂)
+  size_t slots = 1;
+  while (slots < this->size() * 4) slots *= 2;
+  index.assign(slots, 0);
+  for (size_t n = 0; n < m_table->order.size(); ++n)
+  {
+    if (m_table->order[n] != nullptr) this->IndexMember(n);
+  }
+}
+
+/** 폜ς݂̈菜ċlߒ(vf͈ړȂ) */
+void JsonObject::Compact()
+{
+  std::vector<value_type*, JsonAllocator<value_type*>>& order = m_table->order;
+  order.erase(std::remove(order.begin(), order.end(), nullptr), order.end());
+  m_table->erased = 0;
+  this->RebuildIndex();
+}
+}
@@ -5,160 +5,32 @@
  * @date   2015/05/07
  */
 #include "JsonParser.h"
+#include "JsonParserImpl.h"
 #include "Json.h"
+#include "JsonArena.h"
+#include "JsonArrayBuilder.h"
+#include "JsonBind.h"
+#include "JsonBindHandler.h"
+#include "JsonHandler.h"
+#include "JsonNumber.h"
+#include "JsonScan.h"
+#include "JsonValue.h"
+#include "MappedFile.h"
+#include <algorithm>
 #include <memory>
 #include <vector>
 #include <unordered_map>
 #include <string>
+#include <thread>
+#include <utility>
+#include <cstdint>
+#include <climits>
+#include <cfloat>
+#include <cmath>
 
 /** Analysis Drive */
 namespace adlib
 {
-//> PimplCfBI
-class JsonParser::Impl
-{
-public:
-  //> ^[R[h
-  enum RETURN_CODE
-  {
-    SUCCESS, /*!<  */
-    FAILURE  /*!< s */
-  };
-
-  //> UNICODEGXP[vV[PX4BYTË
-  static const size_t ESCAPE_SEQUENCE_4BYTE;
-  //> 16ï
-  static const int HEXADECIMAL_16;
-  //> UTF8BOMTCY
-  static const int BOM_UTF8_SIZE;
-  //> UTF8BOM
-  static const char BOM_UTF8[];
-  //> G[bZ[Wi[obt@TCY
-  static const size_t BUFFER_SIZE;
-  //> G[bZ[W --- JSOÑp[Xs
-  static const std::string ERR_MSG_PARSE_FAILURE;
-  //> G[bZ[W --- 0ړnumber^
-  static const std::string ERR_MSG_0HEAD_NUMBER;
-  //> G[bZ[W --- number^ɖȕ܂܂Ă
-  static const std::string ERR_MSG_BAD_WORD_IN_NUMBER;
-  //> G[bZ[W --- number^(int^)͈͊O̒l
-  static const std::string ERR_MSG_INT_NUMBER_OUT_OF_RANGE;
-  //> G[bZ[W --- number^(double^)͈͊O̒l
-  static const std::string ERR_MSG_DOUBLE_NUMBER_OUT_OF_RANGE;
-  //> G[bZ[W --- '.'̌㑱ɐl
-  static const std::string ERR_MSG_NOT_DIGIT_FOLLOWER_DOT;
-  //> G[bZ[W --- 'e', 'E'̌㑱ɐl
-  static const std::string ERR_MSG_NOT_DIGIT_FOLLOWER_EXP;
-  //> G[bZ[W --- '"'Ȃ
-  static const std::string ERR_MSG_NOT_EXIST_DOUBLE_QUOTATION;
-  //> G[bZ[W --- sȃGXP[v
-  static const std::string ERR_MSG_ESCAPE_CHARACTER_FAILURE;
-  //> G[bZ[W --- TQ[g̈UNICODE
-  static const std::string ERR_MSG_EXIST_CODE_IN_SURROGATE;
-  //> G[bZ[W --- object'}'Ȃ
-  static const std::string ERR_MSG_NOT_EXIST_BRACKET_IN_OBJ;
-  //> G[bZ[W --- object2ڈȍ~̒l̑O','Ȃ
-  static const std::string ERR_MSG_NOT_EXIST_COMMA_IN_OBJ;
-  //> G[bZ[W --- objectɕJn'"'Ȃ
-  static const std::string ERR_MSG_NOT_EXIST_DOUBLE_QUOTATION_IN_OBJ;
-  //> G[bZ[W --- object':'Ȃ
-  static const std::string ERR_MSG_NOT_EXIST_COLON_IN_OBJ;
-  //> G[bZ[W --- array']'Ȃ
-  static const std::string ERR_MSG_NOT_EXIST_BRACKET_IN_ARRAY;
-  //> G[bZ[W --- array2ڈȍ~̒l̑O','Ȃ
-  static const std::string ERR_MSG_NOT_EXIST_COMMA_IN_ARRAY;
-  //> G[bZ[W --- sȒl
-  static const std::string ERR_MSG_VALUE_FAILURE;
-  //> [jObZ[W --- objectnamedĂ
-  static const std::string WRN_MSG_NAME_REPEATED;
-
-  //> G[bZ[WRei
-  std::vector<std::string> m_errorMsg;
-  //> [jObZ[WRei
-  std::vector<std::string> m_warningMsg;
-  //> objectnamedtO
-  bool m_nameRepeated;
-  //> p[XΏۂ̕
-  const std::string& m_target;
-  //> p[XΏۂ̃̕J[\(ɓǂݍƂʒu)
-  size_t m_i;
-
-  /**
-   * RXgN^
-   * @param[in] target p[XΏۂ̕
-   */
-  Impl(const std::string& target)
-    :m_nameRepeated(false),
-     m_target(target),
-     m_i(0)
-  {
-  }
-
-  /**
-   * G[bZ[W쐬
-   * @param[in] messageTemp G[bZ[W
-   * @param[in] keyWord     bZ[WɖߍރL[[h
-   * @return G[bZ[W
-   * @remarks messageTemṕu%sv̉ӏkeyWord𖄂ߍŕԂ
-   */
-  const std::string MakeErrorMsg(const std::string& messageTemp, const std::string& keyWord) const;
-
-  /**
-   * 1擾(zCgXy[X̓XLbv)
-   * @param[out] word i[
-   * @return ^[R[h(擾SUCCESS)
-   * @remarks {֐I, J[\͎1w(zCgXy[X̓XLbv)
-   */
-  Impl::RETURN_CODE SkipWhitespaceAndGetWord(char* word);
-
-  /**
-   * UTF8BOM΃XLbv
-   */
-  void SkipBOM();
-
-  /**
-   * GXP[vV[PX𕶎ɕϊ
-   * @param[in] hex UNICODE16i
-   */
-  const std::string ConversionEscapeSequence(int hex);
-
-  /**
-   * string^p[X
-   * @remarks {֐I, J[\string^̎1w
-   */
-  Json ParseString();
-
-  /**
-   * number^p[X
-   * @remarks {֐I, J[\number^̎1w
-   */
-  Json ParseNumber();
-
-  /**
-   * object^p[X
-   * @remarks {֐I, J[\object^̎1w
-   */
-  Json ParseObject();
-
-  /**
-   * array^p[X
-   * @remarks {֐I, J[\array^̎1w
-   */
-  Json ParseArray();
-
-  /**
-   * l`FbN(lsȏꍇ͗O𓊂)
-   * @param[in] checkString `FbNl
-   * @remarks {֐I, J[\͒l̎1w
-   */
-  void CheckValue(const std::string& checkString);
-
-  /**
-   * valuep[X
-   */
-  Json ParseValue();
-};
-
 //> UNICODEGXP[vV[PX4BYTË
 const size_t JsonParser::Impl::ESCAPE_SEQUENCE_4BYTE = 4;
 //> 16ï
@@ -169,6 +41,10 @@ const int JsonParser::Impl::BOM_UTF8_SIZE = 3;
 const char JsonParser::Impl::BOM_UTF8[] = { char(0xEF), char(0xBB), char(0xBF) };
 //> G[bZ[Wi[obt@TCY
 const size_t JsonParser::Impl::BUFFER_SIZE = 256;
+//> Xg[xɓǂݍރTCY
+const size_t JsonParser::Impl::STREAM_BUFFER_SIZE = 64 * 1024;
+//> number^̎w̑ł~ߒl(ȏ͔͈͊Om肷)
+const int JsonParser::Impl::MAX_EXPONENT = 100000;
 //> G[bZ[W --- JSOÑp[Xs
 const std::string JsonParser::Impl::ERR_MSG_PARSE_FAILURE("Parse Failure.");
 //> G[bZ[W --- 0ړnumber^
@@ -203,9 +79,65 @@ const std::string JsonParser::Impl::ERR_MSG_NOT_EXIST_BRACKET_IN_ARRAY("There is
 const std::string JsonParser::Impl::ERR_MSG_NOT_EXIST_COMMA_IN_ARRAY("There is not ',' in array.");
 //> G[bZ[W --- sȒl
 const std::string JsonParser::Impl::ERR_MSG_VALUE_FAILURE("Value \"%s\" is Failure.");
+//> G[bZ[W --- t@CJȂ
+const std::string JsonParser::Impl::ERR_MSG_FILE_OPEN_FAILURE("File \"%s\" can not be Opened.");
 //> [jObZ[W --- objectnamedĂ
 const std::string JsonParser::Impl::WRN_MSG_NAME_REPEATED("Name \"%s\" Repeated, and Later Name is Given Priority.");
 
+/**
+ * ̃p[X̂߂ɏԂ
+ * @param[in] target     p[XΏۂ̕
+ * @param[in] targetSize p[XΏۂ̃̕TCY
+ * @remarks obt@͗eʂێ܂܍ėp. <br>
+ *          A[i[hł, Õp[XʂSĔjĂ΃A[iėp.
+ */
+void JsonParser::Impl::Reset(const char* target, size_t targetSize)
+{
+  // p[XΏ
+  m_target = target;
+  m_targetSize = targetSize;
+  m_i = 0;
+  m_depth = 0;
+  // bZ[W
+  m_errorMsg.clear();
+  m_warningMsg.clear();
+  m_nameRepeated = false;
+  m_errorCode = ERR_NONE;
+  m_errorOffset = 0;
+  m_errorKeyWord.clear();
+  // ͂̏(ێĂl̓A[i̍ėp𔻒肷Oɔj)
+  m_feeding = false;
+  m_feedState = FEED_BOM;
+  m_feedStack.clear();
+  m_feedStringIsName = false;
+  m_feedToken.clear();
+  m_feedLiteral = nullptr;
+  m_feedResult = Json();
+  // Ɨpobt@
+  m_stringBuffer.clear();
+  m_keys.Clear();
+  m_nameBuffer.clear();
+  m_indexStack.clear();
+  m_validateStack.clear();
+  m_arrayStack.Clear();
+
+  // AP[^
+  if (!m_arenaMode)
+  {
+    m_arena.reset();
+  }
+  else if (m_arena && m_arena->OwnerCount() == 1)
+  {
+    // Õp[XʂSĔjĂ(̃p[T[݂̂LĂ), A[iėp
+    m_arena->Reset();
+  }
+  else
+  {
+    m_arena = JsonArena::CreateShared();
+  }
+  m_allocator = Json::Allocator(m_arena.get());
+}
+
 /**
  * G[bZ[W쐬
  * @param[in] messageTemp G[bZ[W
@@ -222,6 +154,57 @@ const std::string JsonParser::Impl::MakeErrorMsg(const std::string& messageTemp,
   return std::string(buf);
 }
 
+/**
+ * G[R[hG[bZ[W쐬
+ * @param[in] code    G[R[h
+ * @param[in] keyWord bZ[WɖߍރL[[h(L[[h𖄂ߍ܂ȂG[ł͎gpȂ)
+ * @return G[bZ[W
+ */
+const std::string JsonParser::Impl::FormatErrorMsg(ERROR_CODE code, const std::string& keyWord) const
+{
+  switch (code)
+  {
+    case ERR_PARSE_FAILURE:
+      return ERR_MSG_PARSE_FAILURE;
+    case ERR_0HEAD_NUMBER:
+      return ERR_MSG_0HEAD_NUMBER;
+    case ERR_BAD_WORD_IN_NUMBER:
+      return ERR_MSG_BAD_WORD_IN_NUMBER;
+    case ERR_INT_NUMBER_OUT_OF_RANGE:
+      return MakeErrorMsg(ERR_MSG_INT_NUMBER_OUT_OF_RANGE, keyWord);
+    case ERR_DOUBLE_NUMBER_OUT_OF_RANGE:
+      return MakeErrorMsg(ERR_MSG_DOUBLE_NUMBER_OUT_OF_RANGE, keyWord);
+    case ERR_NOT_DIGIT_FOLLOWER_DOT:
+      return ERR_MSG_NOT_DIGIT_FOLLOWER_DOT;
+    case ERR_NOT_DIGIT_FOLLOWER_EXP:
+      return ERR_MSG_NOT_DIGIT_FOLLOWER_EXP;
+    case ERR_NOT_EXIST_DOUBLE_QUOTATION:
+      return MakeErrorMsg(ERR_MSG_NOT_EXIST_DOUBLE_QUOTATION, keyWord);
+    case ERR_ESCAPE_CHARACTER_FAILURE:
+      return MakeErrorMsg(ERR_MSG_ESCAPE_CHARACTER_FAILURE, keyWord);
+    case ERR_EXIST_CODE_IN_SURROGATE:
+      return ERR_MSG_EXIST_CODE_IN_SURROGATE;
+    case ERR_NOT_EXIST_BRACKET_IN_OBJ:
+      return ERR_MSG_NOT_EXIST_BRACKET_IN_OBJ;
+    case ERR_NOT_EXIST_COMMA_IN_OBJ:
+      return ERR_MSG_NOT_EXIST_COMMA_IN_OBJ;
+    case ERR_NOT_EXIST_DOUBLE_QUOTATION_IN_OBJ:
+      return ERR_MSG_NOT_EXIST_DOUBLE_QUOTATION_IN_OBJ;
+    case ERR_NOT_EXIST_COLON_IN_OBJ:
+      return ERR_MSG_NOT_EXIST_COLON_IN_OBJ;
+    case ERR_NOT_EXIST_BRACKET_IN_ARRAY:
+      return ERR_MSG_NOT_EXIST_BRACKET_IN_ARRAY;
+    case ERR_NOT_EXIST_COMMA_IN_ARRAY:
+      return ERR_MSG_NOT_EXIST_COMMA_IN_ARRAY;
+    case ERR_VALUE_FAILURE:
+      return MakeErrorMsg(ERR_MSG_VALUE_FAILURE, keyWord);
+    case ERR_FILE_OPEN_FAILURE:
+      return MakeErrorMsg(ERR_MSG_FILE_OPEN_FAILURE, keyWord);
+    default: // ERR_NONE
+      return std::string();
+  }
+}
+
 /**
  * 1擾(zCgXy[X̓XLbv)
  * @param[out] word i[
@@ -230,23 +213,13 @@ const std::string JsonParser::Impl::MakeErrorMsg(const std::string& messageTemp,
  */
 JsonParser::Impl::RETURN_CODE JsonParser::Impl::SkipWhitespaceAndGetWord(char* word)
 {
+  // zCgXy[X܂Ƃ߂ăXLbv
+  m_i = JsonScan::SkipWhitespace(m_target, m_targetSize, m_i);
   // Ύ擾s
-  if (m_i >= m_target.size())
+  if (m_i >= m_targetSize)
   {
     return FAILURE;
   }
-  while (m_target[m_i] == ' ' // 
-    || m_target[m_i] == '\r'  // A
-    || m_target[m_i] == '\n'  // s
-    || m_target[m_i] == '\t') // ^u
-  {
-    ++m_i;
-    // Ύ擾s
-    if (m_i >= m_target.size())
-    {
-      return FAILURE;
-    }
-  }
   // i[
   *word = m_target[m_i];
   ++m_i;
@@ -259,10 +232,10 @@ JsonParser::Impl::RETURN_CODE JsonParser::Impl::SkipWhitespaceAndGetWord(char* w
  */
 void JsonParser::Impl::SkipBOM()
 {
+  // UTF8BOMTCY擾łȂꍇBOMȂƔfĖ߂
+  if (m_targetSize - m_i < BOM_UTF8_SIZE) return;
   // BOM擾
-  std::string bom(m_target.substr(m_i, BOM_UTF8_SIZE));
-  // UTF8BOMTCY擾łȂꍇBOMȂƔfĖ߂
-  if (bom.size() != BOM_UTF8_SIZE) return;
+  const char* bom = m_target + m_i;
   // BOM`FbN
   for (int i = 0; i < BOM_UTF8_SIZE; ++i)
   {
@@ -273,6 +246,26 @@ void JsonParser::Impl::SkipBOM()
   m_i += BOM_UTF8_SIZE;
 }
 
+/**
+ * GXP[vV[PX16i4ǂݍ
+ * @param[in] hex 16i4̐擪
+ * @return l(16iłȂꍇ-1)
+ */
+int JsonParser::Impl::ReadHex4(const char* hex)
+{
+  int value = 0;
+  for (size_t i = 0; i < ESCAPE_SEQUENCE_4BYTE; ++i)
+  {
+    int digit;
+    if (hex[i] >= '0' && hex[i] <= '9') digit = hex[i] - '0';
+    else if (hex[i] >= 'a' && hex[i] <= 'f') digit = hex[i] - 'a' + 10;
+    else if (hex[i] >= 'A' && hex[i] <= 'F') digit = hex[i] - 'A' + 10;
+    else return -1;
+    value = value * HEXADECIMAL_16 + digit;
+  }
+  return value;
+}
+
 /**
  * GXP[vV[PX𕶎ɕϊ
  * @param[in] hex UNICODE16i
@@ -367,10 +360,11 @@ const std::string JsonParser::Impl::ConversionEscapeSequence(int hex)
 }
 
 /**
- * string^p[X
+ * string^ǂݍ
+ * @param[out] str i[(ɒǉ)
  * @remarks {֐I, J[\string^̎1w
  */
-Json JsonParser::Impl::ParseString()
+void JsonParser::Impl::ReadString(std::string* str)
 {
   // <string>
   //          
@@ -396,22 +390,24 @@ Json JsonParser::Impl::ParseString()
   //                   V-->'u'-->4 hex digits-->| escape sequence
   //
 
-  // obt@p
-  std::string str("");
-
   // ŏ'"'XLbv
   ++m_i;
 
   // '"'܂Ń[v
   while (true)
   {
+    // '"'܂'\'̎O܂ł܂Ƃ߂Ċi[
+    const size_t end = JsonScan::FindQuoteOrBackslash(m_target, m_targetSize, m_i);
+    str->append(m_target + m_i, end - m_i);
+    m_i = end;
+
     // ̍Ō𒴂G[
-    if (m_i >= m_target.size())
+    if (m_i >= m_targetSize)
     {
       // G[bZ[W𓊂
-      throw MakeErrorMsg(Impl::ERR_MSG_NOT_EXIST_DOUBLE_QUOTATION, '\"' + str);
+      throw MakeErrorMsg(Impl::ERR_MSG_NOT_EXIST_DOUBLE_QUOTATION, '\"' + *str);
     }
-    // 1擾
+    // 1擾('"'܂'\')
     char word = m_target[m_i];
     ++m_i;
 
@@ -422,21 +418,13 @@ Json JsonParser::Impl::ParseString()
       break;
     }
 
-    //----- GXP[vłȂꍇ -----//
-    if (word != '\\')
-    {
-      // i[Ď
-      str += word;
-      continue;
-    }
-
     //----- GXP[v̏ꍇ -----//
     // ̍Ō𒴂ĂG[
-    if (m_i >= m_target.size())
+    if (m_i >= m_targetSize)
     {
       // G[bZ[W𓊂
-      str += word;
-      throw MakeErrorMsg(Impl::ERR_MSG_ESCAPE_CHARACTER_FAILURE, '\"' + str);
+      *str += word;
+      throw MakeErrorMsg(Impl::ERR_MSG_ESCAPE_CHARACTER_FAILURE, '\"' + *str);
     }
 
     // 1擾
@@ -449,67 +437,91 @@ Json JsonParser::Impl::ParseString()
       case '\"': // quotation mark
       case '\\': // reverse solidus
       case '/':  // solidus
-        str += word;
+        *str += word;
         break;
       case 'b': // backspace
-        str += '\b';
+        *str += '\b';
         break;
       case 'f': // formfeed
-        str += '\f';
+        *str += '\f';
         break;
       case 'n': // newline
-        str += '\n';
+        *str += '\n';
         break;
       case 'r': // carriage return
-        str += '\r';
+        *str += '\r';
         break;
       case 't': // horizontal tab
-        str += '\t';
+        *str += '\t';
         break;
       case 'u': // escape sequence
       {
-        // GXP[vV[PX̒l4BYTE擾
-        std::string escapeSequence = m_target.substr(m_i, ESCAPE_SEQUENCE_4BYTE);
-        m_i += escapeSequence.size();
         // 4BYTE擾łȂ΃G[
-        if (escapeSequence.size() < ESCAPE_SEQUENCE_4BYTE)
+        if (m_targetSize - m_i < ESCAPE_SEQUENCE_4BYTE)
         {
           // G[bZ[W𓊂
-          str += word;
-          throw MakeErrorMsg(Impl::ERR_MSG_ESCAPE_CHARACTER_FAILURE, '\"' + str);
+          m_i = m_targetSize;
+          *str += word;
+          throw MakeErrorMsg(Impl::ERR_MSG_ESCAPE_CHARACTER_FAILURE, '\"' + *str);
         }
-        // 16iłȂ΃G[
-        for (int i = 0; i < ESCAPE_SEQUENCE_4BYTE; ++i)
+        // GXP[vV[PX̒l4BYTE擾(16iłȂ΃G[)
+        const int hex = ReadHex4(m_target + m_i);
+        m_i += ESCAPE_SEQUENCE_4BYTE;
+        if (hex < 0)
         {
-          if (escapeSequence[i] >= '0' && escapeSequence[i] <= '9') continue;
-          if (escapeSequence[i] >= 'a' && escapeSequence[i] <= 'f') continue;
-          if (escapeSequence[i] >= 'A' && escapeSequence[i] <= 'F') continue;
           // G[bZ[W𓊂
-          str += word;
-          throw MakeErrorMsg(Impl::ERR_MSG_ESCAPE_CHARACTER_FAILURE, '\"' + str);
+          *str += word;
+          throw MakeErrorMsg(Impl::ERR_MSG_ESCAPE_CHARACTER_FAILURE, '\"' + *str);
         }
-        // int^(10i)ɕϊ
-        int hex = std::stoi(escapeSequence, nullptr, Impl::HEXADECIMAL_16);
         // GXP[vV[PXϊstrɉZ
-        str += ConversionEscapeSequence(hex);
+        *str += ConversionEscapeSequence(hex);
       }
       break;
       default:
         // G[bZ[W𓊂
-        str += word;
-        throw MakeErrorMsg(Impl::ERR_MSG_ESCAPE_CHARACTER_FAILURE, '\"' + str);
+        *str += word;
+        throw MakeErrorMsg(Impl::ERR_MSG_ESCAPE_CHARACTER_FAILURE, '\"' + *str);
+    }
+  }
+
+}
+
+/**
+ * string^p[X
+ * @remarks {֐I, J[\string^̎1w
+ */
+Json JsonParser::Impl::ParseString()
+{
+  // Qƃ[hł, GXP[v܂܂Ȃstring͓̓obt@QƂ
+  if (m_stringViewMode)
+  {
+    const size_t start = m_i + 1;
+    const size_t end = JsonScan::FindQuoteOrBackslash(m_target, m_targetSize, start);
+    if (end < m_targetSize && m_target[end] == '\"')
+    {
+      // '"'̎֐i߂
+      m_i = end + 1;
+      //***** string^JsonIuWFNg(Q)Ԃ *****//
+      return Json(JsonStringView(m_target + start, end - start), m_allocator);
     }
   }
 
+  // obt@p
+  std::string str("");
+  // ǂݍ
+  this->ReadString(&str);
   //***** string^JsonIuWFNgԂ *****//
-  return Json(str);
+  return Json(std::move(str), m_allocator);
 }
 
 /**
- * number^p[X
- * @remarks {֐I, J[\number^̎1w
+ * number^ǂݍ(O𓊂Ȃ)
+ * @param[out] result i[
+ * @return G[R[h(ERR_NONE)
+ * @remarks {֐I, J[\number^̎1(G[̓G[oʒu)w. <br>
+ *          int^͈̔͊O̐int64^ɂ
  */
-Json JsonParser::Impl::ParseNumber()
+JsonParser::ERROR_CODE JsonParser::Impl::ScanNumber(Json* result)
 {
   // <number>                               <------------
   //                                        |           ^
@@ -527,111 +539,184 @@ Json JsonParser::Impl::ParseNumber()
   //
 
   // JnCfbNX
-  size_t start = m_i;
+  const size_t start = m_i;
+  // 
+  bool negative = false;
+  // 10ỉ(擪19܂)
+  std::uint64_t mantissa = 0;
+  // ̗L
+  int digits = 0;
+  // 10i̎w
+  int exp10 = 0;
+  // 20ڈȍ~؂̂Ă
+  bool truncated = false;
 
   // '-'mF
-  if (m_target[m_i] == '-') ++m_i;
+  if (At(m_i) == '-')
+  {
+    negative = true;
+    ++m_i;
+  }
 
   // '0'mF
-  if (m_target[m_i] == '0')
+  if (At(m_i) == '0')
   {
     ++m_i;
     // '0'n܂number^Ŏ'0'~'9'łΖ
-    if ('0' <= m_target[m_i] && m_target[m_i] <= '9')
+    if ('0' <= At(m_i) && At(m_i) <= '9')
     {
-      // G[bZ[W𓊂
-      throw Impl::ERR_MSG_0HEAD_NUMBER;
+      // G[R[hԂ
+      return ERR_0HEAD_NUMBER;
     }
   }
   // '1'~'9'mF
-  else if ('1' <= m_target[m_i] && m_target[m_i] <= '9')
+  else if ('1' <= At(m_i) && At(m_i) <= '9')
   {
-    ++m_i;
-    // 㑱'0'~'9'mF
-    while ('0' <= m_target[m_i] && m_target[m_i] <= '9') ++m_i;
+    // 㑱'0'~'9'mFȂ牼ɉ
+    while ('0' <= At(m_i) && At(m_i) <= '9')
+    {
+      if (digits < JsonNumber::MAX_MANTISSA_DIGITS)
+      {
+        mantissa = mantissa * 10 + (m_target[m_i] - '0');
+        ++digits;
+      }
+      else
+      {
+        // ؂̂Ă̕w𑝂₷
+        truncated = true;
+        ++exp10;
+      }
+      ++m_i;
+    }
   }
   // ̑̓G[
   else
   {
-    // G[bZ[W𓊂
-    throw Impl::ERR_MSG_BAD_WORD_IN_NUMBER;
+    // G[R[hԂ
+    return ERR_BAD_WORD_IN_NUMBER;
   }
 
   // int^mF
-  if (m_target[m_i] != '.'
-    && m_target[m_i] != 'e'
-    && m_target[m_i] != 'E')
+  if (At(m_i) != '.'
+    && At(m_i) != 'e'
+    && At(m_i) != 'E')
   {
-    try
+    // int^͈͓̔ł, ̂܂ܒlƂ(͐Βl1傫l܂ŕ\ł)
+    const std::uint64_t intLimit = static_cast<std::uint64_t>(INT_MAX) + (negative ? 1 : 0);
+    if (!truncated && mantissa <= intLimit)
     {
-      // int^ɕϊ(C+11STLł, string̓obt@͘Äɔzu)
-      int number = std::stoi(m_target.c_str() + start);
-      //***** int^JsonIuWFNgԂ *****//
-      return Json(number);
+      //***** int^JsonIuWFNgi[ *****//
+      *result = Json(static_cast<int>(negative ? -static_cast<long long>(mantissa) : static_cast<long long>(mantissa)));
+      return ERR_NONE;
     }
-    // ͈͊O̒lɂȂꍇ
-    catch (std::out_of_range e)
+    // int64^͈͓̔ł, int64^Ƃ
+    const std::uint64_t int64Limit = static_cast<std::uint64_t>(INT64_MAX) + (negative ? 1 : 0);
+    if (!truncated && mantissa <= int64Limit)
     {
-      // G[bZ[W𓊂
-      throw MakeErrorMsg(Impl::ERR_MSG_INT_NUMBER_OUT_OF_RANGE, m_target.c_str() + start);
-    }
-    // lւ̕ϊsȂꍇ
-    catch (std::invalid_argument e)
-    {
-      // G[bZ[W𓊂
-      throw Impl::ERR_MSG_BAD_WORD_IN_NUMBER;
+      // ̓I[o[t[Ȃ悤, Βl1Ă畄𔽓]
+      const std::int64_t number = negative
+        ? -static_cast<std::int64_t>(mantissa - 1) - 1
+        : static_cast<std::int64_t>(mantissa);
+      //***** int64^JsonIuWFNgi[ *****//
+      *result = Json(number);
+      return ERR_NONE;
     }
+    // G[R[hԂ
+    return ERR_INT_NUMBER_OUT_OF_RANGE;
   }
 
   // '.'mF
-  if (m_target[m_i] == '.')
+  if (At(m_i) == '.')
   {
     ++m_i;
     // 㑱'0'~'9'΃G[
-    if (m_target[m_i] < '0' || '9' < m_target[m_i])
+    if (At(m_i) < '0' || '9' < At(m_i))
     {
-      // G[bZ[W𓊂
-      throw Impl::ERR_MSG_NOT_DIGIT_FOLLOWER_DOT;
+      // G[R[hԂ
+      return ERR_NOT_DIGIT_FOLLOWER_DOT;
+    }
+    // 㑱'0'~'9'mFȂ牼ɉ
+    while ('0' <= At(m_i) && At(m_i) <= '9')
+    {
+      // 擪0͗LɐȂ
+      if (mantissa == 0 && m_target[m_i] == '0')
+      {
+        --exp10;
+      }
+      else if (digits < JsonNumber::MAX_MANTISSA_DIGITS)
+      {
+        mantissa = mantissa * 10 + (m_target[m_i] - '0');
+        ++digits;
+        --exp10;
+      }
+      else
+      {
+        truncated = true;
+      }
+      ++m_i;
     }
-    // 㑱'0'~'9'mF
-    while ('0' <= m_target[m_i] && m_target[m_i] <= '9') ++m_i;
   }
 
   // 'e', 'E'mF
-  if (m_target[m_i] == 'e' || m_target[m_i] == 'E')
+  if (At(m_i) == 'e' || At(m_i) == 'E')
   {
     ++m_i;
     // '+', '-'mF
-    if (m_target[m_i] == '+' || m_target[m_i] == '-') ++m_i;
+    bool expNegative = false;
+    if (At(m_i) == '+' || At(m_i) == '-')
+    {
+      expNegative = (At(m_i) == '-');
+      ++m_i;
+    }
     // 㑱'0'~'9'΃G[
-    if (m_target[m_i] < '0' || '9' < m_target[m_i])
+    if (At(m_i) < '0' || '9' < At(m_i))
     {
-      // G[bZ[W𓊂
-      throw Impl::ERR_MSG_NOT_DIGIT_FOLLOWER_EXP;
+      // G[R[hԂ
+      return ERR_NOT_DIGIT_FOLLOWER_EXP;
+    }
+    // 㑱'0'~'9'mFȂw߂(\ɔ͈͊OƂȂlőł~)
+    int exponent = 0;
+    while ('0' <= At(m_i) && At(m_i) <= '9')
+    {
+      if (exponent < MAX_EXPONENT) exponent = exponent * 10 + (m_target[m_i] - '0');
+      ++m_i;
     }
-    // 㑱'0'~'9'mF
-    while ('0' <= m_target[m_i] && m_target[m_i] <= '9') ++m_i;
+    exp10 += expNegative ? -exponent : exponent;
   }
 
-  try
+  // double^ɕϊ
+  double number;
+  JsonNumber::ToDouble(negative, mantissa, exp10, truncated, m_target + start, m_i - start, &number);
+  // ͈͊O̒l(I[o[t[, ܂0łȂl̃A_[t[)ɂȂꍇ
+  if (std::fabs(number) > DBL_MAX || (number == 0.0 && mantissa != 0))
   {
-    // double^ɕϊ(C+11STLł, string̓obt@͘Äɔzu)
-    double number = std::stod(m_target.c_str() + start);
-    //***** double^JsonIuWFNgԂ *****//
-    return Json(number);
-  }
-  // ͈͊O̒lɂȂꍇ
-  catch (std::out_of_range e)
-  {
-    // G[bZ[W𓊂
-    throw MakeErrorMsg(Impl::ERR_MSG_DOUBLE_NUMBER_OUT_OF_RANGE, m_target.c_str() + start);
+    // G[R[hԂ
+    return ERR_DOUBLE_NUMBER_OUT_OF_RANGE;
   }
-  // lւ̕ϊsȂꍇ
-  catch (std::invalid_argument e)
+  //***** double^JsonIuWFNgi[ *****//
+  *result = Json(number);
+  return ERR_NONE;
+}
+
+/**
+ * number^p[X
+ * @remarks {֐I, J[\number^̎1w
+ *          int^͈̔͊O̐int64^ɂ
+ */
+Json JsonParser::Impl::ParseNumber()
+{
+  // JnCfbNX
+  const size_t start = m_i;
+  // ǂݍ
+  Json number;
+  const ERROR_CODE code = this->ScanNumber(&number);
+  if (code != ERR_NONE)
   {
-    // G[bZ[W𓊂
-    throw Impl::ERR_MSG_BAD_WORD_IN_NUMBER;
+    // G[bZ[W𓊂(͈͊O̒lnumber^̕𖄂ߍ)
+    throw this->FormatErrorMsg(code, std::string(m_target + start, m_i - start));
   }
+  //***** number^JsonIuWFNgԂ *****//
+  return number;
 }
 
 /**
@@ -652,12 +737,13 @@ Json JsonParser::Impl::ParseObject()
   //
 
   // obt@p
-  Json::Object obj;
+  Json::Object obj(m_allocator);
   // 1st valuetOp(ŏvaluełtrueƂȂ)
   bool flag1stValue = true;
 
   // '{'XLbv
   ++m_i;
+  ++m_depth;
 
   // '}'܂Ń[v
   while (true)
@@ -697,29 +783,15 @@ Json JsonParser::Impl::ParseObject()
 
     // 1߂
     --m_i;
-    // stringi[obt@p
-    std::string key;
+    // l̊i[p
+    Json* slot = nullptr;
     // string^ł邱ƂmFăp[X(Parse֐ɑΉ悤switchŋL)
     switch (word)
     {
       case '"': // string^
-      {
-        auto stringJson = this->ParseString();
-        // snull^JsonIuWFNgԂ
-        if (stringJson.IsNull()) return Json(nullptr);
-        // string擾
-        key = stringJson.GetString();
-        // L[dĂꍇ
-        if (obj.count(key) > 0)
-        {
-          // dtOĂ
-          m_nameRepeated = true;
-          // [jObZ[Wi[
-          m_warningMsg.emplace_back(
-            MakeErrorMsg(Impl::WRN_MSG_NAME_REPEATED, key));
-        }
+        // name擾ēo^
+        slot = this->InsertName(&obj, this->ReadName());
         break;
-      }
       default: // others
         // G[bZ[W𓊂
         throw Impl::ERR_MSG_NOT_EXIST_DOUBLE_QUOTATION_IN_OBJ;
@@ -734,12 +806,59 @@ Json JsonParser::Impl::ParseObject()
     }
 
     // p[XĊi[
-    obj[key] = this->ParseValue();
+    *slot = this->ParseValue();
     // ŏvalueǂݏÎŃtO낷
     flag1stValue = false;
   }
+  --m_depth;
   //***** object^JsonIuWFNgԂ *****//
-  return Json(obj);
+  return Json(std::move(obj));
+}
+
+/**
+ * objectnameǂݍ
+ * @return name(C^[e[uɓo^)
+ * @remarks {֐I, J[\name̎1w. <br>
+ *          GXP[v܂܂Ȃ, ̓obt@璼ڃC^[e[u.
+ */
+JsonKey JsonParser::Impl::ReadName()
+{
+  // GXP[v܂܂Ȃ, ̓obt@̂̕܂܎g
+  const size_t start = m_i + 1;
+  const size_t end = JsonScan::FindQuoteOrBackslash(m_target, m_targetSize, start);
+  if (end < m_targetSize && m_target[end] == '\"')
+  {
+    m_i = end + 1;
+    return m_keys.Intern(m_target + start, end - start);
+  }
+
+  // GXP[v܂ޏꍇ͕ϊĂ猟
+  m_nameBuffer.clear();
+  this->ReadString(&m_nameBuffer);
+  return m_keys.Intern(m_nameBuffer.data(), m_nameBuffer.size());
+}
+
+/**
+ * objectnameo^
+ * @param[in,out] obj  o^
+ * @param[in]     name name([u)
+ * @return nameɑΉl̊i[
+ * @remarks namedĂꍇ̓[jObZ[Wi[, ̊i[Ԃ(̒lD悷).
+ *          namẽnbVl͓o^ς݂̂̂g, vZȂ.
+ */
+Json* JsonParser::Impl::InsertName(Json::Object* obj, JsonKey&& name)
+{
+  const auto result = obj->emplace(std::move(name), Json());
+  // L[dĂꍇ
+  if (!result.second)
+  {
+    // dtOĂ
+    m_nameRepeated = true;
+    // [jObZ[Wi[
+    m_warningMsg.emplace_back(
+      MakeErrorMsg(Impl::WRN_MSG_NAME_REPEATED, result.first->first.GetString()));
+  }
+  return &result.first->second;
 }
 
 /**
@@ -759,13 +878,21 @@ Json JsonParser::Impl::ParseArray()
   //          -------------> value ------------>
   //
 
-  // obt@p
-  Json::Array arr;
+  // 傫array͕ĕXbhŃp[X
+  if (m_threadCount > 1 && m_depth <= PARALLEL_MAX_DEPTH && m_targetSize - m_i >= PARALLEL_MIN_SIZE)
+  {
+    Json json;
+    if (this->ParseArrayParallel(&json)) return json;
+  }
+
+  // obt@p(vfSnumberłΘÄɊi[)
+  JsonArrayBuilder arr(m_allocator, &m_arrayStack);
   // 1st valuetOp(ŏvaluełtrueƂȂ)
   bool flag1stValue = true;
 
   // '['XLbv
   ++m_i;
+  ++m_depth;
 
   // ']'܂Ń[v
   while (true)
@@ -806,12 +933,13 @@ Json JsonParser::Impl::ParseArray()
     // 1߂
     --m_i;
     // p[XĊi[
-    arr.emplace_back(this->ParseValue());
+    arr.Append(this->ParseValue());
     // ŏvalueǂݏÎŃtO낷
     flag1stValue = false;
   }
+  --m_depth;
   //***** array^JsonIuWFNgԂ *****//
-  return Json(arr);
+  return arr.Build();
 }
 
 /**
@@ -821,23 +949,31 @@ Json JsonParser::Impl::ParseArray()
  */
 void JsonParser::Impl::CheckValue(const std::string& checkString)
 {
-  for (size_t i = 0; i < checkString.size(); ++i)
+  // JnCfbNX
+  const size_t start = m_i;
+  // vȂ, v𖄂ߍ񂾃G[bZ[W𓊂
+  if (!this->MatchValue(checkString.c_str()))
   {
-    // ̍Ō𒴂ĂƂ̓G[
-    if (m_i >= m_target.size())
-    {
-      // G[bZ[W𓊂
-      throw MakeErrorMsg(JsonParser::Impl::ERR_MSG_VALUE_FAILURE, m_target.substr(m_i - 1 - i, i - 1));
-    }
-    // 񂪒lƈvȂƂ̓G[
-    if (m_target[m_i] != checkString[i])
-    {
-      // G[bZ[W𓊂
-      throw MakeErrorMsg(JsonParser::Impl::ERR_MSG_VALUE_FAILURE, m_target.substr(m_i - i, i));
-    }
-    // G[łȂΎmF
+    throw MakeErrorMsg(JsonParser::Impl::ERR_MSG_VALUE_FAILURE, std::string(m_target + start, m_i - start));
+  }
+}
+
+/**
+ * lv邩mF(O𓊂Ȃ)
+ * @param[in] checkString `FbNl
+ * @return vtrue
+ * @remarks {֐I, J[\͒l̎1(sv̏ꍇ͈vȂ)w
+ */
+bool JsonParser::Impl::MatchValue(const char* checkString)
+{
+  for (; *checkString != '\0'; ++checkString)
+  {
+    // ̍Ō𒴂Ă, ܂͕񂪒lƈvȂƂ͕sv
+    if (m_i >= m_targetSize || m_target[m_i] != *checkString) return false;
+    // vΎmF
     ++m_i;
   }
+  return true;
 }
 
 /**
@@ -924,9 +1060,256 @@ Json JsonParser::Impl::ParseValue()
   }
 }
 
+/**
+ * p[XΏۂ̕Ŝp[X
+ * @return JsonIuWFNg(snull^)
+ * @remarks G[bZ[Wm_errorMsgɊi[
+ */
+Json JsonParser::Impl::ParseDocument()
+{
+  // UTF8BOM΃XLbv
+  this->SkipBOM();
+
+  try
+  {
+    // p[X
+    return this->ParseValue();
+  }
+  catch (const std::string& err)
+  {
+    // G[bZ[Wi[
+    m_errorMsg.emplace_back(err);
+    // snull^JsonIuWFNgԂ
+    return Json(nullptr);
+  }
+}
+
+/**
+ * object^p[XăCxgʒm
+ * @param[in,out] handler Cxg̒ʒm
+ * @remarks {֐I, J[\object^̎1w. <br>
+ *          @ƃG[bZ[WParseObjectƓ(namȅd͊mFȂ).
+ */
+void JsonParser::Impl::ParseObjectEvents(JsonHandler* handler)
+{
+  // o
+  size_t memberCount = 0;
+
+  // '{'XLbv
+  ++m_i;
+  this->CheckHandlerResult(handler->StartObject());
+
+  // '}'܂Ń[v
+  while (true)
+  {
+    // ̊i[p
+    char word = '\0';
+    // mF̂, ̕擾
+    if (this->SkipWhitespaceAndGetWord(&word) != Impl::SUCCESS)
+    {
+      // G[bZ[W𓊂
+      throw Impl::ERR_MSG_NOT_EXIST_BRACKET_IN_OBJ;
+    }
+
+    // '}'I
+    if (word == '}')
+    {
+      // [v𔲂
+      break;
+    }
+
+    // ŏvaluełȂƂ
+    if (memberCount > 0)
+    {
+      // ','łȂ΃G[
+      if (word != ',')
+      {
+        // G[bZ[W𓊂
+        throw Impl::ERR_MSG_NOT_EXIST_COMMA_IN_OBJ;
+      }
+      // mF̂, ̕擾
+      if (this->SkipWhitespaceAndGetWord(&word) != Impl::SUCCESS)
+      {
+        // G[bZ[W𓊂
+        throw Impl::ERR_MSG_NOT_EXIST_BRACKET_IN_OBJ;
+      }
+    }
+
+    // string^łȂ΃G[
+    if (word != '"')
+    {
+      // G[bZ[W𓊂
+      throw Impl::ERR_MSG_NOT_EXIST_DOUBLE_QUOTATION_IN_OBJ;
+    }
+    // 1߂nameǂݍ
+    --m_i;
+    m_stringBuffer.clear();
+    this->ReadString(&m_stringBuffer);
+    this->CheckHandlerResult(handler->Key(m_stringBuffer));
+
+    // mF̂, ̕擾(':'擾łȂ΃G[)
+    if (this->SkipWhitespaceAndGetWord(&word) != Impl::SUCCESS
+      || word != ':')
+    {
+      // G[bZ[W𓊂
+      throw Impl::ERR_MSG_NOT_EXIST_COLON_IN_OBJ;
+    }
+
+    // p[XĒʒm
+    this->ParseValueEvents(handler);
+    ++memberCount;
+  }
+  this->CheckHandlerResult(handler->EndObject(memberCount));
+}
+
+/**
+ * array^p[XăCxgʒm
+ * @param[in,out] handler Cxg̒ʒm
+ * @remarks {֐I, J[\array^̎1w. <br>
+ *          @ƃG[bZ[WParseArrayƓ.
+ */
+void JsonParser::Impl::ParseArrayEvents(JsonHandler* handler)
+{
+  // vf
+  size_t elementCount = 0;
+
+  // '['XLbv
+  ++m_i;
+  this->CheckHandlerResult(handler->StartArray());
+
+  // ']'܂Ń[v
+  while (true)
+  {
+    // ̊i[p
+    char word = '\0';
+    // mF̂, ̕擾
+    if (this->SkipWhitespaceAndGetWord(&word) != Impl::SUCCESS)
+    {
+      // G[bZ[W𓊂
+      throw Impl::ERR_MSG_NOT_EXIST_BRACKET_IN_ARRAY;
+    }
+
+    // ']'I
+    if (word == ']')
+    {
+      // [v𔲂
+      break;
+    }
+
+    // ŏvaluełȂƂ
+    if (elementCount > 0)
+    {
+      // ','łȂ΃G[
+      if (word != ',')
+      {
+        // G[bZ[W𓊂
+        throw Impl::ERR_MSG_NOT_EXIST_COMMA_IN_ARRAY;
+      }
+      // mF̂, ̕擾
+      if (this->SkipWhitespaceAndGetWord(&word) != Impl::SUCCESS)
+      {
+        // G[bZ[W𓊂
+        throw Impl::ERR_MSG_NOT_EXIST_BRACKET_IN_ARRAY;
+      }
+    }
+
+    // 1߂
+    --m_i;
+    // p[XĒʒm
+    this->ParseValueEvents(handler);
+    ++elementCount;
+  }
+  this->CheckHandlerResult(handler->EndArray(elementCount));
+}
+
+/**
+ * valuep[XăCxgʒm
+ * @param[in,out] handler Cxg̒ʒm
+ * @remarks @ƃG[bZ[WParseValueƓ
+ */
+void JsonParser::Impl::ParseValueEvents(JsonHandler* handler)
+{
+  // ̊i[p
+  char word = '\0';
+
+  // mF̂, ̕擾
+  if (this->SkipWhitespaceAndGetWord(&word) != Impl::SUCCESS)
+  {
+    // 擾łȂꍇ̓G[bZ[W𓊂
+    throw Impl::ERR_MSG_PARSE_FAILURE;
+  }
+  // 1߂
+  --(this->m_i);
+
+  switch (word)
+  {
+    case '"': // string^
+      m_stringBuffer.clear();
+      this->ReadString(&m_stringBuffer);
+      this->CheckHandlerResult(handler->String(m_stringBuffer));
+      break;
+
+    case '-': // number^
+    case '0':
+    case '1':
+    case '2':
+    case '3':
+    case '4':
+    case '5':
+    case '6':
+    case '7':
+    case '8':
+    case '9':
+    {
+      // number^JsonIuWFNg̓q[vgpȂ, ̂܂ܗp
+      const Json number = this->ParseNumber();
+      switch (number.GetValueType())
+      {
+        case Json::JSON_VALUE_TYPE::NUMBER_INT:
+          this->CheckHandlerResult(handler->Int(number.GetNumberInt()));
+          break;
+        case Json::JSON_VALUE_TYPE::NUMBER_INT64:
+          this->CheckHandlerResult(handler->Int64(number.GetNumberInt64()));
+          break;
+        default:
+          this->CheckHandlerResult(handler->Double(number.GetNumberDouble()));
+          break;
+      }
+      break;
+    }
+
+    case '{': // object^
+      this->ParseObjectEvents(handler);
+      break;
+
+    case '[': // array^
+      this->ParseArrayEvents(handler);
+      break;
+
+    case 't': // true
+      this->CheckValue("true");
+      this->CheckHandlerResult(handler->Bool(true));
+      break;
+
+    case 'f': // false
+      this->CheckValue("false");
+      this->CheckHandlerResult(handler->Bool(false));
+      break;
+
+    case 'n': // null
+      this->CheckValue("null");
+      this->CheckHandlerResult(handler->Null());
+      break;
+
+    default: // others
+      // G[bZ[W𓊂
+      throw JsonParser::Impl::ERR_MSG_PARSE_FAILURE;
+  }
+}
+
 /** RXgN^ */
 JsonParser::JsonParser()
-  : m_impl(std::make_unique<Impl>(""))
+  : m_impl(std::make_unique<Impl>(nullptr, 0, false, false, 1))
 {
 }
 
@@ -936,28 +1319,251 @@ JsonParser::~JsonParser() {}
 /**
  * JSON`̕p[X
  * @param[in] target p[XΏۂ̕
+ * @param[in] engine p[XGW
+ * @return JsonIuWFNg
+ * @attention ܂ł̃G[bZ[W⃏[jObZ[W
+ */
+Json JsonParser::Parse(const std::string& target, PARSE_ENGINE engine)
+{
+  return this->Parse(target.data(), target.size(), engine);
+}
+
+/**
+ * JSON`̕p[X
+ * @param[in] data p[XΏۂ̐̕擪(I[͕sv)
+ * @param[in] size p[XΏۂ̃̕TCY(byte)
+ * @param[in] engine p[XGW
  * @return JsonIuWFNg
  * @attention ܂ł̃G[bZ[W⃏[jObZ[W
  */
-Json JsonParser::Parse(const std::string& target)
+Json JsonParser::Parse(const char* data, size_t size, PARSE_ENGINE engine)
+{
+  // ȌԂ(obt@ƃA[i͍ėp)
+  m_impl->Reset(data, size);
+  // p[X
+  Json json = (engine == STRUCTURAL_INDEX) ? m_impl->ParseDocumentIndexed() : m_impl->ParseDocument();
+  // A[imۂꍇ, ŏʂ̒lA[iL
+  JsonValue::OwnArena(json);
+  return json;
+}
+
+/**
+ * JSON`̃t@Cp[X
+ * @param[in] path   p[XΏۂ̃t@CpX
+ * @param[in] engine p[XGW
+ * @return JsonIuWFNg
+ * @remarks t@C͓ǂݍݐpŃ}bv, ɃRs[ɂ̂܂܃p[X
+ * @attention ܂ł̃G[bZ[W⃏[jObZ[W
+ */
+Json JsonParser::ParseFile(const std::string& path, PARSE_ENGINE engine)
+{
+  // t@C}bv
+  std::shared_ptr<MappedFile> file = std::make_shared<MappedFile>();
+  if (!file->Open(path))
+  {
+    // ȌԂ(obt@ƃA[i͍ėp)
+    m_impl->Reset(nullptr, 0);
+    // G[bZ[Wi[
+    m_impl->m_errorMsg.emplace_back(m_impl->MakeErrorMsg(Impl::ERR_MSG_FILE_OPEN_FAILURE, path));
+    // snull^JsonIuWFNgԂ
+    return Json(nullptr);
+  }
+
+  // ȌԂ(obt@ƃA[i͍ėp)
+  m_impl->Reset(file->Data(), file->Size());
+  // Qƃ[hł, p[Xʂ}bv̈QƂ邽, A[iƈꏏɕێ
+  if (m_impl->m_stringViewMode)
+  {
+    if (!m_impl->m_arena)
+    {
+      m_impl->m_arena = JsonArena::CreateShared();
+      m_impl->m_allocator = Json::Allocator(m_impl->m_arena.get());
+    }
+    m_impl->m_arena->Retain(file);
+  }
+  // }bv̈p[X
+  Json json = (engine == STRUCTURAL_INDEX) ? m_impl->ParseDocumentIndexed() : m_impl->ParseDocument();
+  // A[imۂꍇ, ŏʂ̒lA[iL
+  JsonValue::OwnArena(json);
+  return json;
+}
+
+/**
+ * JSON`̕p[X, ǂݍ񂾒lnhɒʒm
+ * @param[in]     target  p[XΏۂ̕
+ * @param[in,out] handler Cxg̒ʒm
+ * @return Ō܂Ńp[Xłtrue(G[, ܂̓nhɂ钆f̏ꍇfalse)
+ * @attention ܂ł̃G[bZ[W⃏[jObZ[W
+ */
+bool JsonParser::ParseEvents(const std::string& target, JsonHandler* handler)
 {
-  // Pimpl
-  m_impl = std::make_unique<Impl>(target);
+  return this->ParseEvents(target.data(), target.size(), handler);
+}
+
+/**
+ * JSON`̕p[X, ǂݍ񂾒lnhɒʒm
+ * @param[in]     data    p[XΏۂ̐̕擪(I[͕sv)
+ * @param[in]     size    p[XΏۂ̃̕TCY(byte)
+ * @param[in,out] handler Cxg̒ʒm
+ * @return Ō܂Ńp[Xłtrue(G[, ܂̓nhɂ钆f̏ꍇfalse)
+ * @attention ܂ł̃G[bZ[W⃏[jObZ[W
+ */
+bool JsonParser::ParseEvents(const char* data, size_t size, JsonHandler* handler)
+{
+  // ȌԂ(obt@ƃA[i͍ėp)
+  m_impl->Reset(data, size);
   // UTF8BOM΃XLbv
   m_impl->SkipBOM();
 
   try
   {
-    // p[X
-    return m_impl->ParseValue();
+    // p[XĒʒm
+    m_impl->ParseValueEvents(handler);
+    return true;
+  }
+  catch (const Impl::StopParsing&)
+  {
+    // nhɂ钆f̓G[ƂȂ
+    return false;
   }
   catch (const std::string& err)
   {
     // G[bZ[Wi[
     m_impl->m_errorMsg.emplace_back(err);
-    // snull^JsonIuWFNgԂ
-    return Json(nullptr);
+    return false;
+  }
+}
+
+/**
+ * JSON`̃t@Cp[X, ǂݍ񂾒lnhɒʒm
+ * @param[in]     path    p[XΏۂ̃t@CpX
+ * @param[in,out] handler Cxg̒ʒm
+ * @return Ō܂Ńp[Xłtrue(G[, ܂̓nhɂ钆f̏ꍇfalse)
+ * @remarks t@C͓ǂݍݐpŃ}bv
+ * @attention ܂ł̃G[bZ[W⃏[jObZ[W
+ */
+bool JsonParser::ParseFileEvents(const std::string& path, JsonHandler* handler)
+{
+  // t@C}bv
+  MappedFile file;
+  if (!file.Open(path))
+  {
+    // ȌԂ(obt@ƃA[i͍ėp)
+    m_impl->Reset(nullptr, 0);
+    // G[bZ[Wi[
+    m_impl->m_errorMsg.emplace_back(m_impl->MakeErrorMsg(Impl::ERR_MSG_FILE_OPEN_FAILURE, path));
+    return false;
   }
+  // }bv̈p[X
+  return this->ParseEvents(file.Data(), file.Size(), handler);
+}
+
+/**
+ * JSON`̕p[X, i[ɒڊi[
+ * @param[in] data   p[XΏۂ̐̕擪(I[͕sv)
+ * @param[in] size   p[XΏۂ̃̕TCY(byte)
+ * @param[in] target i[
+ * @return Ō܂Ŋi[łtrue
+ * @attention ܂ł̃G[bZ[W⃏[jObZ[W
+ */
+bool JsonParser::ParseIntoTarget(const char* data, size_t size, const JsonBindTarget& target)
+{
+  // ǂݍ񂾒li[Ɋi[nhŃp[X
+  JsonBindHandler handler(target);
+  if (this->ParseEvents(data, size, &handler)) return true;
+  // i[łȂ(nhɂ钆f), G[bZ[Wi[
+  if (!handler.ErrorMessage().empty()) m_impl->m_errorMsg.emplace_back(handler.ErrorMessage());
+  return false;
+}
+
+/**
+ * JSON`̃t@Cp[X, i[ɒڊi[
+ * @param[in] path   p[XΏۂ̃t@CpX
+ * @param[in] target i[
+ * @return Ō܂Ŋi[łtrue
+ * @remarks t@C͓ǂݍݐpŃ}bv
+ * @attention ܂ł̃G[bZ[W⃏[jObZ[W
+ */
+bool JsonParser::ParseFileIntoTarget(const std::string& path, const JsonBindTarget& target)
+{
+  // t@C}bv
+  MappedFile file;
+  if (!file.Open(path))
+  {
+    // ȌԂ(obt@ƃA[i͍ėp)
+    m_impl->Reset(nullptr, 0);
+    // G[bZ[Wi[
+    m_impl->m_errorMsg.emplace_back(m_impl->MakeErrorMsg(Impl::ERR_MSG_FILE_OPEN_FAILURE, path));
+    return false;
+  }
+  // }bv̈p[X
+  return this->ParseIntoTarget(file.Data(), file.Size(), target);
+}
+
+/**
+ * Qƃ[hݒ肷
+ * @param[in] stringViewMode trueł, ȍ~ParsestringlRs[ɓ͂QƂ
+ */
+void JsonParser::SetStringViewMode(bool stringViewMode)
+{
+  m_impl->m_stringViewMode = stringViewMode;
+}
+
+/**
+ * Qƃ[hǂ
+ * @return Qƃ[hłtrue
+ */
+bool JsonParser::IsStringViewMode() const
+{
+  return m_impl->m_stringViewMode;
+}
+
+/**
+ * p[XɎgpXbhݒ肷
+ * @param[in] threadCount Xbh(0ł΃n[hEFÃXbh)
+ */
+void JsonParser::SetThreadCount(size_t threadCount)
+{
+  // 0ł΃n[hEFÃXbh(擾łȂ1)
+  if (threadCount == 0) threadCount = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+  m_impl->m_threadCount = threadCount;
+}
+
+/**
+ * p[XɎgpXbh擾
+ * @return Xbh
+ */
+size_t JsonParser::GetThreadCount() const
+{
+  return m_impl->m_threadCount;
+}
+
+/**
+ * A[i[hݒ肷
+ * @param[in] arenaMode trueł, ȍ~ParseőSĂ̒l1̃A[imۂ
+ */
+void JsonParser::SetArenaMode(bool arenaMode)
+{
+  m_impl->m_arenaMode = arenaMode;
+}
+
+/**
+ * A[i[hǂ
+ * @return A[i[hłtrue
+ */
+bool JsonParser::IsArenaMode() const
+{
+  return m_impl->m_arenaMode;
+}
+
+/**
+ * ێĂobt@ƃA[i
+ * @attention ܂ł̃G[bZ[W⃏[jObZ[W
+ */
+void JsonParser::ReleaseBuffers()
+{
+  // Pimpl蒼(A[i[h, Qƃ[h, Xbh͈p)
+  m_impl = std::make_unique<Impl>(nullptr, 0, m_impl->m_arenaMode, m_impl->m_stringViewMode, m_impl->m_threadCount);
 }
 
 /**
@@ -966,6 +1572,11 @@ Json JsonParser::Parse(const std::string& target)
  */
 const std::vector<std::string>& JsonParser::ErrorMessage() const
 {
+  // ValidatẽG[bZ[W͏̌Ăяoɍ쐬
+  if (m_impl->m_errorCode != ERR_NONE && m_impl->m_errorMsg.empty())
+  {
+    m_impl->m_errorMsg.emplace_back(m_impl->FormatValidateErrorMsg());
+  }
   return m_impl->m_errorMsg;
 }
 
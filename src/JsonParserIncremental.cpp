@@ -0,0 +1,596 @@
+/**
+ * @file   JsonParserIncremental.cpp
+ * @brief  JSONp[T[()
+ * @author kyo
+ * @date   2026/10/17
+ */
+#include "JsonParser.h"
+#include "JsonParserImpl.h"
+#include "Json.h"
+#include "JsonScan.h"
+#include "JsonValue.h"
+#include <cstring>
+#include <istream>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+/** Analysis Drive */
+namespace adlib
+{
+/**
+ * number^Ɏgpł镶ǂ
+ * @param[in] word 
+ * @return '0'~'9', '-', '+', '.', 'e', 'E'łtrue
+ */
+static bool IsNumberWord(char word)
+{
+  return ('0' <= word && word <= '9')
+    || word == '-' || word == '+' || word == '.' || word == 'e' || word == 'E';
+}
+
+/**
+ * ͂ꂽp[X
+ * @param[in] data ̐擪
+ * @param[in] size ̃TCY
+ * @remarks rŏIl͏ԂƂĕێ, ̓͂őp[X. <br>
+ *          @ƃG[bZ[WParseValueƓ.
+ */
+void JsonParser::Impl::FeedBytes(const char* data, size_t size)
+{
+  size_t i = 0;
+  while (i < size)
+  {
+    switch (m_feedState)
+    {
+      case FEED_BOM: // 擪BOMmF
+      {
+        // BOM̈ꕔł΂߂Ă
+        m_feedToken += data[i];
+        ++i;
+        if (std::memcmp(m_feedToken.data(), BOM_UTF8, m_feedToken.size()) == 0)
+        {
+          // BOMXLbv
+          if (m_feedToken.size() == static_cast<size_t>(BOM_UTF8_SIZE))
+          {
+            m_feedToken.clear();
+            m_feedState = FEED_TOP_VALUE;
+          }
+          break;
+        }
+        // BOMłȂ, ߂߂ē͂
+        std::string token;
+        token.swap(m_feedToken);
+        m_feedState = FEED_TOP_VALUE;
+        this->FeedBytes(token.data(), token.size());
+        break;
+      }
+
+      case FEED_TOP_VALUE:    // ŏʂvaluȇO
+      case FEED_OBJECT_VALUE: // object':'̒
+      case FEED_ARRAY_FIRST:  // array'['̒
+      case FEED_ARRAY_VALUE:  // array','̒
+      {
+        // zCgXy[XXLbv
+        i = JsonScan::SkipWhitespace(data, size, i);
+        if (i >= size) break;
+        const char word = data[i];
+
+        // array
+        if (m_feedState == FEED_ARRAY_FIRST && word == ']')
+        {
+          ++i;
+          this->FeedCloseContainer();
+          break;
+        }
+
+        // value̊Jn(ParseValueɑΉ悤switchŋL)
+        switch (word)
+        {
+          case '"': // string^
+            ++i;
+            m_stringBuffer.clear();
+            m_feedStringIsName = false;
+            m_feedState = FEED_STRING;
+            break;
+
+          case '-': // number^
+          case '0':
+          case '1':
+          case '2':
+          case '3':
+          case '4':
+          case '5':
+          case '6':
+          case '7':
+          case '8':
+          case '9':
+            m_feedToken.clear();
+            m_feedState = FEED_NUMBER;
+            break;
+
+          case '{': // object^
+          {
+            ++i;
+            FeedFrame frame;
+            frame.value = Json(Json::Object(m_allocator));
+            frame.slot = nullptr;
+            m_feedStack.emplace_back(std::move(frame));
+            m_feedState = FEED_OBJECT_FIRST;
+            break;
+          }
+
+          case '[': // array^
+          {
+            ++i;
+            FeedFrame frame;
+            frame.slot = nullptr;
+            frame.array = JsonArrayBuilder(m_allocator, &m_arrayStack);
+            m_feedStack.emplace_back(std::move(frame));
+            m_feedState = FEED_ARRAY_FIRST;
+            break;
+          }
+
+          case 't': // true
+            m_feedLiteral = "true";
+            m_feedToken.clear();
+            m_feedState = FEED_LITERAL;
+            break;
+
+          case 'f': // false
+            m_feedLiteral = "false";
+            m_feedToken.clear();
+            m_feedState = FEED_LITERAL;
+            break;
+
+          case 'n': // null
+            m_feedLiteral = "null";
+            m_feedToken.clear();
+            m_feedState = FEED_LITERAL;
+            break;
+
+          default: // others
+            // G[bZ[W𓊂
+            throw Impl::ERR_MSG_PARSE_FAILURE;
+        }
+        break;
+      }
+
+      case FEED_OBJECT_FIRST: // object'{'̒
+      case FEED_OBJECT_NAME:  // object','̒
+      {
+        // zCgXy[XXLbv
+        i = JsonScan::SkipWhitespace(data, size, i);
+        if (i >= size) break;
+        const char word = data[i];
+        ++i;
+
+        // object
+        if (m_feedState == FEED_OBJECT_FIRST && word == '}')
+        {
+          this->FeedCloseContainer();
+          break;
+        }
+        // string^łȂ΃G[
+        if (word != '"')
+        {
+          // G[bZ[W𓊂
+          throw Impl::ERR_MSG_NOT_EXIST_DOUBLE_QUOTATION_IN_OBJ;
+        }
+        m_stringBuffer.clear();
+        m_feedStringIsName = true;
+        m_feedState = FEED_STRING;
+        break;
+      }
+
+      case FEED_OBJECT_COLON: // objectname̒
+      {
+        // zCgXy[XXLbv
+        i = JsonScan::SkipWhitespace(data, size, i);
+        if (i >= size) break;
+        // ':'łȂ΃G[
+        if (data[i] != ':')
+        {
+          // G[bZ[W𓊂
+          throw Impl::ERR_MSG_NOT_EXIST_COLON_IN_OBJ;
+        }
+        ++i;
+        m_feedState = FEED_OBJECT_VALUE;
+        break;
+      }
+
+      case FEED_AFTER_VALUE: // array, objectvalue̒
+      {
+        // zCgXy[XXLbv
+        i = JsonScan::SkipWhitespace(data, size, i);
+        if (i >= size) break;
+        const char word = data[i];
+        ++i;
+
+        const bool inObject = m_feedStack.back().value.IsObject();
+        // ','łΎ̒l
+        if (word == ',')
+        {
+          m_feedState = inObject ? FEED_OBJECT_NAME : FEED_ARRAY_VALUE;
+        }
+        // ʂłΏI
+        else if (word == (inObject ? '}' : ']'))
+        {
+          this->FeedCloseContainer();
+        }
+        // ̑̓G[
+        else
+        {
+          // G[bZ[W𓊂
+          throw inObject ? Impl::ERR_MSG_NOT_EXIST_COMMA_IN_OBJ : Impl::ERR_MSG_NOT_EXIST_COMMA_IN_ARRAY;
+        }
+        break;
+      }
+
+      case FEED_STRING: // string^̓r
+      {
+        // '"'܂'\'̎O܂ł܂Ƃ߂Ċi[
+        const size_t end = JsonScan::FindQuoteOrBackslash(data, size, i);
+        m_stringBuffer.append(data + i, end - i);
+        i = end;
+        if (i >= size) break;
+        const char word = data[i];
+        ++i;
+        // '"'I, '\'̓GXP[v
+        if (word == '\"')
+        {
+          this->FeedCompleteString();
+        }
+        else
+        {
+          m_feedState = FEED_STRING_ESCAPE;
+        }
+        break;
+      }
+
+      case FEED_STRING_ESCAPE: // string^̃GXP[v̒
+      {
+        const char word = data[i];
+        ++i;
+        m_feedState = FEED_STRING;
+        // GXP[v
+        switch (word)
+        {
+          case '\"': // quotation mark
+          case '\\': // reverse solidus
+          case '/':  // solidus
+            m_stringBuffer += word;
+            break;
+          case 'b': // backspace
+            m_stringBuffer += '\b';
+            break;
+          case 'f': // formfeed
+            m_stringBuffer += '\f';
+            break;
+          case 'n': // newline
+            m_stringBuffer += '\n';
+            break;
+          case 'r': // carriage return
+            m_stringBuffer += '\r';
+            break;
+          case 't': // horizontal tab
+            m_stringBuffer += '\t';
+            break;
+          case 'u': // escape sequence
+            m_feedToken.clear();
+            m_feedState = FEED_STRING_UNICODE;
+            break;
+          default:
+            // G[bZ[W𓊂
+            m_stringBuffer += word;
+            throw MakeErrorMsg(Impl::ERR_MSG_ESCAPE_CHARACTER_FAILURE, '\"' + m_stringBuffer);
+        }
+        break;
+      }
+
+      case FEED_STRING_UNICODE: // string^̃GXP[vV[PX
+      {
+        // 4BYTE낤܂ł߂
+        while (i < size && m_feedToken.size() < ESCAPE_SEQUENCE_4BYTE)
+        {
+          m_feedToken += data[i];
+          ++i;
+        }
+        if (m_feedToken.size() < ESCAPE_SEQUENCE_4BYTE) break;
+        // 16iłȂ΃G[
+        const int hex = ReadHex4(m_feedToken.data());
+        if (hex < 0)
+        {
+          // G[bZ[W𓊂
+          m_stringBuffer += 'u';
+          throw MakeErrorMsg(Impl::ERR_MSG_ESCAPE_CHARACTER_FAILURE, '\"' + m_stringBuffer);
+        }
+        // GXP[vV[PXϊĉZ
+        m_stringBuffer += ConversionEscapeSequence(hex);
+        m_feedState = FEED_STRING;
+        break;
+      }
+
+      case FEED_NUMBER: // number^̓r
+      {
+        // number^Ɏgpł镶߂
+        const size_t start = i;
+        while (i < size && IsNumberWord(data[i])) ++i;
+        m_feedToken.append(data + start, i - start);
+        // ͂̍Ō܂number^ł, ͎̓
+        if (i >= size) break;
+        this->FeedCompleteNumber();
+        break;
+      }
+
+      case FEED_LITERAL: // true, false, null̓r
+      {
+        const size_t length = std::strlen(m_feedLiteral);
+        while (i < size && m_feedToken.size() < length)
+        {
+          // 񂪒lƈvȂƂ̓G[
+          if (data[i] != m_feedLiteral[m_feedToken.size()])
+          {
+            // G[bZ[W𓊂
+            throw MakeErrorMsg(Impl::ERR_MSG_VALUE_FAILURE, m_feedToken);
+          }
+          m_feedToken += data[i];
+          ++i;
+        }
+        if (m_feedToken.size() < length) break;
+        // lm
+        switch (m_feedLiteral[0])
+        {
+          case 't':
+            this->FeedCompleteValue(Json(true));
+            break;
+          case 'f':
+            this->FeedCompleteValue(Json(false));
+            break;
+          default:
+            this->FeedCompleteValue(Json(nullptr));
+            break;
+        }
+        break;
+      }
+
+      default: // ǂݏI, ܂̓G[͖̓͂
+        i = size;
+        break;
+    }
+  }
+}
+
+/**
+ * ͂̏I(lrŏIĂΗO𓊂)
+ * @remarks G[bZ[WParseValueœ͂̍Ō𒴂ꍇƓ
+ */
+void JsonParser::Impl::FeedFinish()
+{
+  switch (m_feedState)
+  {
+    case FEED_BOM:
+    {
+      // BOM̓rł, ߂߂ē͂ĂI
+      std::string token;
+      token.swap(m_feedToken);
+      m_feedState = FEED_TOP_VALUE;
+      this->FeedBytes(token.data(), token.size());
+      this->FeedFinish();
+      return;
+    }
+
+    case FEED_NUMBER:
+      // number^͓͂̍ŌŊm肷
+      this->FeedCompleteNumber();
+      this->FeedFinish();
+      return;
+
+    case FEED_DONE:
+      return;
+
+    case FEED_ARRAY_FIRST:
+    case FEED_ARRAY_VALUE:
+      throw Impl::ERR_MSG_NOT_EXIST_BRACKET_IN_ARRAY;
+
+    case FEED_OBJECT_FIRST:
+    case FEED_OBJECT_NAME:
+      throw Impl::ERR_MSG_NOT_EXIST_BRACKET_IN_OBJ;
+
+    case FEED_OBJECT_COLON:
+      throw Impl::ERR_MSG_NOT_EXIST_COLON_IN_OBJ;
+
+    case FEED_AFTER_VALUE:
+      throw m_feedStack.back().value.IsObject() ? Impl::ERR_MSG_NOT_EXIST_BRACKET_IN_OBJ : Impl::ERR_MSG_NOT_EXIST_BRACKET_IN_ARRAY;
+
+    case FEED_STRING:
+      throw MakeErrorMsg(Impl::ERR_MSG_NOT_EXIST_DOUBLE_QUOTATION, '\"' + m_stringBuffer);
+
+    case FEED_STRING_ESCAPE:
+      m_stringBuffer += '\\';
+      throw MakeErrorMsg(Impl::ERR_MSG_ESCAPE_CHARACTER_FAILURE, '\"' + m_stringBuffer);
+
+    case FEED_STRING_UNICODE:
+      m_stringBuffer += 'u';
+      throw MakeErrorMsg(Impl::ERR_MSG_ESCAPE_CHARACTER_FAILURE, '\"' + m_stringBuffer);
+
+    case FEED_LITERAL:
+      throw MakeErrorMsg(Impl::ERR_MSG_VALUE_FAILURE, m_feedToken);
+
+    default: // FEED_TOP_VALUE, FEED_OBJECT_VALUE
+      throw Impl::ERR_MSG_PARSE_FAILURE;
+  }
+}
+
+/**
+ * ͒string^m肷
+ */
+void JsonParser::Impl::FeedCompleteString()
+{
+  // valuełΒlƂĊm
+  if (!m_feedStringIsName)
+  {
+    this->FeedCompleteValue(Json(std::move(m_stringBuffer), m_allocator));
+    return;
+  }
+
+  // objectnamȅꍇ
+  // nameo^Ēl̊i[ێ
+  // p[Xrobject͑ƋLȂ, L֎~ɂconstłGetObjectg킸ɕύX
+  // (L֎~ɂ, p[XʂRs[邽тobject)
+  FeedFrame& frame = m_feedStack.back();
+  Json::Object* const object = const_cast<Json::Object*>(&static_cast<const Json&>(frame.value).GetObject());
+  frame.slot = this->InsertName(object, m_keys.Intern(m_stringBuffer.data(), m_stringBuffer.size()));
+  m_feedState = FEED_OBJECT_COLON;
+}
+
+/**
+ * ͒number^m肷
+ * @remarks number^ɑȂ܂ł߂Ăꍇ, ̕ȍ~͉߂ē͂
+ */
+void JsonParser::Impl::FeedCompleteNumber()
+{
+  // ߂ParseNumberŃp[X
+  std::string token;
+  token.swap(m_feedToken);
+  m_target = token.data();
+  m_targetSize = token.size();
+  m_i = 0;
+  Json number = this->ParseNumber();
+  const size_t used = m_i;
+  m_target = nullptr;
+  m_targetSize = 0;
+  m_i = 0;
+
+  // lm肵, number^ƂĎgȂ߂ē͂
+  this->FeedCompleteValue(std::move(number));
+  if (used < token.size()) this->FeedBytes(token.data() + used, token.size() - used);
+}
+
+/**
+ * ͒array, object
+ */
+void JsonParser::Impl::FeedCloseContainer()
+{
+  FeedFrame& frame = m_feedStack.back();
+  Json value(frame.value.IsObject() ? std::move(frame.value) : frame.array.Build());
+  m_feedStack.pop_back();
+  this->FeedCompleteValue(std::move(value));
+}
+
+/**
+ * ͒Ɋm肵li[
+ * @param[in] value l([u)
+ */
+void JsonParser::Impl::FeedCompleteValue(Json&& value)
+{
+  // ŏʂvaluełΏI
+  if (m_feedStack.empty())
+  {
+    m_feedResult = std::move(value);
+    m_feedState = FEED_DONE;
+    return;
+  }
+
+  // p[Xrarray, objectɊi[
+  FeedFrame& frame = m_feedStack.back();
+  if (!frame.value.IsObject())
+  {
+    frame.array.Append(std::move(value));
+  }
+  else
+  {
+    *frame.slot = std::move(value);
+  }
+  m_feedState = FEED_AFTER_VALUE;
+}
+
+/**
+ * JSON`̕𕪊ē͂
+ * @param[in] data ̐擪(I[͕sv)
+ * @param[in] size ̃TCY(byte)
+ * @attention OFinishȍ~, ŏFeedł܂ł̃G[bZ[W⃏[jObZ[W
+ */
+void JsonParser::Feed(const char* data, size_t size)
+{
+  // ͂̊Jn͑ȌԂ(obt@ƃA[i͍ėp)
+  if (!m_impl->m_feeding)
+  {
+    m_impl->Reset(nullptr, 0);
+    m_impl->m_feeding = true;
+  }
+  // G[͖̓͂
+  if (m_impl->m_feedState == Impl::FEED_FAILED) return;
+
+  try
+  {
+    // p[X
+    m_impl->FeedBytes(data, size);
+  }
+  catch (const std::string& err)
+  {
+    // G[bZ[Wi[
+    m_impl->m_errorMsg.emplace_back(err);
+    // ȍ~͖̓͂
+    m_impl->m_feedState = Impl::FEED_FAILED;
+    m_impl->m_feedStack.clear();
+  }
+}
+
+/**
+ * ͂I, p[Xʂ擾
+ * @return JsonIuWFNg(lrŏIĂꍇnull)
+ */
+Json JsonParser::Finish()
+{
+  // FeedɌĂ΂ꂽꍇ͋̓͂Ƃ
+  if (!m_impl->m_feeding) this->Feed(nullptr, 0);
+  m_impl->m_feeding = false;
+  // G[null^JsonIuWFNgԂ
+  if (m_impl->m_feedState == Impl::FEED_FAILED) return Json(nullptr);
+
+  try
+  {
+    // r̒lm肷
+    m_impl->FeedFinish();
+  }
+  catch (const std::string& err)
+  {
+    // G[bZ[Wi[
+    m_impl->m_errorMsg.emplace_back(err);
+    m_impl->m_feedState = Impl::FEED_FAILED;
+    m_impl->m_feedStack.clear();
+    // snull^JsonIuWFNgԂ
+    return Json(nullptr);
+  }
+  Json json(std::move(m_impl->m_feedResult));
+  // A[imۂꍇ, ŏʂ̒lA[iL
+  JsonValue::OwnArena(json);
+  return json;
+}
+
+/**
+ * Xg[ǂݍ݂Ȃp[X
+ * @param[in,out] stream ̓Xg[
+ * @return JsonIuWFNg
+ * @attention ܂ł̃G[bZ[W⃏[jObZ[W
+ */
+Json JsonParser::ParseStream(std::istream* stream)
+{
+  // O͔͂̕j
+  m_impl->m_feeding = false;
+  this->Feed(nullptr, 0);
+
+  // ŏʂvalueǂݏI邩, G[ɂȂ܂œǂݍ
+  std::vector<char> buf(Impl::STREAM_BUFFER_SIZE);
+  while (m_impl->m_feedState != Impl::FEED_DONE && m_impl->m_feedState != Impl::FEED_FAILED)
+  {
+    stream->read(buf.data(), static_cast<std::streamsize>(buf.size()));
+    const size_t size = static_cast<size_t>(stream->gcount());
+    if (size == 0) break;
+    this->Feed(buf.data(), size);
+  }
+  return this->Finish();
+}
+}
@@ -0,0 +1,379 @@
+/**
+ * @file   JsonParserIndexed.cpp
+ * @brief  JSONp[T[(\CfbNX)
+ * @author kyo
+ * @date   2026/10/17
+ */
+#include "JsonParser.h"
+#include "JsonParserImpl.h"
+#include "Json.h"
+#include "JsonNumber.h"
+#include "JsonScan.h"
+#include "JsonStructuralIndex.h"
+#include <cfloat>
+#include <climits>
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <utility>
+
+/** Analysis Drive */
+namespace adlib
+{
+namespace
+{
+/**
+ * ǂ
+ * @param[in] c 
+ * @return '0'~'9'łtrue
+ */
+inline bool IsDigit(char c)
+{
+  return '0' <= c && c <= '9';
+}
+
+/**
+ * number^, true, false, null̒ɗĂ悢ǂ
+ * @param[in] c 
+ * @return zCgXy[X, ܂͒ľ̍\(',', ':', ']', '}')łtrue
+ */
+inline bool IsScalarDelimiter(char c)
+{
+  switch (c)
+  {
+    case ' ':
+    case '\t':
+    case '\n':
+    case '\r':
+    case ',':
+    case ':':
+    case ']':
+    case '}':
+      return true;
+    default:
+      return false;
+  }
+}
+}
+
+/**
+ * p[XΏۂ̕Ŝ\CfbNXŃp[X
+ * @return JsonIuWFNg(snull^)
+ * @remarks \̈ʒu64byterbg}XNŋ, ̈ʒuǂJsonIuWFNg쐬. <br>
+ *          sJSON̏ꍇ, ċA~ŉ߂ăp[XēG[bZ[Wɂ.
+ */
+Json JsonParser::Impl::ParseDocumentIndexed()
+{
+  // UTF8BOM΃XLbv
+  this->SkipBOM();
+
+  try
+  {
+    return this->ParseIndexedValues();
+  }
+  catch (const IndexMismatch&)
+  {
+  }
+  catch (const std::string&)
+  {
+  }
+
+  // 쐬r̒lj(t[͎̃p[XŎg)
+  for (auto& frame : m_indexStack)
+  {
+    frame.value = Json();
+    frame.object = nullptr;
+    frame.slot = nullptr;
+  }
+  m_arrayStack.Clear();
+  m_warningMsg.clear();
+  m_nameRepeated = false;
+
+  // sJSON͍ċA~ŉ߂ăp[X(G[bZ[W𓯂ɂ邽)
+  m_i = 0;
+  return this->ParseDocument();
+}
+
+/**
+ * \CfbNXǂJsonIuWFNg쐬
+ * @return JsonIuWFNg
+ * @remarks sJSONłIndexMismatch, ܂̓G[bZ[W𓊂. <br>
+ *          zCgXy[X͍\CfbNXɖߓǂݔ΂ɍς, l͓ǂݍ񂾎_Őearray, objectɊi[.
+ */
+Json JsonParser::Impl::ParseIndexedValues()
+{
+  //! ɗׂ
+  enum EXPECT
+  {
+    EXPECT_VALUE,        /*!< value                   */
+    EXPECT_ARRAY_FIRST,  /*!< '['̒(value']')   */
+    EXPECT_OBJECT_FIRST, /*!< '{'̒(name'}')    */
+    EXPECT_NAME,         /*!< ','̒name         */
+    EXPECT_AFTER_VALUE   /*!< value̒(',') */
+  };
+
+  JsonStructuralIndex index(m_target, m_targetSize, m_i);
+  // array, object̃t[͎ɊJarray, objectŎg(X^bN̗vf͍ő̐[ɂȂ)
+  std::deque<IndexFrame>& stack = m_indexStack;
+  // JĂarray, object̐
+  size_t depth = 0;
+  // łarray, object(ŏʂvalueǂݍނ܂łnullptr)
+  IndexFrame* frame = nullptr;
+  // ŏʂvalue
+  Json result;
+  // array̗vf̓ǂݍݐ(ǂݍނтarrayɈڂ)
+  Json element;
+  EXPECT expect = EXPECT_VALUE;
+
+  while (true)
+  {
+    const char word = this->NextIndexedToken(&index);
+    // array, object(ĂȂnullptr)
+    IndexFrame* closed = nullptr;
+
+    // '['̒']'łȂvalue, '{'̒'}'łȂnameƂēǂݍ
+    if (expect == EXPECT_ARRAY_FIRST && word != ']') expect = EXPECT_VALUE;
+    else if (expect == EXPECT_OBJECT_FIRST && word != '}') expect = EXPECT_NAME;
+
+    switch (expect)
+    {
+      case EXPECT_ARRAY_FIRST:
+      case EXPECT_OBJECT_FIRST:
+        // array, object
+        ++m_i;
+        closed = frame;
+        break;
+
+      case EXPECT_VALUE:
+        if (word == '{')
+        {
+          ++m_i;
+          frame = &this->PushIndexFrame(depth++);
+          frame->value = Json(Json::Object(m_allocator));
+          // 쐬robject͑ƋLȂ, L֎~ɂconstłGetObjectg킸ɕύX
+          // (L֎~ɂ, p[XʂRs[邽тobject)
+          frame->object = const_cast<Json::Object*>(&static_cast<const Json&>(frame->value).GetObject());
+          expect = EXPECT_OBJECT_FIRST;
+          continue;
+        }
+        if (word == '[')
+        {
+          ++m_i;
+          frame = &this->PushIndexFrame(depth++);
+          frame->object = nullptr;
+          frame->array = JsonArrayBuilder(m_allocator, &m_arrayStack);
+          expect = EXPECT_ARRAY_FIRST;
+          continue;
+        }
+        break;
+
+      case EXPECT_NAME:
+        if (word != '\"') throw IndexMismatch();
+        // nameo^Ēl̊i[ێ
+        frame->slot = this->InsertName(frame->object, this->ReadName());
+        // ':'
+        if (this->NextIndexedToken(&index) != ':') throw IndexMismatch();
+        ++m_i;
+        expect = EXPECT_VALUE;
+        continue;
+
+      default: // EXPECT_AFTER_VALUE
+        ++m_i;
+        if (word == ',')
+        {
+          expect = (frame->object != nullptr) ? EXPECT_NAME : EXPECT_VALUE;
+          continue;
+        }
+        if (word != ((frame->object != nullptr) ? '}' : ']')) throw IndexMismatch();
+        closed = frame;
+        break;
+    }
+
+    if (closed != nullptr)
+    {
+      --depth;
+      frame = (depth > 0) ? &stack[depth - 1] : nullptr;
+    }
+
+    // ǂݏIvalue, eobjectłname̊i[ɒړǂݍ(ꎞIJsonIuWFNgȂ)
+    Json* const value = (frame == nullptr) ? &result : (frame->object != nullptr) ? frame->slot : &element;
+    if (closed != nullptr)
+    {
+      if (closed->object != nullptr) *value = std::move(closed->value);
+      else *value = closed->array.Build();
+    }
+    else if (word == '\"')
+    {
+      *value = this->ParseString();
+    }
+    else
+    {
+      this->ParseIndexedScalar(word, value);
+    }
+
+    // ŏʂvalueǂݏII(ȍ~͓̕ǂ܂Ȃ)
+    if (frame == nullptr) return result;
+    // earrayɊi[
+    if (frame->object == nullptr) frame->array.Append(std::move(element));
+    expect = EXPECT_AFTER_VALUE;
+  }
+}
+
+/**
+ * \CfbNX玟̒l, ܂͍\̈ʒu擾
+ * @param[in,out] index \CfbNX
+ * @return l, ܂͍\̐擪̕
+ */
+char JsonParser::Impl::NextIndexedToken(JsonStructuralIndex* index)
+{
+  size_t pos;
+  if (!index->Next(&pos)) throw IndexMismatch();
+  // O̒l̏IOłΕs
+  // (Ԃ͓̕ǂݒȂ. ľ̃zCgXy[XȊO̕, \l̐擪ƂăCfbNXɂ邩,
+  //  ParseIndexedScalarŊmFl̓r̂̕)
+  if (pos < m_i) throw IndexMismatch();
+  m_i = pos;
+  return m_target[pos];
+}
+
+/**
+ * string^ȊO̒l(number^, true, false, null)ǂݍ
+ * @param[in]  word  l̐擪̕
+ * @param[out] value i[
+ * @remarks {֐I, J[\͒l̎1w
+ */
+void JsonParser::Impl::ParseIndexedScalar(char word, Json* value)
+{
+  switch (word)
+  {
+    case '-': // number^
+    case '0':
+    case '1':
+    case '2':
+    case '3':
+    case '4':
+    case '5':
+    case '6':
+    case '7':
+    case '8':
+    case '9':
+      // PȌ`łΒڕϊ. ȊO(20ȏ, int64^, ͈͊O, sȌ`Ȃ)ParseNumberœǂݍ
+      if (!this->ParseSimpleNumber(value)) *value = this->ParseNumber();
+      break;
+
+    case 't': // true
+      this->CheckValue("true");
+      *value = Json(true);
+      break;
+
+    case 'f': // false
+      this->CheckValue("false");
+      *value = Json(false);
+      break;
+
+    case 'n': // null
+      this->CheckValue("null");
+      *value = Json(nullptr);
+      break;
+
+    default: // others
+      throw IndexMismatch();
+  }
+
+  // l̓r͍̕\CfbNXɖ, l؂ŏIĂ邱ƂmF
+  if (m_i < m_targetSize && !IsScalarDelimiter(m_target[m_i])) throw IndexMismatch();
+}
+
+/**
+ * PȌ`number^ǂݍ
+ * @param[out] number i[
+ * @return ǂݍ߂true(falsȅꍇ̓J[\ړȂ)
+ * @remarks 19ȉŎw3ȉdouble^, int^͈̔͂̐, 1͈̔͊mFɓǂݍ.
+ *          ϊʂParseNumberƓɂȂ. <br>
+ *          {֐I, J[\number^̎1w
+ */
+bool JsonParser::Impl::ParseSimpleNumber(Json* number)
+{
+  const char* const begin = m_target + m_i;
+  const char* const end = m_target + m_targetSize;
+  const char* p = begin;
+  const bool negative = (*p == '-');
+  if (negative) ++p;
+
+  // ('0', ܂'1'~'9'n܂鐔̕)
+  const char* const intBegin = p;
+  std::uint64_t mantissa = 0;
+  while (p < end && IsDigit(*p)) mantissa = mantissa * 10 + (*p++ - '0');
+  size_t digits = static_cast<size_t>(p - intBegin);
+  if (digits == 0 || (*intBegin == '0' && digits > 1)) return false;
+
+  // 
+  int exp10 = 0;
+  bool integer = true;
+  if (p < end && *p == '.')
+  {
+    integer = false;
+    const char* const fracBegin = ++p;
+    while (p < end && IsDigit(*p)) mantissa = mantissa * 10 + (*p++ - '0');
+    if (p == fracBegin) return false;
+    digits += static_cast<size_t>(p - fracBegin);
+    exp10 = -static_cast<int>(p - fracBegin);
+  }
+  // 20ȏ͉I[o[t[\
+  if (digits > static_cast<size_t>(JsonNumber::MAX_MANTISSA_DIGITS)) return false;
+
+  // w
+  if (p < end && (*p == 'e' || *p == 'E'))
+  {
+    integer = false;
+    ++p;
+    bool expNegative = false;
+    if (p < end && (*p == '+' || *p == '-'))
+    {
+      expNegative = (*p == '-');
+      ++p;
+    }
+    const char* const expBegin = p;
+    int exponent = 0;
+    while (p < end && IsDigit(*p) && p - expBegin < 3) exponent = exponent * 10 + (*p++ - '0');
+    if (p == expBegin || (p < end && IsDigit(*p))) return false;
+    exp10 += expNegative ? -exponent : exponent;
+  }
+
+  if (integer)
+  {
+    // int^͈̔͊Oint64^Ƃ
+    const std::uint64_t intLimit = static_cast<std::uint64_t>(INT_MAX) + (negative ? 1 : 0);
+    if (mantissa > intLimit) return false;
+    *number = Json(static_cast<int>(negative ? -static_cast<long long>(mantissa) : static_cast<long long>(mantissa)));
+  }
+  else
+  {
+    double value;
+    JsonNumber::ToDouble(negative, mantissa, exp10, false, begin, static_cast<size_t>(p - begin), &value);
+    // ͈͊O̒l̓G[ɂ
+    if (std::fabs(value) > DBL_MAX || (value == 0.0 && mantissa != 0)) return false;
+    *number = Json(value);
+  }
+  m_i = static_cast<size_t>(p - m_target);
+  return true;
+}
+
+/**
+ * 쐬rarray, object̃t[ǉ
+ * @param[in] depth ǉʒu(JĂarray, object̐)
+ * @return t[(lnull, i[nullptr)
+ * @remarks ̃t[, lڂIĂ邽߂̂܂܎g
+ */
+JsonParser::Impl::IndexFrame& JsonParser::Impl::PushIndexFrame(size_t depth)
+{
+  if (depth == m_indexStack.size())
+  {
+    IndexFrame frame;
+    frame.object = nullptr;
+    frame.slot = nullptr;
+    m_indexStack.push_back(frame);
+  }
+  return m_indexStack[depth];
+}
+}
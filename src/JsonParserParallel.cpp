@@ -0,0 +1,220 @@
+/**
+ * @file   JsonParserParallel.cpp
+ * @brief  JSONp[T[(傫array̕Xbhł̃p[X)
+ * @author kyo
+ * @date   2026/10/17
+ */
+#include "JsonParser.h"
+#include "JsonParserImpl.h"
+#include "Json.h"
+#include "JsonArena.h"
+#include "JsonArrayBuilder.h"
+#include "JsonStructuralIndex.h"
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/** Analysis Drive */
+namespace adlib
+{
+namespace
+{
+/** array̗vf */
+struct ArrayChunk
+{
+  size_t begin;                     //!< 擪̈ʒu(O','܂'['̎)
+  size_t end;                       //!< I[̈ʒu(','܂']')
+  std::shared_ptr<JsonArena> arena; //!< vfmۂA[i(vfɔj)
+  Json values;                      //!< p[Xvf(array)
+  std::vector<std::string> warning; //!< [jObZ[W
+  bool nameRepeated;                //!< objectnamedĂtrue
+  bool failed;                      //!< p[XɎstrue
+};
+
+/**
+ * array̗vf擾
+ * @param[in] array array^JsonIuWFNg
+ * @return vf(Äarray͗vfƂJsonIuWFNg쐬ɐ)
+ */
+size_t CountElements(const Json& array)
+{
+  if (array.IsDoubleArray()) return array.GetDoubleSpan().Size();
+  if (array.IsInt64Array()) return array.GetInt64Span().Size();
+  return array.GetArray().size();
+}
+}
+
+//> XbhŃp[Xarray̍ŏTCY(byte)
+const size_t JsonParser::Impl::PARALLEL_MIN_SIZE = 1024 * 1024;
+//> XbhŃp[Xarray̍ő̃lXg̐[(0ł΍ŏʂarraŷ)
+const size_t JsonParser::Impl::PARALLEL_MAX_DEPTH = 1;
+//> array̕ʒǔ̍ŏԊu(byte)
+const size_t JsonParser::Impl::PARALLEL_SPLIT_INTERVAL = 16 * 1024;
+//> 1Xbh̕
+const size_t JsonParser::Impl::PARALLEL_CHUNKS_PER_THREAD = 4;
+
+/**
+ * 傫array^𕪊ĕXbhŃp[X
+ * @param[out] json i[
+ * @return p[Xłtrue(array, sJSONȂǂ̏ꍇfalse)
+ * @remarks \CfbNXőΉ']', [','(ʒǔ)ɋ,
+ *          vf̋؂ŕ͈͂eXbhŃp[X, ̏1arrayɂ܂Ƃ߂. <br>
+ *          falsȅꍇ̓J[\ύXȂ(Ăяo1XbhŃp[X).
+ */
+bool JsonParser::Impl::ParseArrayParallel(Json* json)
+{
+  // '['̈ʒu
+  const size_t open = m_i;
+
+  // Ή']', ԊuƂ̕ʒǔ([',')߂
+  JsonStructuralIndex index(m_target, m_targetSize, open + 1);
+  std::vector<size_t> candidates;
+  size_t nextCandidate = open + PARALLEL_SPLIT_INTERVAL;
+  size_t depth = 0;
+  size_t close = 0;
+  size_t pos;
+  while (close == 0 && index.Next(&pos))
+  {
+    switch (m_target[pos])
+    {
+      case '{':
+      case '[':
+        ++depth;
+        break;
+      case '}':
+      case ']':
+        if (depth == 0) close = pos;
+        else --depth;
+        break;
+      case ',':
+        if (depth == 0 && pos >= nextCandidate)
+        {
+          candidates.push_back(pos);
+          nextCandidate = pos + PARALLEL_SPLIT_INTERVAL;
+        }
+        break;
+      default: // l̐擪, ':'
+        break;
+    }
+  }
+  // ĂȂ, ܂͏array1XbhŃp[X
+  if (close == 0 || m_target[close] != ']' || close - open < PARALLEL_MIN_SIZE || candidates.empty()) return false;
+
+  // ʒuϓɑI
+  const size_t numChunks = std::min(m_threadCount * PARALLEL_CHUNKS_PER_THREAD, candidates.size() + 1);
+  std::vector<ArrayChunk> chunks(numChunks);
+  size_t begin = open + 1;
+  for (size_t n = 0; n < numChunks; ++n)
+  {
+    size_t end = close;
+    if (n + 1 < numChunks)
+    {
+      const size_t target = open + (close - open) * (n + 1) / numChunks;
+      const auto split = std::lower_bound(candidates.begin(), candidates.end(), std::max(target, begin));
+      if (split != candidates.end()) end = *split;
+    }
+    chunks[n].begin = begin;
+    chunks[n].end = end;
+    chunks[n].nameRepeated = false;
+    chunks[n].failed = false;
+    if (end == close)
+    {
+      chunks.resize(n + 1);
+      break;
+    }
+    begin = end + 1;
+  }
+
+  // A[imۂĂꍇ, XbhƂ̃A[imۂ
+  const bool useArena = static_cast<bool>(m_arena);
+  // eXbh, cĂ͈͂Ɏoăp[X
+  std::atomic<size_t> next(0);
+  auto worker = [&]()
+  {
+    for (size_t n = next++; n < chunks.size(); n = next++)
+    {
+      ArrayChunk& chunk = chunks[n];
+      try
+      {
+        // ͈͂Ƃ̃p[T[(A[i̓XbhƂɍ쐬)
+        Impl impl(m_target + chunk.begin, chunk.end - chunk.begin, useArena, m_stringViewMode, 1);
+        impl.m_depth = m_depth + 1;
+        JsonArrayBuilder values(impl.m_allocator, &impl.m_arrayStack);
+        impl.ParseArrayElements(&values);
+        chunk.arena = impl.m_arena;
+        chunk.values = values.Build();
+        chunk.warning = std::move(impl.m_warningMsg);
+        chunk.nameRepeated = impl.m_nameRepeated;
+      }
+      catch (...)
+      {
+        // sꍇ1XbhŃp[XăG[ɂ
+        chunk.failed = true;
+      }
+    }
+  };
+  std::vector<std::thread> threads;
+  for (size_t n = 1; n < std::min(m_threadCount, chunks.size()); ++n)
+  {
+    try
+    {
+      threads.emplace_back(worker);
+    }
+    catch (const std::system_error&)
+    {
+      // Xbh쐬łȂ, 쐬ς݂̃Xbhő
+      break;
+    }
+  }
+  worker();
+  for (auto& thread : threads) thread.join();
+
+  // 1łsĂ1XbhŃp[X
+  size_t size = 0;
+  for (const auto& chunk : chunks)
+  {
+    if (chunk.failed) return false;
+    size += CountElements(chunk.values);
+  }
+
+  // ̏1arrayɂ܂Ƃ߂
+  JsonArrayBuilder arr(m_allocator, &m_arrayStack);
+  arr.Reserve(size);
+  for (auto& chunk : chunks)
+  {
+    // XbhƂ̃A[i, ܂Ƃ߂arraỹA[iƈꏏɕێ
+    if (chunk.arena) m_arena->Retain(chunk.arena);
+    arr.AppendElements(&chunk.values);
+    m_warningMsg.insert(m_warningMsg.end(), chunk.warning.begin(), chunk.warning.end());
+    if (chunk.nameRepeated) m_nameRepeated = true;
+  }
+  m_i = close + 1;
+  *json = arr.Build();
+  return true;
+}
+
+/**
+ * array^̗vf(','؂value)p[X
+ * @param[out] arr i[(ɒǉ)
+ * @remarks p[XΏۂ̍̕Ō܂œǂݍ(słΗO𓊂)
+ */
+void JsonParser::Impl::ParseArrayElements(JsonArrayBuilder* arr)
+{
+  while (true)
+  {
+    // p[XĊi[
+    arr->Append(this->ParseValue());
+    // Ō܂œǂݍ񂾂I
+    char word = '\0';
+    if (this->SkipWhitespaceAndGetWord(&word) != Impl::SUCCESS) return;
+    // ','łȂ΃G[
+    if (word != ',') throw Impl::ERR_MSG_NOT_EXIST_COMMA_IN_ARRAY;
+  }
+}
+}
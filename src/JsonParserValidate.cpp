@@ -0,0 +1,370 @@
+/**
+ * @file   JsonParserValidate.cpp
+ * @brief  JSONp[T[(؂̂)
+ * @author kyo
+ * @date   2026/10/17
+ */
+#include "JsonParser.h"
+#include "JsonParserImpl.h"
+#include "Json.h"
+#include "JsonScan.h"
+#include "MappedFile.h"
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+/** Analysis Drive */
+namespace adlib
+{
+//> ؃G[̃L[[hƂĕێőTCY(GXP[vV[PXϊĂbZ[W̃obt@TCY𒴂钷)
+const size_t JsonParser::Impl::MAX_ERROR_KEYWORD_SIZE = JsonParser::Impl::BUFFER_SIZE * 6;
+
+/**
+ * ؃G[i[
+ * @param[in] code         G[R[h
+ * @param[in] offset       G[oʒu
+ * @param[in] keyWordStart bZ[WɖߍރL[[h̊Jnʒu(L[[h̏I[̓J[\ʒu)
+ * @return G[R[h
+ * @remarks L[[h͕ϊÔ̕܂܃Rs[, bZ[WFormatValidateErrorMsgō쐬
+ */
+JsonParser::ERROR_CODE JsonParser::Impl::SetValidateError(ERROR_CODE code, size_t offset, size_t keyWordStart)
+{
+  m_errorCode = code;
+  m_errorOffset = offset;
+  m_errorKeyWord.assign(m_target + keyWordStart, std::min(m_i - keyWordStart, MAX_ERROR_KEYWORD_SIZE));
+  return code;
+}
+
+/**
+ * ؃G[̃G[bZ[W쐬
+ * @return G[bZ[W
+ * @remarks string^̃G[ł, i[L[[h߂ēǂݍ, ParseƓbZ[Wɂ
+ */
+const std::string JsonParser::Impl::FormatValidateErrorMsg() const
+{
+  // string^̃G[, GXP[vV[PXϊ𖄂ߍ
+  if (m_errorCode == ERR_NOT_EXIST_DOUBLE_QUOTATION || m_errorCode == ERR_ESCAPE_CHARACTER_FAILURE)
+  {
+    Impl impl(m_errorKeyWord.data(), m_errorKeyWord.size(), false, false, 1);
+    std::string str;
+    try
+    {
+      // L[[h̓G[̈ʒuŏIĂ邽, KG[ɂȂ
+      impl.ReadString(&str);
+    }
+    catch (const std::string&)
+    {
+    }
+    return FormatErrorMsg(m_errorCode, '\"' + str);
+  }
+  return FormatErrorMsg(m_errorCode, m_errorKeyWord);
+}
+
+/**
+ * string^؂(O𓊂Ȃ)
+ * @return G[R[h(ERR_NONE)
+ * @remarks ϊ͍쐬Ȃ. <br>
+ *          {֐I, J[\string^̎1(G[̓G[oʒu)w.
+ */
+JsonParser::ERROR_CODE JsonParser::Impl::ValidateString()
+{
+  // ŏ'"'XLbv
+  const size_t quote = m_i;
+  ++m_i;
+
+  // '"'܂Ń[v
+  while (true)
+  {
+    // '"'܂'\'̎O܂ł܂Ƃ߂ăXLbv
+    m_i = JsonScan::FindQuoteOrBackslash(m_target, m_targetSize, m_i);
+    // ̍Ō𒴂G[
+    if (m_i >= m_targetSize) return SetValidateError(ERR_NOT_EXIST_DOUBLE_QUOTATION, m_targetSize, quote);
+
+    // '"'I
+    const size_t escape = m_i;
+    ++m_i;
+    if (m_target[escape] == '\"') return ERR_NONE;
+
+    //----- GXP[v̏ꍇ -----//
+    // ̍Ō𒴂ĂG[
+    if (m_i >= m_targetSize) return SetValidateError(ERR_ESCAPE_CHARACTER_FAILURE, escape, quote);
+
+    // GXP[v
+    switch (m_target[m_i++])
+    {
+      case '\"': // quotation mark
+      case '\\': // reverse solidus
+      case '/':  // solidus
+      case 'b':  // backspace
+      case 'f':  // formfeed
+      case 'n':  // newline
+      case 'r':  // carriage return
+      case 't':  // horizontal tab
+        break;
+      case 'u': // escape sequence
+      {
+        // 4BYTE擾łȂ΃G[
+        if (m_targetSize - m_i < ESCAPE_SEQUENCE_4BYTE)
+        {
+          m_i = m_targetSize;
+          return SetValidateError(ERR_ESCAPE_CHARACTER_FAILURE, escape, quote);
+        }
+        // GXP[vV[PX̒l4BYTE擾(16iłȂ΃G[)
+        const int hex = ReadHex4(m_target + m_i);
+        m_i += ESCAPE_SEQUENCE_4BYTE;
+        if (hex < 0) return SetValidateError(ERR_ESCAPE_CHARACTER_FAILURE, escape, quote);
+        // TQ[g̈ 0xD800 ~ 0xDFFF (gp֎~)
+        if (0xD800 <= hex && hex <= 0xDFFF) return SetValidateError(ERR_EXIST_CODE_IN_SURROGATE, escape, m_i);
+        break;
+      }
+      default:
+        return SetValidateError(ERR_ESCAPE_CHARACTER_FAILURE, escape, quote);
+    }
+  }
+}
+
+/**
+ * objectname':'؂(O𓊂Ȃ)
+ * @return G[R[h(ERR_NONE)
+ * @remarks {֐Jn, J[\name̐擪w. {֐I, J[\':'̎1w.
+ */
+JsonParser::ERROR_CODE JsonParser::Impl::ValidateName()
+{
+  // string^ł邱ƂmF
+  if (this->At(m_i) != '\"') return SetValidateError(ERR_NOT_EXIST_DOUBLE_QUOTATION_IN_OBJ, m_i, m_i);
+  const ERROR_CODE code = this->ValidateString();
+  if (code != ERR_NONE) return code;
+
+  // ':'
+  char word = '\0';
+  if (this->SkipWhitespaceAndGetWord(&word) != Impl::SUCCESS) return SetValidateError(ERR_NOT_EXIST_COLON_IN_OBJ, m_i, m_i);
+  if (word != ':') return SetValidateError(ERR_NOT_EXIST_COLON_IN_OBJ, m_i - 1, m_i);
+  return ERR_NONE;
+}
+
+/**
+ * p[XΏۂ̕Ŝ؂(O𓊂Ȃ)
+ * @return G[R[h(ERR_NONE)
+ * @remarks JsonIuWFNg쐬, @݂̂mF(objectnamȅd͊mFȂ). <br>
+ *          lXg͍ċAɃX^bNŊǗ. mF̏ԂParseDocumentƓ, G[ɂȂ.
+ */
+JsonParser::ERROR_CODE JsonParser::Impl::ValidateDocument()
+{
+  //! ɗׂ
+  enum EXPECT
+  {
+    EXPECT_VALUE,        /*!< value                   */
+    EXPECT_ARRAY_FIRST,  /*!< '['̒(value']')   */
+    EXPECT_OBJECT_FIRST, /*!< '{'̒(name'}')    */
+    EXPECT_AFTER_VALUE   /*!< value̒(',') */
+  };
+
+  // UTF8BOM΃XLbv
+  this->SkipBOM();
+
+  // JĂarray, object('['܂'{', ł)
+  std::vector<char>& open = m_validateStack;
+  open.clear();
+  EXPECT expect = EXPECT_VALUE;
+  ERROR_CODE code = ERR_NONE;
+
+  while (true)
+  {
+    // ̕擾
+    char word = '\0';
+    const bool exist = (this->SkipWhitespaceAndGetWord(&word) == Impl::SUCCESS);
+    // valueǂݏItrue
+    bool completed = false;
+
+    switch (expect)
+    {
+      case EXPECT_VALUE:
+      {
+        if (!exist) return SetValidateError(ERR_PARSE_FAILURE, m_i, m_i);
+        // 1߂
+        --m_i;
+        const size_t start = m_i;
+        switch (word)
+        {
+          case '\"': // string^
+            code = this->ValidateString();
+            if (code != ERR_NONE) return code;
+            completed = true;
+            break;
+
+          case '-': // number^
+          case '0':
+          case '1':
+          case '2':
+          case '3':
+          case '4':
+          case '5':
+          case '6':
+          case '7':
+          case '8':
+          case '9':
+          {
+            Json number;
+            code = this->ScanNumber(&number);
+            if (code != ERR_NONE) return SetValidateError(code, m_i, start);
+            completed = true;
+            break;
+          }
+
+          case '{': // object^
+          case '[': // array^
+            ++m_i;
+            open.push_back(word);
+            expect = (word == '{') ? EXPECT_OBJECT_FIRST : EXPECT_ARRAY_FIRST;
+            break;
+
+          case 't': // true
+          case 'f': // false
+          case 'n': // null
+            if (!this->MatchValue((word == 't') ? "true" : (word == 'f') ? "false" : "null"))
+            {
+              return SetValidateError(ERR_VALUE_FAILURE, m_i, start);
+            }
+            completed = true;
+            break;
+
+          default: // others
+            return SetValidateError(ERR_PARSE_FAILURE, m_i, m_i);
+        }
+        break;
+      }
+
+      case EXPECT_ARRAY_FIRST:
+        if (!exist) return SetValidateError(ERR_NOT_EXIST_BRACKET_IN_ARRAY, m_i, m_i);
+        // array
+        if (word == ']')
+        {
+          open.pop_back();
+          completed = true;
+          break;
+        }
+        // 1߂valueƂēǂݍ
+        --m_i;
+        expect = EXPECT_VALUE;
+        break;
+
+      case EXPECT_OBJECT_FIRST:
+        if (!exist) return SetValidateError(ERR_NOT_EXIST_BRACKET_IN_OBJ, m_i, m_i);
+        // object
+        if (word == '}')
+        {
+          open.pop_back();
+          completed = true;
+          break;
+        }
+        // 1߂nameƂēǂݍ
+        --m_i;
+        code = this->ValidateName();
+        if (code != ERR_NONE) return code;
+        expect = EXPECT_VALUE;
+        break;
+
+      default: // EXPECT_AFTER_VALUE
+      {
+        const bool inObject = (open.back() == '{');
+        const ERROR_CODE noBracket = inObject ? ERR_NOT_EXIST_BRACKET_IN_OBJ : ERR_NOT_EXIST_BRACKET_IN_ARRAY;
+        if (!exist) return SetValidateError(noBracket, m_i, m_i);
+        // 
+        if (word == (inObject ? '}' : ']'))
+        {
+          open.pop_back();
+          completed = true;
+          break;
+        }
+        // ','łȂ΃G[
+        if (word != ',') return SetValidateError(inObject ? ERR_NOT_EXIST_COMMA_IN_OBJ : ERR_NOT_EXIST_COMMA_IN_ARRAY, m_i - 1, m_i);
+        // mF̂, ̕擾
+        if (this->SkipWhitespaceAndGetWord(&word) != Impl::SUCCESS) return SetValidateError(noBracket, m_i, m_i);
+        // 1߂
+        --m_i;
+        if (inObject)
+        {
+          code = this->ValidateName();
+          if (code != ERR_NONE) return code;
+        }
+        expect = EXPECT_VALUE;
+        break;
+      }
+    }
+
+    if (!completed) continue;
+    // ŏʂvalueǂݏII(ȍ~͓̕ǂ܂Ȃ)
+    if (open.empty()) return ERR_NONE;
+    expect = EXPECT_AFTER_VALUE;
+  }
+}
+
+/**
+ * JSON`̕؂
+ * @param[in] target ؑΏۂ̕
+ * @return G[R[h(JSONłERR_NONE)
+ * @attention ܂ł̃G[bZ[W⃏[jObZ[W
+ */
+JsonParser::ERROR_CODE JsonParser::Validate(const std::string& target)
+{
+  return this->Validate(target.data(), target.size());
+}
+
+/**
+ * JSON`̕؂
+ * @param[in] data ؑΏۂ̐̕擪(I[͕sv)
+ * @param[in] size ؑΏۂ̃̕TCY(byte)
+ * @return G[R[h(JSONłERR_NONE)
+ * @attention ܂ł̃G[bZ[W⃏[jObZ[W
+ */
+JsonParser::ERROR_CODE JsonParser::Validate(const char* data, size_t size)
+{
+  // ȌԂ(obt@ƃA[i͍ėp)
+  m_impl->Reset(data, size);
+  // ؂
+  return m_impl->ValidateDocument();
+}
+
+/**
+ * JSON`̃t@C؂
+ * @param[in] path ؑΏۂ̃t@CpX
+ * @return G[R[h(JSONłERR_NONE)
+ * @remarks t@C͓ǂݍݐpŃ}bv
+ * @attention ܂ł̃G[bZ[W⃏[jObZ[W
+ */
+JsonParser::ERROR_CODE JsonParser::ValidateFile(const std::string& path)
+{
+  // t@C}bv
+  MappedFile file;
+  if (!file.Open(path))
+  {
+    // ȌԂ(obt@ƃA[i͍ėp)
+    m_impl->Reset(nullptr, 0);
+    // G[R[hi[(t@CpXL[[hƂ)
+    m_impl->m_errorCode = ERR_FILE_OPEN_FAILURE;
+    m_impl->m_errorKeyWord = path;
+    return ERR_FILE_OPEN_FAILURE;
+  }
+  // }bv̈؂
+  return this->Validate(file.Data(), file.Size());
+}
+
+/**
+ * OValidatẽG[R[h擾
+ * @return G[R[h(, ܂ValidateȊȌꍇERR_NONE)
+ */
+JsonParser::ERROR_CODE JsonParser::ErrorCode() const
+{
+  return m_impl->m_errorCode;
+}
+
+/**
+ * OValidateŃG[oʒu擾
+ * @return ؑΏۂ̐擪̈ʒu(byte)
+ */
+size_t JsonParser::ErrorOffset() const
+{
+  return m_impl->m_errorOffset;
+}
+}
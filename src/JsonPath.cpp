@@ -0,0 +1,385 @@
+/**
+ * @file   JsonPath.cpp
+ * @brief  JSONIuWFNg̃pX(JSON Pointer)
+ * @author kyo
+ * @date   2026/10/17
+ */
+#include "JsonPath.h"
+#include "JsonObject.h"
+#include "JsonView.h"
+#include <string>
+#include <utility>
+
+/** Analysis Drive */
+namespace adlib
+{
+//> G[bZ[Wi[obt@TCY
+const size_t JsonPath::BUFFER_SIZE = 256;
+//> YłȂꍇ̒l
+const size_t JsonPath::NPOS = static_cast<size_t>(-1);
+//> G[bZ[W --- pX'/'Ŏn܂ĂȂ
+const std::string JsonPath::ERR_MSG_NOT_START_WITH_SLASH("JSON Pointer \"%.128s\" does not Start with '/'.");
+//> G[bZ[W --- sȃGXP[v
+const std::string JsonPath::ERR_MSG_ESCAPE_CHARACTER_FAILURE("JSON Pointer \"%.128s\" has Invalid Escape Character.");
+//> G[bZ[W --- Y̐擪0
+const std::string JsonPath::ERR_MSG_LEADING_ZERO_INDEX("JSON Pointer \"%.128s\" has Index with Leading Zero.");
+
+/** RXgN^(JsonIuWFNgŜwpX) */
+JsonPath::JsonPath() {}
+
+/**
+ * RXgN^
+ * @param[in] pointer pX(u/method/timestepv, u/node//coordv̌`)
+ * @remarks pX͂. sȃpXłIsValidfalseɂȂ, ]ĂvȂ.
+ */
+JsonPath::JsonPath(const std::string& pointer)
+  :m_pointer(pointer)
+{
+  try
+  {
+    this->Compile();
+  }
+  catch (const std::string& errorMsg)
+  {
+    m_segments.clear();
+    m_errorMsg = errorMsg;
+  }
+}
+
+/** pX͂(sȃpXł΃G[bZ[Wthrow) */
+void JsonPath::Compile()
+{
+  // ̃pXJsonIuWFNgS
+  if (m_pointer.empty()) return;
+  if (m_pointer[0] != '/') throw this->MakeErrorMessage(JsonPath::ERR_MSG_NOT_START_WITH_SLASH);
+
+  size_t begin = 1;
+  while (true)
+  {
+    size_t end = m_pointer.find('/', begin);
+    if (end == std::string::npos) end = m_pointer.size();
+
+    // GXP[v(~0, ~1)߂
+    std::string token;
+    token.reserve(end - begin);
+    for (size_t i = begin; i < end; ++i)
+    {
+      if (m_pointer[i] != '~')
+      {
+        token += m_pointer[i];
+        continue;
+      }
+      if (i + 1 >= end) throw this->MakeErrorMessage(JsonPath::ERR_MSG_ESCAPE_CHARACTER_FAILURE);
+      if (m_pointer[i + 1] == '0') token += '~';
+      else if (m_pointer[i + 1] == '1') token += '/';
+      else throw this->MakeErrorMessage(JsonPath::ERR_MSG_ESCAPE_CHARACTER_FAILURE);
+      ++i;
+    }
+
+    // 擪02ȏ͓̐YƂĕs
+    if (token.size() > 1 && token[0] == '0'
+      && token.find_first_not_of("0123456789") == std::string::npos)
+    {
+      throw this->MakeErrorMessage(JsonPath::ERR_MSG_LEADING_ZERO_INDEX);
+    }
+
+    // name̓nbVlvZĂ, Y͐lɂĂ
+    Segment segment;
+    segment.wildcard = (token == "*");
+    segment.index = JsonPath::ParseIndex(token);
+    segment.name = JsonKey(std::move(token));
+    m_segments.push_back(std::move(segment));
+
+    if (end == m_pointer.size()) break;
+    begin = end + 1;
+  }
+}
+
+/**
+ * G[bZ[W쐬
+ * @param[in] messageTemp G[bZ[W
+ * @return pX𖄂ߍ񂾃G[bZ[W
+ */
+std::string JsonPath::MakeErrorMessage(const std::string& messageTemp) const
+{
+  // obt@p
+  char buf[JsonPath::BUFFER_SIZE];
+  // G[bZ[W쐬
+  sprintf_s(buf, sizeof(buf), messageTemp.c_str(), m_pointer.c_str());
+  return buf;
+}
+
+/**
+ * array̓Y͂
+ * @param[in] token Kw̕
+ * @return Y(YƂĕsłNPOS)
+ */
+size_t JsonPath::ParseIndex(const std::string& token)
+{
+  // , 擪02ȏ͓Ył͂Ȃ
+  if (token.empty() || (token[0] == '0' && token.size() > 1)) return JsonPath::NPOS;
+
+  size_t index = 0;
+  for (const char c : token)
+  {
+    if (c < '0' || c > '9') return JsonPath::NPOS;
+    const size_t digit = static_cast<size_t>(c - '0');
+    if (index > (JsonPath::NPOS - 1 - digit) / 10) return JsonPath::NPOS;
+    index = index * 10 + digit;
+  }
+  return index;
+}
+
+/**
+ * KwɈvq擾
+ * @param[in]  node    e̒l
+ * @param[in]  segment Kw
+ * @param[out] child   q
+ * @return qtrue
+ * @remarks ÄɕێĂarray͗vf̒lRs[(vfƂJsonIuWFNg쐬Ȃ)
+ */
+bool JsonPath::Child(const JsonView& node, const Segment& segment, JsonView* child)
+{
+  const Json& json = node.GetJson();
+  if (json.IsObject())
+  {
+    const Json* const value = json.Find(segment.name);
+    if (value == nullptr) return false;
+    *child = JsonView(value);
+    return true;
+  }
+  if (json.IsArray() && segment.index != JsonPath::NPOS && segment.index < node.Size())
+  {
+    *child = node[segment.index];
+    return true;
+  }
+  return false;
+}
+
+/**
+ * wʒu̎q擾(ChJ[hp)
+ * @param[in]  node     e̒l
+ * @param[in]  position ʒu
+ * @param[out] child    q
+ * @return qtrue
+ */
+bool JsonPath::ChildAt(const JsonView& node, size_t position, JsonView* child)
+{
+  if ((!node.IsArray() && !node.IsObject()) || position >= node.Size()) return false;
+  *child = node[position];
+  return true;
+}
+
+/**
+ * pXǂ
+ * @return ͂łĂtrue
+ */
+bool JsonPath::IsValid() const
+{
+  return m_errorMsg.empty();
+}
+
+/**
+ * G[bZ[W擾
+ * @return G[bZ[W(ł΋)
+ */
+const std::string& JsonPath::ErrorMessage() const
+{
+  return m_errorMsg;
+}
+
+/**
+ * pX擾
+ * @return RXgN^Ŏw肵pX
+ */
+const std::string& JsonPath::GetPointer() const
+{
+  return m_pointer;
+}
+
+/**
+ * ChJ[h܂ނǂ
+ * @return u*v̊Kwtrue
+ */
+bool JsonPath::HasWildcard() const
+{
+  for (const auto& segment : m_segments)
+  {
+    if (segment.wildcard) return true;
+  }
+  return false;
+}
+
+/**
+ * ŏɈvl擾
+ * @param[in]  root  ]JsonIuWFNg
+ * @param[out] value vl
+ * @return vtrue(vȂvalueύXȂ)
+ */
+bool JsonPath::Find(const Json& root, JsonView* value) const
+{
+  const Iterator it(this, &root);
+  if (it == Iterator()) return false;
+  *value = *it;
+  return true;
+}
+
+/**
+ * ŏɈvl擾
+ * @param[in] root ]JsonIuWFNg
+ * @return vl(null)
+ */
+JsonView JsonPath::Get(const Json& root) const
+{
+  JsonView value;
+  this->Find(root, &value);
+  return value;
+}
+
+/**
+ * vlSė񋓂
+ * @param[in] root ]JsonIuWFNg
+ * @return vl͈̔(񋓂邽тɎ̈vT)
+ * @attention rootƖ{IuWFNg, 񋓂I܂ŗLł邱
+ */
+JsonPath::Range JsonPath::Select(const Json& root) const
+{
+  return Range(this, &root);
+}
+
+/**
+ * pX̒lݒ肷
+ * @param[in,out] root  ݒ肷JsonIuWFNg
+ * @param[in]     value l
+ * @return ݒ肷true(sȃpX, ChJ[h܂ރpX, r̊Kwꍇ͕ύXȂ)
+ * @remarks oH̒l͋LĂ΃Rs[(Json::EditObject, Json::EditArray). oHO̒l͋L܂.
+ */
+bool JsonPath::Set(Json* root, Json value) const
+{
+  if (!this->IsValid() || this->HasWildcard()) return false;
+
+  // r̊KwΉRs[ɏI悤, ɑ݂m߂
+  const size_t depth = m_segments.size();
+  if (depth > 0)
+  {
+    JsonView parent(root);
+    for (size_t i = 0; i + 1 < depth; ++i)
+    {
+      JsonView child;
+      if (!JsonPath::Child(parent, m_segments[i], &child)) return false;
+      parent = child;
+    }
+    const Segment& last = m_segments.back();
+    if (!parent.IsObject() && !(parent.IsArray() && last.index != JsonPath::NPOS && last.index <= parent.Size())) return false;
+  }
+
+  // oH̒l؂藣Ȃ炽ǂ
+  Json* node = root;
+  for (size_t i = 0; i < depth; ++i)
+  {
+    const Segment& segment = m_segments[i];
+    const bool isLast = (i + 1 == depth);
+    Json::Object* const object = node->EditObject();
+    if (object != nullptr)
+    {
+      if (isLast)
+      {
+        (*object)[segment.name] = std::move(value);
+        return true;
+      }
+      node = &object->find(segment.name)->second;
+      continue;
+    }
+    Json::Array* const array = node->EditArray();
+    if (isLast && segment.index == array->size())
+    {
+      array->push_back(std::move(value));
+      return true;
+    }
+    node = &(*array)[segment.index];
+  }
+  *node = std::move(value);
+  return true;
+}
+
+/**
+ * RXgN^
+ * @param[in] path pX
+ * @param[in] root ]JsonIuWFNg
+ */
+JsonPath::Iterator::Iterator(const JsonPath* path, const Json* root)
+  :m_path(path),
+   m_root(root),
+   m_matched(false)
+{
+  // sȃpX͈vȂ
+  if (!m_path->IsValid()) return;
+  if (!this->Descend(JsonView(root), 0)) this->Next();
+}
+
+/**
+ * vr
+ * @param[in] obj rΏ
+ * @return ʒu(܂͋ɏI[)łtrue
+ */
+bool JsonPath::Iterator::operator==(const Iterator& obj) const
+{
+  if (!m_matched || !obj.m_matched) return m_matched == obj.m_matched;
+  // pXœlǂĂ, 񋓒̈ʒuŔr
+  if (m_path != obj.m_path || m_root != obj.m_root || m_stack.size() != obj.m_stack.size()) return false;
+  for (size_t i = 0; i < m_stack.size(); ++i)
+  {
+    if (m_stack[i].position != obj.m_stack[i].position) return false;
+  }
+  return true;
+}
+
+/**
+ * ẘKw疖̊Kw܂łǂ
+ * @param[in] node    ǂn߂l
+ * @param[in] segment ǂn߂Kw
+ * @return vtrue(ChJ[h̏ꍇ͗񋓂Jnfalse)
+ */
+bool JsonPath::Iterator::Descend(const JsonView& node, size_t segment)
+{
+  const std::vector<Segment>& segments = m_path->m_segments;
+  JsonView current(node);
+  for (; segment < segments.size(); ++segment)
+  {
+    // ChJ[h͎q̗񋓂Jn(Nextłǂ)
+    if (segments[segment].wildcard)
+    {
+      // array, objectȊO͎qȂ
+      if (!current.IsArray() && !current.IsObject()) return false;
+      const Cursor cursor = { current, segment, 0 };
+      m_stack.push_back(cursor);
+      return false;
+    }
+    JsonView child;
+    if (!JsonPath::Child(current, segments[segment], &child)) return false;
+    current = child;
+  }
+  m_current = current;
+  m_matched = true;
+  return true;
+}
+
+/** ̈vT(ΏI[ɂȂ) */
+void JsonPath::Iterator::Next()
+{
+  while (!m_stack.empty())
+  {
+    // ł[ChJ[h̎̎q炽ǂ
+    Cursor& cursor = m_stack.back();
+    JsonView child;
+    if (!JsonPath::ChildAt(cursor.node, cursor.position, &child))
+    {
+      m_stack.pop_back();
+      continue;
+    }
+    ++cursor.position;
+    if (this->Descend(child, cursor.segment + 1)) return;
+  }
+  m_matched = false;
+}
+}
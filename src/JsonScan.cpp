@@ -0,0 +1,536 @@
+/**
+ * @file   JsonScan.cpp
+ * @brief  JSON̑(SIMD)
+ * @author kyo
+ * @date   2026/10/17
+ */
+#include "JsonScan.h"
+#include <atomic>
+
+// x86/x64łSIMDgp
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+#define JSONSCAN_X86
+#include <emmintrin.h>
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+// MSVC͊֐Pʂ̎wȂőSĂ̖߃Zbgintrinsicgpł
+#define JSONSCAN_TARGET_SSE2
+#define JSONSCAN_TARGET_AVX2
+#else
+#define JSONSCAN_TARGET_SSE2 __attribute__((target("sse2")))
+#define JSONSCAN_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+/** Analysis Drive */
+namespace adlib
+{
+namespace
+{
+//> gp(̊Ԃ-1)
+std::atomic<int> s_isa(-1);
+
+/**
+ * zCgXy[Xǂ
+ * @param[in] c 
+ * @return zCgXy[X(' ', '\\t', '\\r', '\\n')łtrue
+ */
+inline bool IsWhitespace(char c)
+{
+  return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+}
+
+/**
+ * zCgXy[XXLbv(XJ[)
+ * @param[in] data ̐擪
+ * @param[in] size ̃TCY
+ * @param[in] i    ̊Jnʒu
+ * @return iȍ~ōŏ̃zCgXy[XłȂʒu(size)
+ */
+size_t SkipWhitespaceScalar(const char* data, size_t size, size_t i)
+{
+  while (i < size && IsWhitespace(data[i])) ++i;
+  return i;
+}
+
+/**
+ * '"'܂'\\'T(XJ[)
+ * @param[in] data ̐擪
+ * @param[in] size ̃TCY
+ * @param[in] i    ̊Jnʒu
+ * @return iȍ~ōŏ'"'܂'\\'̈ʒu(size)
+ */
+size_t FindQuoteOrBackslashScalar(const char* data, size_t size, size_t i)
+{
+  while (i < size && data[i] != '\"' && data[i] != '\\') ++i;
+  return i;
+}
+
+/**
+ * JSONo͎ɃGXP[vKvȕT(XJ[)
+ * @param[in] data ̐擪
+ * @param[in] size ̃TCY
+ * @param[in] i    ̊Jnʒu
+ * @return iȍ~ōŏ'"', '\\', 䕶̈ʒu(size)
+ */
+size_t FindEscapeCharacterScalar(const char* data, size_t size, size_t i)
+{
+  while (i < size && data[i] != '\"' && data[i] != '\\' && static_cast<unsigned char>(data[i]) >= 0x20) ++i;
+  return i;
+}
+
+/**
+ * 64bytẽubN𕶎̎ނƂɃrbg}XN(XJ[)
+ * @param[in]  block ubN̐擪
+ * @param[out] masks i[
+ */
+void ClassifyBlockScalar(const char* block, JsonScan::BlockMasks* masks)
+{
+  std::uint64_t quote = 0;
+  std::uint64_t backslash = 0;
+  std::uint64_t whitespace = 0;
+  std::uint64_t op = 0;
+  for (size_t i = 0; i < JsonScan::BLOCK_SIZE; ++i)
+  {
+    const std::uint64_t bit = static_cast<std::uint64_t>(1) << i;
+    switch (block[i])
+    {
+      case '\"':
+        quote |= bit;
+        break;
+      case '\\':
+        backslash |= bit;
+        break;
+      case ' ':
+      case '\t':
+      case '\r':
+      case '\n':
+        whitespace |= bit;
+        break;
+      case '{':
+      case '}':
+      case '[':
+      case ']':
+      case ':':
+      case ',':
+        op |= bit;
+        break;
+      default:
+        break;
+    }
+  }
+  masks->quote = quote;
+  masks->backslash = backslash;
+  masks->whitespace = whitespace;
+  masks->op = op;
+}
+
+#if defined(JSONSCAN_X86)
+/**
+ * ŉʂ1rbg̈ʒu擾
+ * @param[in] mask 0ȊO̒l
+ * @return ŉʂ1rbg̈ʒu
+ */
+inline unsigned CountTrailingZeros(unsigned mask)
+{
+#if defined(_MSC_VER)
+  unsigned long index;
+  _BitScanForward(&index, mask);
+  return static_cast<unsigned>(index);
+#else
+  return static_cast<unsigned>(__builtin_ctz(mask));
+#endif
+}
+
+/**
+ * gp\Ȏ𔻒肷
+ * @return CPUOSΉĂŏʂ̎
+ */
+JsonScan::SCAN_ISA DetectIsa()
+{
+#if defined(_MSC_VER)
+  int info[4];
+  __cpuid(info, 0);
+  const int maxLeaf = info[0];
+  __cpuid(info, 1);
+  // SSE2(EDX bit26)
+  if ((info[3] & (1 << 26)) == 0) return JsonScan::SCALAR;
+  // AVX2OSYMMWX^ۑ(OSXSAVE: ECX bit27, XCR0 bit1,2)ꍇ̂ݎgp
+  const bool osxsave = (info[2] & (1 << 27)) != 0;
+  const bool avx = (info[2] & (1 << 28)) != 0;
+  if (maxLeaf >= 7 && osxsave && avx && (_xgetbv(0) & 0x6) == 0x6)
+  {
+    __cpuidex(info, 7, 0);
+    // AVX2(EBX bit5)
+    if ((info[1] & (1 << 5)) != 0) return JsonScan::AVX2;
+  }
+  return JsonScan::SSE2;
+#else
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2")) return JsonScan::AVX2;
+  if (__builtin_cpu_supports("sse2")) return JsonScan::SSE2;
+  return JsonScan::SCALAR;
+#endif
+}
+
+/**
+ * zCgXy[XXLbv(SSE2, 16byteP)
+ * @param[in] data ̐擪
+ * @param[in] size ̃TCY
+ * @param[in] i    ̊Jnʒu
+ * @return iȍ~ōŏ̃zCgXy[XłȂʒu(size)
+ */
+JSONSCAN_TARGET_SSE2
+size_t SkipWhitespaceSse2(const char* data, size_t size, size_t i)
+{
+  const __m128i space = _mm_set1_epi8(' ');
+  const __m128i lf = _mm_set1_epi8('\n');
+  const __m128i cr = _mm_set1_epi8('\r');
+  const __m128i tab = _mm_set1_epi8('\t');
+  for (; i + 16 <= size; i += 16)
+  {
+    const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+    const __m128i ws = _mm_or_si128(
+      _mm_or_si128(_mm_cmpeq_epi8(chunk, space), _mm_cmpeq_epi8(chunk, lf)),
+      _mm_or_si128(_mm_cmpeq_epi8(chunk, cr), _mm_cmpeq_epi8(chunk, tab)));
+    // zCgXy[XłȂ̃rbg𗧂Ă
+    const unsigned mask = ~static_cast<unsigned>(_mm_movemask_epi8(ws)) & 0xFFFF;
+    if (mask != 0) return i + CountTrailingZeros(mask);
+  }
+  // 16byte̎c̓XJ[ő
+  return SkipWhitespaceScalar(data, size, i);
+}
+
+/**
+ * '"'܂'\\'T(SSE2, 16byteP)
+ * @param[in] data ̐擪
+ * @param[in] size ̃TCY
+ * @param[in] i    ̊Jnʒu
+ * @return iȍ~ōŏ'"'܂'\\'̈ʒu(size)
+ */
+JSONSCAN_TARGET_SSE2
+size_t FindQuoteOrBackslashSse2(const char* data, size_t size, size_t i)
+{
+  const __m128i quote = _mm_set1_epi8('\"');
+  const __m128i backslash = _mm_set1_epi8('\\');
+  for (; i + 16 <= size; i += 16)
+  {
+    const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+    const __m128i hit = _mm_or_si128(_mm_cmpeq_epi8(chunk, quote), _mm_cmpeq_epi8(chunk, backslash));
+    const unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(hit));
+    if (mask != 0) return i + CountTrailingZeros(mask);
+  }
+  // 16byte̎c̓XJ[ő
+  return FindQuoteOrBackslashScalar(data, size, i);
+}
+
+/**
+ * JSONo͎ɃGXP[vKvȕT(SSE2, 16byteP)
+ * @param[in] data ̐擪
+ * @param[in] size ̃TCY
+ * @param[in] i    ̊Jnʒu
+ * @return iȍ~ōŏ'"', '\\', 䕶̈ʒu(size)
+ */
+JSONSCAN_TARGET_SSE2
+size_t FindEscapeCharacterSse2(const char* data, size_t size, size_t i)
+{
+  const __m128i quote = _mm_set1_epi8('\"');
+  const __m128i backslash = _mm_set1_epi8('\\');
+  const __m128i control = _mm_set1_epi8(0x1F);
+  for (; i + 16 <= size; i += 16)
+  {
+    const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+    // Ȃ0x1Fȉ(max(chunk, 0x1F) == 0x1F)𐧌䕶Ƃ
+    const __m128i isControl = _mm_cmpeq_epi8(_mm_max_epu8(chunk, control), control);
+    const __m128i hit = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, quote), _mm_cmpeq_epi8(chunk, backslash)), isControl);
+    const unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(hit));
+    if (mask != 0) return i + CountTrailingZeros(mask);
+  }
+  // 16byte̎c̓XJ[ő
+  return FindEscapeCharacterScalar(data, size, i);
+}
+
+/**
+ * 64bytẽubN𕶎̎ނƂɃrbg}XN(SSE2, 16byte x 4)
+ * @param[in]  block ubN̐擪
+ * @param[out] masks i[
+ */
+JSONSCAN_TARGET_SSE2
+void ClassifyBlockSse2(const char* block, JsonScan::BlockMasks* masks)
+{
+  masks->quote = 0;
+  masks->backslash = 0;
+  masks->whitespace = 0;
+  masks->op = 0;
+  for (int k = 0; k < 4; ++k)
+  {
+    const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + k * 16));
+    const __m128i ws = _mm_or_si128(
+      _mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8(' ')), _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\n'))),
+      _mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('\r')), _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\t'))));
+    // '{''}', '['']'0x20̃rbgΈv
+    const __m128i folded = _mm_or_si128(chunk, _mm_set1_epi8(0x20));
+    const __m128i op = _mm_or_si128(
+      _mm_or_si128(_mm_cmpeq_epi8(folded, _mm_set1_epi8('{')), _mm_cmpeq_epi8(folded, _mm_set1_epi8('}'))),
+      _mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8(':')), _mm_cmpeq_epi8(chunk, _mm_set1_epi8(','))));
+    const int shift = k * 16;
+    masks->quote |= static_cast<std::uint64_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('\"')))) << shift;
+    masks->backslash |= static_cast<std::uint64_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('\\')))) << shift;
+    masks->whitespace |= static_cast<std::uint64_t>(_mm_movemask_epi8(ws)) << shift;
+    masks->op |= static_cast<std::uint64_t>(_mm_movemask_epi8(op)) << shift;
+  }
+}
+
+/**
+ * zCgXy[XXLbv(AVX2, 32byteP)
+ * @param[in] data ̐擪
+ * @param[in] size ̃TCY
+ * @param[in] i    ̊Jnʒu
+ * @return iȍ~ōŏ̃zCgXy[XłȂʒu(size)
+ */
+JSONSCAN_TARGET_AVX2
+size_t SkipWhitespaceAvx2(const char* data, size_t size, size_t i)
+{
+  const __m256i space = _mm256_set1_epi8(' ');
+  const __m256i lf = _mm256_set1_epi8('\n');
+  const __m256i cr = _mm256_set1_epi8('\r');
+  const __m256i tab = _mm256_set1_epi8('\t');
+  for (; i + 32 <= size; i += 32)
+  {
+    const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+    const __m256i ws = _mm256_or_si256(
+      _mm256_or_si256(_mm256_cmpeq_epi8(chunk, space), _mm256_cmpeq_epi8(chunk, lf)),
+      _mm256_or_si256(_mm256_cmpeq_epi8(chunk, cr), _mm256_cmpeq_epi8(chunk, tab)));
+    // zCgXy[XłȂ̃rbg𗧂Ă
+    const unsigned mask = ~static_cast<unsigned>(_mm256_movemask_epi8(ws));
+    if (mask != 0) return i + CountTrailingZeros(mask);
+  }
+  // 32byte̎cSSE2ő
+  return SkipWhitespaceSse2(data, size, i);
+}
+
+/**
+ * '"'܂'\\'T(AVX2, 32byteP)
+ * @param[in] data ̐擪
+ * @param[in] size ̃TCY
+ * @param[in] i    ̊Jnʒu
+ * @return iȍ~ōŏ'"'܂'\\'̈ʒu(size)
+ */
+JSONSCAN_TARGET_AVX2
+size_t FindQuoteOrBackslashAvx2(const char* data, size_t size, size_t i)
+{
+  const __m256i quote = _mm256_set1_epi8('\"');
+  const __m256i backslash = _mm256_set1_epi8('\\');
+  for (; i + 32 <= size; i += 32)
+  {
+    const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+    const __m256i hit = _mm256_or_si256(_mm256_cmpeq_epi8(chunk, quote), _mm256_cmpeq_epi8(chunk, backslash));
+    const unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(hit));
+    if (mask != 0) return i + CountTrailingZeros(mask);
+  }
+  // 32byte̎cSSE2ő
+  return FindQuoteOrBackslashSse2(data, size, i);
+}
+/**
+ * JSONo͎ɃGXP[vKvȕT(AVX2, 32byteP)
+ * @param[in] data ̐擪
+ * @param[in] size ̃TCY
+ * @param[in] i    ̊Jnʒu
+ * @return iȍ~ōŏ'"', '\\', 䕶̈ʒu(size)
+ */
+JSONSCAN_TARGET_AVX2
+size_t FindEscapeCharacterAvx2(const char* data, size_t size, size_t i)
+{
+  const __m256i quote = _mm256_set1_epi8('\"');
+  const __m256i backslash = _mm256_set1_epi8('\\');
+  const __m256i control = _mm256_set1_epi8(0x1F);
+  for (; i + 32 <= size; i += 32)
+  {
+    const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+    // Ȃ0x1Fȉ(max(chunk, 0x1F) == 0x1F)𐧌䕶Ƃ
+    const __m256i isControl = _mm256_cmpeq_epi8(_mm256_max_epu8(chunk, control), control);
+    const __m256i hit = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(chunk, quote), _mm256_cmpeq_epi8(chunk, backslash)), isControl);
+    const unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(hit));
+    if (mask != 0) return i + CountTrailingZeros(mask);
+  }
+  // 32byte̎cSSE2ő
+  return FindEscapeCharacterSse2(data, size, i);
+}
+
+/**
+ * 64bytẽubN𕶎̎ނƂɃrbg}XN(AVX2, 32byte x 2)
+ * @param[in]  block ubN̐擪
+ * @param[out] masks i[
+ */
+JSONSCAN_TARGET_AVX2
+void ClassifyBlockAvx2(const char* block, JsonScan::BlockMasks* masks)
+{
+  masks->quote = 0;
+  masks->backslash = 0;
+  masks->whitespace = 0;
+  masks->op = 0;
+  for (int k = 0; k < 2; ++k)
+  {
+    const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block + k * 32));
+    const __m256i ws = _mm256_or_si256(
+      _mm256_or_si256(_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(' ')), _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('\n'))),
+      _mm256_or_si256(_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('\r')), _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('\t'))));
+    // '{''}', '['']'0x20̃rbgΈv
+    const __m256i folded = _mm256_or_si256(chunk, _mm256_set1_epi8(0x20));
+    const __m256i op = _mm256_or_si256(
+      _mm256_or_si256(_mm256_cmpeq_epi8(folded, _mm256_set1_epi8('{')), _mm256_cmpeq_epi8(folded, _mm256_set1_epi8('}'))),
+      _mm256_or_si256(_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(':')), _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(','))));
+    const int shift = k * 32;
+    masks->quote |= static_cast<std::uint64_t>(static_cast<std::uint32_t>(
+      _mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('\"'))))) << shift;
+    masks->backslash |= static_cast<std::uint64_t>(static_cast<std::uint32_t>(
+      _mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('\\'))))) << shift;
+    masks->whitespace |= static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm256_movemask_epi8(ws))) << shift;
+    masks->op |= static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm256_movemask_epi8(op))) << shift;
+  }
+}
+#else
+/**
+ * gp\Ȏ𔻒肷
+ * @return x86/x64ȊO͏ɃXJ[
+ */
+JsonScan::SCAN_ISA DetectIsa()
+{
+  return JsonScan::SCALAR;
+}
+#endif
+
+/**
+ * gp擾(̂ݔ肷)
+ * @return ̎
+ * @remarks Xbh瓯ɔ肵Ăʂ͓ɂȂ邽, r͂Ȃ
+ */
+inline JsonScan::SCAN_ISA CurrentIsa()
+{
+  int isa = s_isa.load(std::memory_order_relaxed);
+  if (isa < 0)
+  {
+    isa = DetectIsa();
+    s_isa.store(isa, std::memory_order_relaxed);
+  }
+  return static_cast<JsonScan::SCAN_ISA>(isa);
+}
+}
+
+/**
+ * zCgXy[XXLbv
+ * @param[in] data ̐擪
+ * @param[in] size ̃TCY
+ * @param[in] i    ̊Jnʒu
+ * @return iȍ~ōŏ̃zCgXy[X(' ', '\\t', '\\r', '\\n')łȂʒu(size)
+ */
+size_t JsonScan::SkipWhitespace(const char* data, size_t size, size_t i)
+{
+  // zCgXy[X, ܂1̏ꍇ, 擪̓XJ[ŊmF
+  if (i >= size || !IsWhitespace(data[i])) return i;
+  ++i;
+  if (i >= size || !IsWhitespace(data[i])) return i;
+
+#if defined(JSONSCAN_X86)
+  switch (CurrentIsa())
+  {
+    case AVX2:
+      return SkipWhitespaceAvx2(data, size, i);
+    case SSE2:
+      return SkipWhitespaceSse2(data, size, i);
+    default:
+      break;
+  }
+#endif
+  return SkipWhitespaceScalar(data, size, i);
+}
+
+/**
+ * '"'܂'\\'T
+ * @param[in] data ̐擪
+ * @param[in] size ̃TCY
+ * @param[in] i    ̊Jnʒu
+ * @return iȍ~ōŏ'"'܂'\\'̈ʒu(size)
+ */
+size_t JsonScan::FindQuoteOrBackslash(const char* data, size_t size, size_t i)
+{
+#if defined(JSONSCAN_X86)
+  switch (CurrentIsa())
+  {
+    case AVX2:
+      return FindQuoteOrBackslashAvx2(data, size, i);
+    case SSE2:
+      return FindQuoteOrBackslashSse2(data, size, i);
+    default:
+      break;
+  }
+#endif
+  return FindQuoteOrBackslashScalar(data, size, i);
+}
+
+/**
+ * JSONo͎ɃGXP[vKvȕT
+ * @param[in] data ̐擪
+ * @param[in] size ̃TCY
+ * @param[in] i    ̊Jnʒu
+ * @return iȍ~ōŏ'"', '\\', 䕶(0x00`0x1F)̈ʒu(size)
+ */
+size_t JsonScan::FindEscapeCharacter(const char* data, size_t size, size_t i)
+{
+#if defined(JSONSCAN_X86)
+  switch (CurrentIsa())
+  {
+    case AVX2:
+      return FindEscapeCharacterAvx2(data, size, i);
+    case SSE2:
+      return FindEscapeCharacterSse2(data, size, i);
+    default:
+      break;
+  }
+#endif
+  return FindEscapeCharacterScalar(data, size, i);
+}
+
+/**
+ * 64bytẽubN𕶎̎ނƂɃrbg}XN
+ * @param[in]  block ubN̐擪(BLOCK_SIZEǂݍ߂邱)
+ * @param[out] masks i[
+ */
+void JsonScan::ClassifyBlock(const char* block, BlockMasks* masks)
+{
+#if defined(JSONSCAN_X86)
+  switch (CurrentIsa())
+  {
+    case AVX2:
+      ClassifyBlockAvx2(block, masks);
+      return;
+    case SSE2:
+      ClassifyBlockSse2(block, masks);
+      return;
+    default:
+      break;
+  }
+#endif
+  ClassifyBlockScalar(block, masks);
+}
+
+/**
+ * gpĂ擾
+ * @return ̎
+ */
+JsonScan::SCAN_ISA JsonScan::Isa()
+{
+  return CurrentIsa();
+}
+
+/**
+ * gp𐧌
+ * @param[in] isa gp̏(CPUΉĂȂΑΉĂɉ)
+ */
+void JsonScan::LimitIsa(SCAN_ISA isa)
+{
+  const SCAN_ISA detected = DetectIsa();
+  s_isa.store((isa < detected) ? isa : detected, std::memory_order_relaxed);
+}
+}
@@ -0,0 +1,110 @@
+/**
+ * @file   JsonSink.cpp
+ * @brief  JSONo͐
+ * @author kyo
+ * @date   2026/10/17
+ */
+#include "JsonSink.h"
+#include <cstdio>
+#include <ostream>
+#include <string>
+
+/** Analysis Drive */
+namespace adlib
+{
+/** RXgN^ */
+JsonSink::JsonSink() {}
+
+/** zfXgN^ */
+JsonSink::~JsonSink() {}
+
+/**
+ * o͐ɔf
+ * @return fłtrue
+ */
+bool JsonSink::Flush()
+{
+  return true;
+}
+
+/**
+ * RXgN^
+ * @param[in,out] str o͐̕(ɒǉ)
+ */
+JsonStringSink::JsonStringSink(std::string* str)
+  :m_str(str)
+{
+}
+
+/**
+ * o͂
+ * @param[in] data o͂f[^̐擪
+ * @param[in] size o͂f[^̃TCY(byte)
+ * @return true
+ */
+bool JsonStringSink::Write(const char* data, size_t size)
+{
+  m_str->append(data, size);
+  return true;
+}
+
+/**
+ * RXgN^
+ * @param[in,out] file o͐̃t@C(oCi[hŊJ. ̂͌Ăяo)
+ */
+JsonFileSink::JsonFileSink(std::FILE* file)
+  :m_file(file)
+{
+}
+
+/**
+ * o͂
+ * @param[in] data o͂f[^̐擪
+ * @param[in] size o͂f[^̃TCY(byte)
+ * @return Sď߂true
+ */
+bool JsonFileSink::Write(const char* data, size_t size)
+{
+  return std::fwrite(data, 1, size, m_file) == size;
+}
+
+/**
+ * o͐ɔf(fflush)
+ * @return fłtrue
+ */
+bool JsonFileSink::Flush()
+{
+  return std::fflush(m_file) == 0;
+}
+
+/**
+ * RXgN^
+ * @param[in,out] stream o͐̃Xg[
+ */
+JsonStreamSink::JsonStreamSink(std::ostream* stream)
+  :m_stream(stream)
+{
+}
+
+/**
+ * o͂
+ * @param[in] data o͂f[^̐擪
+ * @param[in] size o͂f[^̃TCY(byte)
+ * @return Xg[łtrue
+ */
+bool JsonStreamSink::Write(const char* data, size_t size)
+{
+  m_stream->write(data, static_cast<std::streamsize>(size));
+  return !m_stream->fail();
+}
+
+/**
+ * o͐ɔf(std::flush)
+ * @return Xg[łtrue
+ */
+bool JsonStreamSink::Flush()
+{
+  m_stream->flush();
+  return !m_stream->fail();
+}
+}
@@ -0,0 +1,170 @@
+/**
+ * @file   JsonStructuralIndex.cpp
+ * @brief  JSON̍\CfbNX
+ * @author kyo
+ * @date   2026/10/17
+ */
+#include "JsonStructuralIndex.h"
+#include "JsonScan.h"
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+/** Analysis Drive */
+namespace adlib
+{
+namespace
+{
+/**
+ * ʃrbg̗ݐXOR߂
+ * @param[in] bits rbg
+ * @return bit i, bit 0~iXORi[
+ * @remarks '"'̃rbg, string^̒(Jn'"'܂, I'"'܂܂Ȃ)̃rbg߂
+ */
+inline std::uint64_t PrefixXor(std::uint64_t bits)
+{
+  bits ^= bits << 1;
+  bits ^= bits << 2;
+  bits ^= bits << 4;
+  bits ^= bits << 8;
+  bits ^= bits << 16;
+  bits ^= bits << 32;
+  return bits;
+}
+
+/**
+ * '\\'ɂăGXP[vꂽ̃rbg߂
+ * @param[in]     backslash   '\\'̃rbg
+ * @param[in,out] prevEscaped ÕubN̍Ō'\\'Ŏ̕GXP[vĂ1(̃ubNpɍXV)
+ * @return GXP[vꂽ̃rbg
+ * @remarks A'\\'̂Ԗڂ̒̕GXP[v. <br>
+ *          ʒu/ʒun܂'\\'̘AŽオŔ肷(simdjsonƓ@).
+ */
+inline std::uint64_t FindEscaped(std::uint64_t backslash, std::uint64_t* prevEscaped)
+{
+  const std::uint64_t EVEN_BITS = 0x5555555555555555ULL;
+  backslash &= ~*prevEscaped;
+  const std::uint64_t followsEscape = (backslash << 1) | *prevEscaped;
+  const std::uint64_t oddSequenceStarts = backslash & ~EVEN_BITS & ~followsEscape;
+  const std::uint64_t sequencesStartingOnEvenBits = oddSequenceStarts + backslash;
+  // オ肪, ̃ubN̐擪GXP[v
+  *prevEscaped = (sequencesStartingOnEvenBits < oddSequenceStarts) ? 1 : 0;
+  const std::uint64_t invertMask = sequencesStartingOnEvenBits << 1;
+  return (EVEN_BITS ^ invertMask) & followsEscape;
+}
+
+/**
+ * ŉʂ1rbg̈ʒu擾
+ * @param[in] bits 0ȊO̒l
+ * @return ŉʂ1rbg̈ʒu
+ */
+inline unsigned CountTrailingZeros64(std::uint64_t bits)
+{
+#if defined(_MSC_VER) && defined(_M_X64)
+  unsigned long index;
+  _BitScanForward64(&index, bits);
+  return static_cast<unsigned>(index);
+#elif defined(_MSC_VER)
+  unsigned long index;
+  if (_BitScanForward(&index, static_cast<unsigned long>(bits))) return static_cast<unsigned>(index);
+  _BitScanForward(&index, static_cast<unsigned long>(bits >> 32));
+  return static_cast<unsigned>(index) + 32;
+#else
+  return static_cast<unsigned>(__builtin_ctzll(bits));
+#endif
+}
+}
+
+//! xɃCfbNX쐬ubN(64KB)
+const size_t JsonStructuralIndex::CHUNK_BLOCKS = 1024;
+
+/**
+ * RXgN^
+ * @param[in] data  ̐擪
+ * @param[in] size  ̃TCY
+ * @param[in] start CfbNX쐬Jnʒu
+ */
+JsonStructuralIndex::JsonStructuralIndex(const char* data, size_t size, size_t start)
+  :m_data(data),
+   m_size(size),
+   m_blockStart(start),
+   m_count(0),
+   m_next(0),
+   m_prevInString(0),
+   m_prevEscaped(0),
+   m_prevScalar(0)
+{
+}
+
+/**
+ * ̃ubNQ̃CfbNX쐬
+ * @return 쐬łtrue(̍Ōłfalse)
+ */
+bool JsonStructuralIndex::IndexChunk()
+{
+  m_count = 0;
+  m_next = 0;
+  // 1ubNōő64̂, ݐɊmۂĂ
+  if (m_positions.size() < CHUNK_BLOCKS * JsonScan::BLOCK_SIZE) m_positions.resize(CHUNK_BLOCKS * JsonScan::BLOCK_SIZE);
+  // \܂ŃubNQƂɍ쐬
+  while (m_count == 0)
+  {
+    if (m_blockStart >= m_size) return false;
+    for (size_t n = 0; n < CHUNK_BLOCKS && m_blockStart < m_size; ++n)
+    {
+      const size_t rest = m_size - m_blockStart;
+      if (rest >= JsonScan::BLOCK_SIZE)
+      {
+        this->IndexBlock(m_data + m_blockStart, m_blockStart, ~static_cast<std::uint64_t>(0));
+        m_blockStart += JsonScan::BLOCK_SIZE;
+      }
+      else
+      {
+        // Ō64bytẽubN̓zCgXy[XŖ߂č쐬
+        char block[JsonScan::BLOCK_SIZE];
+        std::memset(block, ' ', sizeof(block));
+        std::memcpy(block, m_data + m_blockStart, rest);
+        this->IndexBlock(block, m_blockStart, (static_cast<std::uint64_t>(1) << rest) - 1);
+        m_blockStart = m_size;
+      }
+    }
+  }
+  return true;
+}
+
+/**
+ * 1ubÑCfbNX쐬
+ * @param[in] block ubN̐擪(64byteǂݍ߂邱)
+ * @param[in] start ubN̐擪̈ʒu
+ * @param[in] valid ubN̂Lbit
+ */
+void JsonStructuralIndex::IndexBlock(const char* block, size_t start, std::uint64_t valid)
+{
+  JsonScan::BlockMasks masks;
+  JsonScan::ClassifyBlock(block, &masks);
+
+  // GXP[vĂȂ'"', string^̒߂
+  const std::uint64_t quote = masks.quote & ~FindEscaped(masks.backslash, &m_prevEscaped);
+  const std::uint64_t inString = PrefixXor(quote) ^ m_prevInString;
+  m_prevInString = static_cast<std::uint64_t>(static_cast<std::int64_t>(inString) >> 63);
+
+  // string^ȊO̒l(number^, true, false, null)̐擪߂
+  const std::uint64_t scalar = ~(masks.whitespace | masks.op | quote | inString);
+  const std::uint64_t scalarStart = scalar & ~((scalar << 1) | m_prevScalar);
+  m_prevScalar = scalar >> 63;
+
+  // \, string^̊Jn'"', ̑̒l̐擪
+  std::uint64_t structural = ((masks.op & ~inString) | (quote & inString) | scalarStart) & valid;
+  // ̈͊mۍς݂̂, vfmFɏ
+  size_t* out = m_positions.data() + m_count;
+  while (structural != 0)
+  {
+    *out++ = start + CountTrailingZeros64(structural);
+    structural &= structural - 1;
+  }
+  m_count = static_cast<size_t>(out - m_positions.data());
+}
+}
@@ -7,12 +7,8 @@
 
 #include "JsonValue.h"
 #include "JsonValueString.h"
-#include "JsonValueInt.h"
-#include "JsonValueDouble.h"
-#include "JsonValueBool.h"
 #include "JsonValueArray.h"
 #include "JsonValueObject.h"
-#include "IncludeMsgpack.h"
 #include <string>
 #include <vector>
 #include <unordered_map>
@@ -20,205 +16,122 @@
 /** Analysis Drive */
 namespace adlib
 {
-// O錾
-class Json;
+// ftHgl̓vO̊Jnɍ쐬
+// (֐̐ÓIϐ, RpCɂĂ͏̌ĂяoXbhŋ邽)
+//! ftHgnulll
+const Json JsonValue::DEFAULT_NULL;
+//! ftHgstringl
+const std::string JsonValue::DEFAULT_STRING;
+//! ftHgarrayl(const)
+const Json::Array JsonValue::DEFAULT_CONST_ARRAY;
+//! ftHgobjectl(const)
+const Json::Object JsonValue::DEFAULT_CONST_OBJECT;
+//! ftHgarrayl(const. ύXꂽꍇ̂ݏ)
+Json::Array JsonValue::s_defaultArray;
+//! ftHgobjectl(const. ύXꂽꍇ̂ݏ)
+Json::Object JsonValue::s_defaultObject;
 
 /**
- * ftHgstringlget
- * @return 󕶎
- * @note VOgɂ邽, JsonValue͐؂藣, ֐ɐÓIȃftHgl
+ * QƂO(Ō̎QƂłΔj)
+ * @param[in] p    l
+ * @param[in] type ľ^
  */
-static const std::string& DefaultString()
+void JsonValue::Release(JsonValue* p, Json::JSON_VALUE_TYPE type)
 {
-  static const JsonValueString defaultString("");
-  return defaultString.GetString();
+  // Ō̎QƂłȂΉȂ
+  if (!p->RemoveRef()) return;
+
+  // ^ɉĔj
+  switch (type)
+  {
+    case Json::JSON_VALUE_TYPE::STRING:
+      JsonValue::Destroy(static_cast<JsonValueString*>(p));
+      break;
+    case Json::JSON_VALUE_TYPE::ARRAY:
+      JsonValue::Destroy(static_cast<JsonValueArray*>(p));
+      break;
+    case Json::JSON_VALUE_TYPE::OBJECT:
+      JsonValue::Destroy(static_cast<JsonValueObject*>(p));
+      break;
+    default:
+      // q[vɒul͏L̂
+      break;
+  }
 }
 
 /**
- * ftHgnumberl(int)get
- * @return 0
- * @note VOgɂ邽, JsonValue͐؂藣, ֐ɐÓIȃftHgl
+ * l̊mۂɎgpA[iL
+ * @param[in] root p[Xʂ̍ŏʂ̒l
  */
-static int DefaultInt()
+void JsonValue::OwnArena(const Json& root)
 {
-  static const JsonValueInt defaultInt(0);
-  return defaultInt.GetNumberInt();
+  if (!root.IsString() && !root.IsArray() && !root.IsObject()) return;
+  JsonValue* const p = root.m_value.m_heap;
+  // q[vmۂl, Lς݂̒l͉Ȃ
+  if (p->m_arenaOwner || p->m_allocator.Arena() == nullptr) return;
+  p->m_allocator.Arena()->AddOwner();
+  p->m_arenaOwner = true;
 }
 
 /**
- * ftHgnumberl(double)get
- * @return 0
- * @note VOgɂ邽, JsonValue͐؂藣, ֐ɐÓIȃftHgl
+ * ftHgnulllget
+ * @return null
  */
-static double DefaultDouble()
+const Json& JsonValue::DefaultNull()
 {
-  static const JsonValueDouble defaultDouble(0.0);
-  return defaultDouble.GetNumberDouble();
+  return JsonValue::DEFAULT_NULL;
 }
 
 /**
- * ftHgboollget
- * @return false
- * @note VOgɂ邽, JsonValue͐؂藣, ֐ɐÓIȃftHgl
+ * ftHgstringlget
+ * @return 󕶎
  */
-static bool DefaultBool()
+const std::string& JsonValue::DefaultString()
 {
-  static const JsonValueBool defaultBool(false);
-  return defaultBool.GetBool();
+  return JsonValue::DEFAULT_STRING;
 }
 
 /**
  * ftHgarraylget
- * @return vector
- * @note VOgɂ邽, JsonValue͐؂藣, ֐ɐÓIȃftHgl
+ * @return vector
+ * @attention Ԃl̓vOŜŋL. Xbh瓯ɌĂ΂Ȃ
+ *            (const̃o֐͌Ă΂Ȃ)
  */
-static Json::Array& DefaultArray()
+Json::Array& JsonValue::DefaultArray()
 {
-  static JsonValueArray defaultArray;
-  // ĂԂ(ςĂꍇ邽)
-  defaultArray = JsonValueArray();
-  return defaultArray.GetArray();
+  // ύXĂꍇ̂ݏ(ύXĂȂΏ܂Ȃ)
+  if (!JsonValue::s_defaultArray.empty()) JsonValue::s_defaultArray = Json::Array();
+  return JsonValue::s_defaultArray;
 }
 
 /**
  * ftHgarraylget(const)
- * @return vector
- * @note VOgɂ邽, JsonValue͐؂藣, ֐ɐÓIȃftHgl
+ * @return vector
  */
-static const Json::Array& DefaultConstArray()
+const Json::Array& JsonValue::DefaultConstArray()
 {
-  static const JsonValueArray defaultArray;
-  return defaultArray.GetArray();
+  return JsonValue::DEFAULT_CONST_ARRAY;
 }
 
 /**
  * ftHgobjectlget
- * @return map
- * @note VOgɂ邽, JsonValue͐؂藣, ֐ɐÓIȃftHgl
+ * @return map
+ * @attention Ԃl̓vOŜŋL. Xbh瓯ɌĂ΂Ȃ
+ *            (const̃o֐͌Ă΂Ȃ)
  */
-static Json::Object& DefaultObject()
+Json::Object& JsonValue::DefaultObject()
 {
-  static JsonValueObject defaultObject;
-  // ĂԂ(ςĂꍇ邽)
-  defaultObject = JsonValueObject();
-  return defaultObject.GetObject();
+  // ύXĂꍇ̂ݏ(ύXĂȂΏ܂Ȃ)
+  if (!JsonValue::s_defaultObject.empty()) JsonValue::s_defaultObject = Json::Object();
+  return JsonValue::s_defaultObject;
 }
 
 /**
  * ftHgobjectlget(const)
- * @return map
- * @note VOgɂ邽, JsonValue͐؂藣, ֐ɐÓIȃftHgl
- */
-static const Json::Object& DefaultConstObject()
-{
-  static const JsonValueObject defaultObject;
-  return defaultObject.GetObject();
-}
-
-/**
- * stringlget
- * @return stringl
- * @remarks I[o[ChȂꍇ̓ <br>
- *          󕶎""Ԃ
- */
-const std::string& JsonValue::GetString() const
-{
-  return DefaultString();
-}
-
-/**
- * numberl(int)get
- * @return numberl(int)
- * @remarks I[o[ChȂꍇ̓ <br>
- *          0Ԃ
- */
-int JsonValue::GetNumberInt() const
-{
-  return DefaultInt();
-}
-
-/**
- * numberl(double)get
- * @return numberl(double)
- * @remarks I[o[ChȂꍇ̓ <br>
- *          0.0Ԃ
- */
-double JsonValue::GetNumberDouble() const
-{
-  return DefaultDouble();
-}
-
-/**
- * boollget
- * @return booll
- * @remarks I[o[ChȂꍇ̓ <br>
- *          falseԂ
- */
-bool JsonValue::GetBool() const
-{
-  return DefaultBool();
-}
-
-/**
- * arraylget
- * @return arrayl
- * @remarks I[o[ChȂꍇ̓ <br>
- *          vectorԂ
- */
-Json::Array& JsonValue::GetArray()
-{
-  return DefaultArray();
-}
-
-/**
- * arraylget(const)
- * @return arrayl
- * @remarks I[o[ChȂꍇ̓ <br>
- *          vectorԂ
- */
-const Json::Array& JsonValue::GetArray() const
-{
-  return DefaultConstArray();
-}
-
-/**
- * objectlget
- * @return objectl
- * @remarks I[o[ChȂꍇ̓ <br>
- *          mapԂ
- */
-Json::Object& JsonValue::GetObject()
-{
-  return DefaultObject();
-}
-
-/**
- * objectlget(const)
- * @return objectl
- * @remarks I[o[ChȂꍇ̓ <br>
- *          mapԂ
- */
-const Json::Object& JsonValue::GetObject() const
-{
-  return DefaultConstObject();
-}
-
-/**
- * JSON`̕o
- * @param[in,out] outStream o͐̃Xg[
- */
-void JsonValue::Dump(std::ostream* outStream) const
-{
-  // nullo
-  *outStream << "null" << std::flush;
-}
-
-/**
- * MessagePack`̃oCio
- * @param[in,out] outStream o͐̃Xg[
+ * @return map
  */
-void JsonValue::DumpMsgpack(std::ostream* outStream) const
+const Json::Object& JsonValue::DefaultConstObject()
 {
-  msgpack::pack(outStream, msgpack::type::nil());
+  return JsonValue::DEFAULT_CONST_OBJECT;
 }
 }
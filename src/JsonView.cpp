@@ -0,0 +1,260 @@
+/**
+ * @file   JsonView.cpp
+ * @brief  JSONIuWFNg̎Q
+ * @author kyo
+ * @date   2026/10/17
+ */
+#include "JsonView.h"
+#include "JsonObject.h"
+#include <climits>
+#include <cstdint>
+#include <string>
+
+/** Analysis Drive */
+namespace adlib
+{
+/**
+ * ^擾
+ * @return ^
+ */
+Json::JSON_VALUE_TYPE JsonView::GetValueType() const
+{
+  return this->GetJson().GetValueType();
+}
+
+/**
+ * nullǂ
+ * @return nullȂtrue
+ */
+bool JsonView::IsNull() const
+{
+  return this->GetJson().IsNull();
+}
+
+/**
+ * stringǂ
+ * @return stringȂtrue
+ */
+bool JsonView::IsString() const
+{
+  return this->GetJson().IsString();
+}
+
+/**
+ * number(int, int64 or double)ǂ
+ * @return numberȂtrue
+ */
+bool JsonView::IsNumber() const
+{
+  return this->GetJson().IsNumber();
+}
+
+/**
+ * boolǂ
+ * @return boolȂtrue
+ */
+bool JsonView::IsBool() const
+{
+  return this->GetJson().IsBool();
+}
+
+/**
+ * arrayǂ
+ * @return arrayȂtrue
+ */
+bool JsonView::IsArray() const
+{
+  return this->GetJson().IsArray();
+}
+
+/**
+ * objectǂ
+ * @return objectȂtrue
+ */
+bool JsonView::IsObject() const
+{
+  return this->GetJson().IsObject();
+}
+
+/**
+ * stringlget
+ * @return stringl
+ */
+const std::string& JsonView::GetString() const
+{
+  return this->GetJson().GetString();
+}
+
+/**
+ * stringl̎QƂget
+ * @return stringl̎Q(stringȊO͋󕶎)
+ */
+JsonStringView JsonView::GetStringView() const
+{
+  return this->GetJson().GetStringView();
+}
+
+/**
+ * numberl(int)get
+ * @return numberl(int)
+ */
+int JsonView::GetNumberInt() const
+{
+  return this->GetJson().GetNumberInt();
+}
+
+/**
+ * numberl(int64)get
+ * @return numberl(int64)
+ */
+std::int64_t JsonView::GetNumberInt64() const
+{
+  return this->GetJson().GetNumberInt64();
+}
+
+/**
+ * number(double)get
+ * @return numberl(double)
+ */
+double JsonView::GetNumberDouble() const
+{
+  return this->GetJson().GetNumberDouble();
+}
+
+/**
+ * boollget
+ * @return booll
+ */
+bool JsonView::GetBool() const
+{
+  return this->GetJson().GetBool();
+}
+
+/**
+ * arrayl(double̘Ä)get
+ * @return vf̎Q(ÄɕێĂȂ΋)
+ */
+JsonSpan<double> JsonView::GetDoubleSpan() const
+{
+  return this->GetJson().GetDoubleSpan();
+}
+
+/**
+ * arrayl(int64̘Ä)get
+ * @return vf̎Q(ÄɕێĂȂ΋)
+ */
+JsonSpan<std::int64_t> JsonView::GetInt64Span() const
+{
+  return this->GetJson().GetInt64Span();
+}
+
+/**
+ * vf擾
+ * @return array̗vf, object̃o(ȊO0)
+ */
+size_t JsonView::Size() const
+{
+  const Json& json = this->GetJson();
+  if (json.IsDoubleArray()) return json.GetDoubleSpan().Size();
+  if (json.IsInt64Array()) return json.GetInt64Span().Size();
+  if (json.IsArray()) return json.GetArray().size();
+  if (json.IsObject()) return json.GetObject().size();
+  return 0;
+}
+
+/**
+ * vf擾
+ * @param[in] index ʒu
+ * @return array̗vf, object̃o̒l(ǉ. ͈͊Ołnull)
+ * @remarks ÄɕێĂarraył, vfƂJsonIuWFNg쐬Ȃ
+ */
+JsonView JsonView::operator[](size_t index) const
+{
+  const Json& json = this->GetJson();
+  JsonView view;
+
+  // Ä̗vf͒lRs[ĕێ
+  if (json.IsDoubleArray())
+  {
+    const JsonSpan<double> numbers = json.GetDoubleSpan();
+    if (index < numbers.Size()) view.m_scalar = Json(numbers[index]);
+    return view;
+  }
+  if (json.IsInt64Array())
+  {
+    // int^͈͓̔łnumber(int), ȊOnumber(int64)
+    const JsonSpan<std::int64_t> numbers = json.GetInt64Span();
+    if (index >= numbers.Size()) return view;
+    const std::int64_t number = numbers[index];
+    if (number >= INT_MIN && number <= INT_MAX) view.m_scalar = Json(static_cast<int>(number));
+    else view.m_scalar = Json(number);
+    return view;
+  }
+
+  if (json.IsArray())
+  {
+    const Json::Array& array = json.GetArray();
+    if (index < array.size()) view.m_node = &array[index];
+  }
+  else if (json.IsObject())
+  {
+    const Json::Object& object = json.GetObject();
+    if (index < object.size()) view.m_node = &object.nth(index)->second;
+  }
+  return view;
+}
+
+/**
+ * object̃oname擾
+ * @param[in] index ʒu(ǉ)
+ * @return name(objectłȂ, ܂͔͈͊Oł΋󕶎)
+ */
+JsonStringView JsonView::GetName(size_t index) const
+{
+  const Json& json = this->GetJson();
+  if (!json.IsObject()) return JsonStringView();
+  const Json::Object& object = json.GetObject();
+  if (index >= object.size()) return JsonStringView();
+  return JsonStringView(object.nth(index)->first.GetString());
+}
+
+/**
+ * objectnameɑΉl擾
+ * @param[in] name name
+ * @return l(objectłȂ, ܂namenull)
+ */
+JsonView JsonView::At(const std::string& name) const
+{
+  return JsonView(this->GetJson().Find(name));
+}
+
+/**
+ * objectnameɑΉl擾(C)
+ * @param[in] name name
+ * @return l(objectłȂ, ܂namenull)
+ */
+JsonView JsonView::At(const char* name) const
+{
+  return JsonView(this->GetJson().Find(name));
+}
+
+/**
+ * objectnameɑΉl擾(JsonKey)
+ * @param[in] name name
+ * @return l(objectłȂ, ܂namenull)
+ */
+JsonView JsonView::At(const JsonKey& name) const
+{
+  return JsonView(this->GetJson().Find(name));
+}
+
+/**
+ * objectname邩ǂ
+ * @param[in] name name
+ * @return true(lnullłtrue)
+ */
+bool JsonView::Contains(const std::string& name) const
+{
+  return this->GetJson().Find(name) != nullptr;
+}
+}
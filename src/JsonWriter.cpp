@@ -0,0 +1,439 @@
+/**
+ * @file   JsonWriter.cpp
+ * @brief  JSON`̏̕o
+ * @author kyo
+ * @date   2026/10/17
+ */
+#include "JsonWriter.h"
+#include "FormatDouble.h"
+#include "JsonObject.h"
+#include "JsonScan.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+/** Analysis Drive */
+namespace adlib
+{
+//> obt@TCY̏l(byte)
+const size_t JsonWriter::DEFAULT_BUFFER_SIZE = 64 * 1024;
+//> 1̐l̏o͂ɕKvȍőTCY(byte)
+const size_t JsonWriter::NUMBER_BUFFER_SIZE = FORMAT_DOUBLE_BUFFER_SIZE;
+//> G[bZ[W --- o͐ɏ߂Ȃ
+const std::string JsonWriter::ERR_MSG_WRITE_FAILURE("Failed to Write JSON to Sink.");
+
+/**
+ * RXgN^
+ * @param[in,out] sink       o͐
+ * @param[in]     bufferSize obt@TCY(byte)
+ */
+JsonWriter::JsonWriter(JsonSink* sink, size_t bufferSize)
+  :m_sink(sink),
+   m_buffer(std::max(bufferSize, JsonWriter::NUMBER_BUFFER_SIZE)),
+   m_used(0),
+   m_afterKey(false)
+{
+}
+
+/** fXgN^(obt@Ɏco͂o͐ɓn) */
+JsonWriter::~JsonWriter()
+{
+  this->Flush();
+}
+
+/** obt@̓eo͐ɓn */
+void JsonWriter::FlushBuffer()
+{
+  if (m_used == 0) return;
+  // ݂Ɏs͏o͂̂Ă
+  if (m_errorMsg.empty() && !m_sink->Write(m_buffer.data(), m_used)) m_errorMsg = JsonWriter::ERR_MSG_WRITE_FAILURE;
+  m_used = 0;
+}
+
+/**
+ * obt@̋󂫂mۂ
+ * @param[in] size KvȃTCY(byte. obt@TCYȉ)
+ * @return ݈ʒu
+ */
+char* JsonWriter::Reserve(size_t size)
+{
+  if (m_buffer.size() - m_used < size) this->FlushBuffer();
+  return m_buffer.data() + m_used;
+}
+
+/**
+ * 1o͂
+ * @param[in] c 
+ */
+void JsonWriter::Put(char c)
+{
+  if (m_used == m_buffer.size()) this->FlushBuffer();
+  m_buffer[m_used++] = c;
+}
+
+/**
+ * ̂܂܏o͂
+ * @param[in] data ̐擪
+ * @param[in] size ̃TCY(byte)
+ */
+void JsonWriter::Put(const char* data, size_t size)
+{
+  if (m_buffer.size() - m_used < size)
+  {
+    this->FlushBuffer();
+    // obt@傫Βڏo͐ɓn
+    if (size >= m_buffer.size())
+    {
+      if (m_errorMsg.empty() && !m_sink->Write(data, size)) m_errorMsg = JsonWriter::ERR_MSG_WRITE_FAILURE;
+      return;
+    }
+  }
+  std::memcpy(m_buffer.data() + m_used, data, size);
+  m_used += size;
+}
+
+/**
+ * o͂
+ * @param[in] value l
+ */
+void JsonWriter::PutInt64(std::int64_t value)
+{
+  char* const out = this->Reserve(JsonWriter::NUMBER_BUFFER_SIZE);
+
+  // ̌쐬(͐Βlunsignedň)
+  char digits[20];
+  size_t count = 0;
+  std::uint64_t magnitude = (value < 0) ? (0 - static_cast<std::uint64_t>(value)) : static_cast<std::uint64_t>(value);
+  do
+  {
+    digits[count++] = static_cast<char>('0' + magnitude % 10);
+    magnitude /= 10;
+  } while (magnitude != 0);
+
+  size_t size = 0;
+  if (value < 0) out[size++] = '-';
+  while (count > 0) out[size++] = digits[--count];
+  m_used += size;
+}
+
+/**
+ * _o͂
+ * @param[in] value l
+ */
+void JsonWriter::PutDouble(double value)
+{
+  // NaN, JSONŕ\łȂnull
+  if (value - value != 0)
+  {
+    this->Put("null", 4);
+    return;
+  }
+  // ̒lɖ߂ŒZ10i
+  m_used += FormatDouble(value, this->Reserve(JsonWriter::NUMBER_BUFFER_SIZE));
+}
+
+/**
+ * GXP[v'"'ň͂ŏo͂
+ * @param[in] data ̐擪
+ * @param[in] size ̃TCY(byte)
+ */
+void JsonWriter::PutString(const char* data, size_t size)
+{
+  this->Put('\"');
+  size_t begin = 0;
+  while (true)
+  {
+    // GXP[vsvȕ͂܂Ƃ߂ďo͂
+    const size_t pos = JsonScan::FindEscapeCharacter(data, size, begin);
+    this->Put(data + begin, pos - begin);
+    if (pos == size) break;
+
+    const unsigned char c = static_cast<unsigned char>(data[pos]);
+    char* const out = this->Reserve(6);
+    out[0] = '\\';
+    switch (c)
+    {
+      case '\"': out[1] = '\"'; break;
+      case '\\': out[1] = '\\'; break;
+      case '\b': out[1] = 'b'; break;
+      case '\f': out[1] = 'f'; break;
+      case '\n': out[1] = 'n'; break;
+      case '\r': out[1] = 'r'; break;
+      case '\t': out[1] = 't'; break;
+      default:
+        // ȊO̐䕶\u00XX
+        out[1] = 'u';
+        out[2] = '0';
+        out[3] = '0';
+        out[4] = "0123456789ABCDEF"[c >> 4];
+        out[5] = "0123456789ABCDEF"[c & 0x0F];
+        m_used += 4;
+        break;
+    }
+    m_used += 2;
+    begin = pos + 1;
+  }
+  this->Put('\"');
+}
+
+/**
+ * lo͂(vf, oǂ)
+ * @param[in] json l
+ */
+void JsonWriter::PutValue(const Json& json)
+{
+  switch (json.GetValueType())
+  {
+    case Json::JSON_VALUE_TYPE::STRING:
+    {
+      const JsonStringView view = json.GetStringView();
+      this->PutString(view.Data(), view.Size());
+      break;
+    }
+    case Json::JSON_VALUE_TYPE::NUMBER_INT:
+    case Json::JSON_VALUE_TYPE::NUMBER_INT64:
+      this->PutInt64(json.GetNumberInt64());
+      break;
+    case Json::JSON_VALUE_TYPE::NUMBER_DOUBLE:
+      this->PutDouble(json.GetNumberDouble());
+      break;
+    case Json::JSON_VALUE_TYPE::BOOL:
+      if (json.GetBool()) this->Put("true", 4);
+      else this->Put("false", 5);
+      break;
+    case Json::JSON_VALUE_TYPE::ARRAY:
+    {
+      this->Put('[');
+      // ^tarray͘Ä悩o͂
+      if (json.IsDoubleArray())
+      {
+        const JsonSpan<double> numbers = json.GetDoubleSpan();
+        for (size_t n = 0; n < numbers.Size(); ++n)
+        {
+          if (n > 0) this->Put(',');
+          this->PutDouble(numbers[n]);
+        }
+      }
+      else if (json.IsInt64Array())
+      {
+        const JsonSpan<std::int64_t> numbers = json.GetInt64Span();
+        for (size_t n = 0; n < numbers.Size(); ++n)
+        {
+          if (n > 0) this->Put(',');
+          this->PutInt64(numbers[n]);
+        }
+      }
+      else
+      {
+        const Json::Array& array = json.GetArray();
+        for (size_t n = 0; n < array.size(); ++n)
+        {
+          if (n > 0) this->Put(',');
+          this->PutValue(array[n]);
+        }
+      }
+      this->Put(']');
+      break;
+    }
+    case Json::JSON_VALUE_TYPE::OBJECT:
+    {
+      this->Put('{');
+      bool first = true;
+      for (const auto& member : json.GetObject())
+      {
+        if (!first) this->Put(',');
+        first = false;
+        const std::string& name = member.first.GetString();
+        this->PutString(name.data(), name.size());
+        this->Put(':');
+        this->PutValue(member.second);
+      }
+      this->Put('}');
+      break;
+    }
+    default:
+      this->Put("null", 4);
+      break;
+  }
+}
+
+/** Cxgɂl̏o͂̑O(Kvł','o͂) */
+void JsonWriter::BeginValue()
+{
+  // object̃o̒l(','namȇOɏo͍ς)
+  if (m_afterKey)
+  {
+    m_afterKey = false;
+    return;
+  }
+  // array2ڈȍ~̗vf
+  if (!m_counts.empty() && m_counts.back()++ > 0) this->Put(',');
+}
+
+/**
+ * lŜo͂
+ * @param[in] json l
+ * @return ɏo͂łtrue
+ */
+bool JsonWriter::Write(const Json& json)
+{
+  this->BeginValue();
+  this->PutValue(json);
+  return m_errorMsg.empty();
+}
+
+/**
+ * obt@̓eo͐ɓn, o͐ɔf
+ * @return ɏo͂łtrue
+ */
+bool JsonWriter::Flush()
+{
+  this->FlushBuffer();
+  if (m_errorMsg.empty() && !m_sink->Flush()) m_errorMsg = JsonWriter::ERR_MSG_WRITE_FAILURE;
+  return m_errorMsg.empty();
+}
+
+/**
+ * G[bZ[W擾
+ * @return G[bZ[W(ł΋)
+ */
+const std::string& JsonWriter::ErrorMessage() const
+{
+  return m_errorMsg;
+}
+
+/**
+ * nullo͂
+ * @return ɏo͂łtrue
+ */
+bool JsonWriter::Null()
+{
+  this->BeginValue();
+  this->Put("null", 4);
+  return m_errorMsg.empty();
+}
+
+/**
+ * boollo͂
+ * @param[in] value l
+ * @return ɏo͂łtrue
+ */
+bool JsonWriter::Bool(bool value)
+{
+  this->BeginValue();
+  if (value) this->Put("true", 4);
+  else this->Put("false", 5);
+  return m_errorMsg.empty();
+}
+
+/**
+ * numberl(int)o͂
+ * @param[in] value l
+ * @return ɏo͂łtrue
+ */
+bool JsonWriter::Int(int value)
+{
+  return this->Int64(value);
+}
+
+/**
+ * numberl(int64)o͂
+ * @param[in] value l
+ * @return ɏo͂łtrue
+ */
+bool JsonWriter::Int64(std::int64_t value)
+{
+  this->BeginValue();
+  this->PutInt64(value);
+  return m_errorMsg.empty();
+}
+
+/**
+ * numberl(double)o͂
+ * @param[in] value l
+ * @return ɏo͂łtrue
+ */
+bool JsonWriter::Double(double value)
+{
+  this->BeginValue();
+  this->PutDouble(value);
+  return m_errorMsg.empty();
+}
+
+/**
+ * stringlo͂
+ * @param[in] value l
+ * @return ɏo͂łtrue
+ */
+bool JsonWriter::String(const std::string& value)
+{
+  this->BeginValue();
+  this->PutString(value.data(), value.size());
+  return m_errorMsg.empty();
+}
+
+/**
+ * object̊Jn('{')o͂
+ * @return ɏo͂łtrue
+ */
+bool JsonWriter::StartObject()
+{
+  this->BeginValue();
+  this->Put('{');
+  m_counts.push_back(0);
+  return m_errorMsg.empty();
+}
+
+/**
+ * objectnameo͂
+ * @param[in] name name
+ * @return ɏo͂łtrue
+ */
+bool JsonWriter::Key(const std::string& name)
+{
+  // 2ڈȍ~̃o
+  if (!m_counts.empty() && m_counts.back()++ > 0) this->Put(',');
+  this->PutString(name.data(), name.size());
+  this->Put(':');
+  m_afterKey = true;
+  return m_errorMsg.empty();
+}
+
+/**
+ * object̏I('}')o͂
+ * @param[in] memberCount object̃o(gpȂ)
+ * @return ɏo͂łtrue
+ */
+bool JsonWriter::EndObject(size_t /*memberCount*/)
+{
+  this->Put('}');
+  if (!m_counts.empty()) m_counts.pop_back();
+  return m_errorMsg.empty();
+}
+
+/**
+ * arraẙJn('[')o͂
+ * @return ɏo͂łtrue
+ */
+bool JsonWriter::StartArray()
+{
+  this->BeginValue();
+  this->Put('[');
+  m_counts.push_back(0);
+  return m_errorMsg.empty();
+}
+
+/**
+ * array̏I(']')o͂
+ * @param[in] elementCount array̗vf(gpȂ)
+ * @return ɏo͂łtrue
+ */
+bool JsonWriter::EndArray(size_t /*elementCount*/)
+{
+  this->Put(']');
+  if (!m_counts.empty()) m_counts.pop_back();
+  return m_errorMsg.empty();
+}
+}
@@ -0,0 +1,210 @@
+/**
+ * @file   MappedFile.cpp
+ * @brief  ǂݍݐp̃}bvht@C
+ * @author kyo
+ * @date   2026/10/17
+ */
+#include "MappedFile.h"
+#include <memory>
+#include <string>
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#undef GetObject
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+/** Analysis Drive */
+namespace adlib
+{
+//! PimplCfBI
+class MappedFile::Impl
+{
+public:
+  //! }bv̈̐擪
+  const char* m_data;
+  //! }bv̈̃TCY
+  size_t m_size;
+#if defined(_WIN32)
+  //! t@Cnh
+  HANDLE m_file;
+  //! t@C}bsOnh
+  HANDLE m_mapping;
+#else
+  //! t@CfBXNv^
+  int m_file;
+#endif
+
+  /** RXgN^ */
+  Impl()
+    :m_data(nullptr),
+     m_size(0),
+#if defined(_WIN32)
+     m_file(INVALID_HANDLE_VALUE),
+     m_mapping(nullptr)
+#else
+     m_file(-1)
+#endif
+  {
+  }
+
+  /** fXgN^ */
+  ~Impl()
+  {
+    Close();
+  }
+
+  /**
+   * t@C}bv
+   * @param[in] path t@CpX
+   * @return true
+   */
+  bool Open(const std::string& path);
+
+  /**
+   * A}bv
+   */
+  void Close();
+};
+
+#if defined(_WIN32)
+/**
+ * t@C}bv
+ * @param[in] path t@CpX
+ * @return true
+ */
+bool MappedFile::Impl::Open(const std::string& path)
+{
+  // t@CJ(擪珇ɓǂނƂOSɓ`)
+  m_file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+    OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+  if (m_file == INVALID_HANDLE_VALUE) return false;
+
+  // TCY擾
+  LARGE_INTEGER size;
+  if (!GetFileSizeEx(m_file, &size)) return false;
+  // vZX̃AhXԂɎ܂ȂΎs
+  if (static_cast<unsigned long long>(size.QuadPart) > static_cast<unsigned long long>(static_cast<size_t>(-1))) return false;
+  m_size = static_cast<size_t>(size.QuadPart);
+  // TCY0̃t@C̓}bvłȂ̂, ƂĐ
+  if (m_size == 0) return true;
+
+  // }bv
+  m_mapping = CreateFileMappingA(m_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  if (m_mapping == nullptr) return false;
+  m_data = static_cast<const char*>(MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0));
+  return m_data != nullptr;
+}
+
+/**
+ * A}bv
+ */
+void MappedFile::Impl::Close()
+{
+  if (m_data != nullptr) UnmapViewOfFile(m_data);
+  if (m_mapping != nullptr) CloseHandle(m_mapping);
+  if (m_file != INVALID_HANDLE_VALUE) CloseHandle(m_file);
+  m_data = nullptr;
+  m_size = 0;
+  m_mapping = nullptr;
+  m_file = INVALID_HANDLE_VALUE;
+}
+#else
+/**
+ * t@C}bv
+ * @param[in] path t@CpX
+ * @return true
+ */
+bool MappedFile::Impl::Open(const std::string& path)
+{
+  // t@CJ
+  m_file = open(path.c_str(), O_RDONLY);
+  if (m_file < 0) return false;
+
+  // TCY擾
+  struct stat st;
+  if (fstat(m_file, &st) != 0) return false;
+  m_size = static_cast<size_t>(st.st_size);
+  // TCY0̃t@C̓}bvłȂ̂, ƂĐ
+  if (m_size == 0) return true;
+
+  // }bv
+  void* p = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, m_file, 0);
+  if (p == MAP_FAILED) return false;
+  m_data = static_cast<const char*>(p);
+  // 擪珇ɓǂނƂOSɓ`
+  madvise(p, m_size, MADV_SEQUENTIAL);
+  return true;
+}
+
+/**
+ * A}bv
+ */
+void MappedFile::Impl::Close()
+{
+  if (m_data != nullptr) munmap(const_cast<char*>(m_data), m_size);
+  if (m_file >= 0) close(m_file);
+  m_data = nullptr;
+  m_size = 0;
+  m_file = -1;
+}
+#endif
+
+/** RXgN^ */
+MappedFile::MappedFile()
+  :m_impl(std::make_unique<Impl>())
+{
+}
+
+/** zfXgN^ */
+MappedFile::~MappedFile() {}
+
+/**
+ * t@C}bv
+ * @param[in] path t@CpX
+ * @return true
+ */
+bool MappedFile::Open(const std::string& path)
+{
+  // Õt@CA}bv
+  m_impl->Close();
+  // s͓r܂ŊĴ
+  if (!m_impl->Open(path))
+  {
+    m_impl->Close();
+    return false;
+  }
+  return true;
+}
+
+/**
+ * A}bv
+ */
+void MappedFile::Close()
+{
+  m_impl->Close();
+}
+
+/**
+ * }bv̈̐擪擾
+ * @return ̈̐擪(}bvĂȂnullptr)
+ */
+const char* MappedFile::Data() const
+{
+  return m_impl->m_data;
+}
+
+/**
+ * }bv̈̃TCY擾
+ * @return TCY(byte)
+ */
+size_t MappedFile::Size() const
+{
+  return m_impl->m_size;
+}
+}
@@ -6,11 +6,23 @@
  */
 #include "MsgpackParser.h"
 #include "Json.h"
+#include "JsonArena.h"
+#include "JsonArrayBuilder.h"
+#include "JsonBind.h"
+#include "JsonBindHandler.h"
+#include "JsonHandler.h"
+#include "JsonKey.h"
+#include "JsonKeyTable.h"
+#include "JsonValue.h"
 #include "IncludeMsgpack.h"
+#include <istream>
 #include <memory>
 #include <vector>
 #include <unordered_map>
 #include <string>
+#include <utility>
+#include <cstdint>
+#include <climits>
 
 /** Analysis Drive */
 namespace adlib
@@ -19,10 +31,19 @@ namespace adlib
 class MsgpackParser::Impl
 {
 public:
+  //> nhɂ钆f(OƂē)
+  struct StopParsing {};
+
   //> G[bZ[Wi[obt@TCY
   static const size_t BUFFER_SIZE;
+  //> Xg[xɓǂݍރTCY
+  static const size_t STREAM_BUFFER_SIZE;
   //> G[bZ[W --- \ʃG[
   static const std::string ERR_MSG_UNKNOWN;
+  //> G[bZ[W --- number^()int64^͈̔͊O̒l
+  static const std::string ERR_MSG_INT_NUMBER_OUT_OF_RANGE;
+  //> G[bZ[W --- Xg[̍Ō̃R[hrŏIĂ
+  static const std::string ERR_MSG_INCOMPLETE_RECORD;
   //> [jObZ[W --- mapnamedĂ
   static const std::string WRN_MSG_NAME_REPEATED;
   //> [jObZ[W --- Ή̌^(Binary^)o
@@ -38,15 +59,49 @@ public:
   std::vector<std::string> m_warningMsg;
   //> MapnamedtO
   bool m_nameRepeated;
+  //> A[i[h(trueł1̃A[iSĂ̒lmۂ)
+  bool m_arenaMode;
+  //> lmۂA[i(A[igpȂnullptr. p[Xʂ̍ŏʂ̒lL)
+  std::shared_ptr<JsonArena> m_arena;
+  //> JsonIuWFNg̊mۂɎgpAP[^
+  Json::Allocator m_allocator;
+  //> 쐬rarray̗vfςލƗ̈(eʂێ܂܍ėp)
+  JsonArrayBuilder::Stack m_arrayStack;
+  //> Qƃ[h(truełstringl͓̓obt@QƂ)
+  bool m_stringViewMode;
+  //> ǂݍݒ̃Xg[
+  std::istream* m_stream;
+  //> Xg[p̃fVACU(Xg[ǂݏI邩, G[ɂȂΔj)
+  std::unique_ptr<msgpack::unpacker> m_unpacker;
+  //> fVACYʂ̊i[̈(ParseƂɋɂčėp)
+  msgpack::zone m_zone;
+  //> mapnamẽC^[e[u(Parse, StartStreamƂɋɂ)
+  JsonKeyTable m_keys;
+  //> nhɒʒmstringl, namẽobt@(ParseEventsōėp)
+  std::string m_eventBuffer;
 
   /**
    * RXgN^
+   * @param[in] arenaMode A[i[h
+   * @param[in] stringViewMode Qƃ[h
    */
-  Impl()
-    :m_nameRepeated(false)
+  Impl(bool arenaMode, bool stringViewMode)
+    :m_nameRepeated(false),
+     m_arenaMode(arenaMode),
+     m_arena(arenaMode ? JsonArena::CreateShared() : nullptr),
+     m_allocator(m_arena.get()),
+     m_stringViewMode(stringViewMode),
+     m_stream(nullptr)
   {
   }
 
+  /**
+   * Õp[Xʂ
+   * @remarks A[i[h, Qƃ[h͈p. <br>
+   *          Õp[XʂSĔjĂ, A[iėp.
+   */
+  void Reset();
+
   /**
    * G[bZ[W쐬
    * @param[in] messageTemp G[bZ[W
@@ -65,6 +120,7 @@ public:
   /**
    * number^()Ƀp[X
    * @param[in] msgobj MessagePackIuWFNg
+   * @remarks int^͈̔͊Oint64^ɂ(int64^͈̔͊O̓G[)
    */
   Json ParseNumberInt(const msgpack::object& msgobj);
 
@@ -91,12 +147,42 @@ public:
    * @param[in] msgobj MessagePackIuWFNg
    */
   Json ParseValue(const msgpack::object& msgobj);
+
+  /**
+   * nh̖߂lmF(falseł΃p[X𒆒f)
+   * @param[in] result nh̖߂l
+   */
+  void CheckHandlerResult(bool result)
+  {
+    if (!result) throw StopParsing();
+  }
+
+  /**
+   * valuep[XăCxgʒm
+   * @param[in]     msgobj  MessagePackIuWFNg
+   * @param[in,out] handler Cxg̒ʒm
+   */
+  void ParseValueEvents(const msgpack::object& msgobj, JsonHandler* handler);
+
+  /**
+   * Xg[玟̃R[hfVACY
+   * @param[out] result i[
+   * @return R[htrue(Xg[̍Ōłfalse)
+   * @remarks 1̃R[h낤܂, TCYXg[ǂݍ
+   */
+  bool UnpackNext(msgpack::object* result);
 };
 
 //> G[bZ[Wi[obt@TCY
 const size_t MsgpackParser::Impl::BUFFER_SIZE = 256;
+//> Xg[xɓǂݍރTCY
+const size_t MsgpackParser::Impl::STREAM_BUFFER_SIZE = 64 * 1024;
 //> G[bZ[W --- \ʃG[
 const std::string MsgpackParser::Impl::ERR_MSG_UNKNOWN("Unknown Error.");
+//> G[bZ[W --- number^()int64^͈̔͊O̒l
+const std::string MsgpackParser::Impl::ERR_MSG_INT_NUMBER_OUT_OF_RANGE("\"%s\" is out of Integer Range.");
+//> G[bZ[W --- Xg[̍Ō̃R[hrŏIĂ
+const std::string MsgpackParser::Impl::ERR_MSG_INCOMPLETE_RECORD("Last Record is Incomplete.");
 //> [jObZ[W --- mapnamedĂ
 const std::string MsgpackParser::Impl::WRN_MSG_NAME_REPEATED("Name \"%s\" Repeated, and Later Name is Given Priority.");
 //> [jObZ[W --- Ή̌^(Binary^)o
@@ -106,6 +192,38 @@ const std::string MsgpackParser::Impl::WRN_MSG_EXTENSION_TYPE_EXIST("Extension T
 //> [jObZ[W --- Ή̌^o
 const std::string MsgpackParser::Impl::WRN_MSG_UNKNOWN_TYPE_EXIST("Unknown Type is Detected, and null is Given Value.");
 
+/**
+ * Õp[Xʂ
+ * @remarks A[i[h, Qƃ[h͈p. <br>
+ *          Õp[XʂSĔjĂ, A[iėp.
+ */
+void MsgpackParser::Impl::Reset()
+{
+  m_errorMsg.clear();
+  m_warningMsg.clear();
+  m_nameRepeated = false;
+  m_stream = nullptr;
+  m_unpacker.reset();
+  m_keys.Clear();
+  m_arrayStack.Clear();
+
+  // AP[^
+  if (!m_arenaMode)
+  {
+    m_arena.reset();
+  }
+  else if (m_arena && m_arena->OwnerCount() == 1)
+  {
+    // Õp[XʂSĔjĂ(̃p[T[݂̂LĂ), A[iėp
+    m_arena->Reset();
+  }
+  else
+  {
+    m_arena = JsonArena::CreateShared();
+  }
+  m_allocator = Json::Allocator(m_arena.get());
+}
+
 /**
  * G[bZ[W쐬
  * @param[in] messageTemp G[bZ[W
@@ -122,30 +240,58 @@ const std::string MsgpackParser::Impl::MakeErrorMsg(const std::string& messageTe
   return std::string(buf);
 }
 
+/**
+ * fVACYɓ̓obt@QƂ^ǂ
+ * @param[in] type     MessagePacǩ^
+ * @param[in] length   TCY
+ * @param[in] userData [U[f[^(gp)
+ * @return string^łtrue(MessagePackzoneɃRs[ɓ̓obt@QƂ)
+ */
+static bool ReferenceString(msgpack::type::object_type type, size_t /*length*/, void* /*userData*/)
+{
+  return type == msgpack::type::object_type::STR;
+}
+
 /**
  * string^Ƀp[X
  * @param[in] msgobj MessagePackIuWFNg
  */
 Json MsgpackParser::Impl::ParseString(const msgpack::object& msgobj)
 {
-  // string^ɃRo[g
-  std::string str;
-  msgobj.convert(&str);
+  // Qƃ[hł͓̓obt@QƂ(Xg[̃obt@͍ėp邽ߎQƂȂ)
+  if (m_stringViewMode && m_unpacker == nullptr)
+  {
+    // string^JsonIuWFNg(Q)Ԃ
+    return Json(JsonStringView(msgobj.via.str.ptr, msgobj.via.str.size), m_allocator);
+  }
   // string^JsonIuWFNgԂ
-  return Json(str);
+  return Json(std::string(msgobj.via.str.ptr, msgobj.via.str.size), m_allocator);
 }
 
 /**
  * number^()Ƀp[X
  * @param[in] msgobj MessagePackIuWFNg
+ * @remarks int^͈̔͊Oint64^ɂ(int64^͈̔͊O̓G[)
  */
 Json MsgpackParser::Impl::ParseNumberInt(const msgpack::object& msgobj)
 {
-  // int^ɃRo[g
-  int num;
-  msgobj.convert(&num);
-  // int^JsonIuWFNgԂ
-  return Json(num);
+  // ̐
+  if (msgobj.type == msgpack::type::object_type::NEGATIVE_INTEGER)
+  {
+    const std::int64_t num = msgobj.via.i64;
+    // int^͈͓̔łint^JsonIuWFNg, ȊOint64^JsonIuWFNgԂ
+    if (num >= INT_MIN) return Json(static_cast<int>(num));
+    return Json(num);
+  }
+
+  // ̐
+  const std::uint64_t num = msgobj.via.u64;
+  // int^͈͓̔łint^JsonIuWFNgԂ
+  if (num <= static_cast<std::uint64_t>(INT_MAX)) return Json(static_cast<int>(num));
+  // int64^͈͓̔łint64^JsonIuWFNgԂ
+  if (num <= static_cast<std::uint64_t>(INT64_MAX)) return Json(static_cast<std::int64_t>(num));
+  // int64^͈̔͊O(uint64)̓G[bZ[W𓊂
+  throw MakeErrorMsg(Impl::ERR_MSG_INT_NUMBER_OUT_OF_RANGE, std::to_string(num));
 }
 
 /**
@@ -168,11 +314,14 @@ Json MsgpackParser::Impl::ParseNumberDouble(const msgpack::object& msgobj)
 Json MsgpackParser::Impl::ParseObject(const msgpack::object& msgobj)
 {
   // obt@p
-  Json::Object obj;
+  Json::Object obj(m_allocator);
 
   // vfΊi[
   if (msgobj.via.map.size > 0U)
   {
+    // vfĂ邽, ɗ̈mۂ
+    obj.reserve(msgobj.via.map.size);
+
     //
     // L͖̏{MessagePack̃R[hobject.cQlɂ
     //
@@ -184,26 +333,37 @@ Json MsgpackParser::Impl::ParseObject(const msgpack::object& msgobj)
     // I[܂Ń[v(vf[v)
     for (; p < pend; ++p)
     {
-      // L[擾
-      std::string key;
-      p->key.convert(&key);
+      // L[擾(string^ł, fVACYʂ璼ڃC^[e[u)
+      JsonKey key;
+      if (p->key.type == msgpack::type::object_type::STR)
+      {
+        key = m_keys.Intern(p->key.via.str.ptr, p->key.via.str.size);
+      }
+      else
+      {
+        std::string name;
+        p->key.convert(&name);
+        key = m_keys.Intern(name.data(), name.size());
+      }
 
+      // L[o^(o^ς݂̃nbVlg)
+      const auto result = obj.emplace(std::move(key), Json());
       // L[dĂꍇ
-      if (obj.count(key) > 0)
+      if (!result.second)
       {
         // dtOĂ
         m_nameRepeated = true;
         // [jObZ[Wi[
         m_warningMsg.emplace_back(
-          MakeErrorMsg(Impl::WRN_MSG_NAME_REPEATED, key));
+          MakeErrorMsg(Impl::WRN_MSG_NAME_REPEATED, result.first->first.GetString()));
       }
 
       // li[
-      obj[key] = this->ParseValue(p->val);
+      result.first->second = this->ParseValue(p->val);
     }
   }
   // object^JsonIuWFNgԂ
-  return Json(obj);
+  return Json(std::move(obj));
 }
 
 /**
@@ -212,12 +372,15 @@ Json MsgpackParser::Impl::ParseObject(const msgpack::object& msgobj)
  */
 Json MsgpackParser::Impl::ParseArray(const msgpack::object& msgobj)
 {
-  // obt@p
-  Json::Array arr;
+  // obt@p(vfSnumberłΘÄɊi[)
+  JsonArrayBuilder arr(m_allocator, &m_arrayStack);
 
   // vfΊi[
   if (msgobj.via.array.size > 0U)
   {
+    // vfĂ邽, ɗ̈mۂ
+    arr.Reserve(msgobj.via.array.size);
+
     //
     // L͖̏{MessagePack̃R[hobject.cQlɂ
     //
@@ -230,11 +393,11 @@ Json MsgpackParser::Impl::ParseArray(const msgpack::object& msgobj)
     for (; p < pend; ++p)
     {
       // li[
-      arr.emplace_back(this->ParseValue(*p));
+      arr.Append(this->ParseValue(*p));
     }
   }
   // array^JsonIuWFNgԂ
-  return Json(arr);
+  return arr.Build();
 }
 
 /**
@@ -288,9 +451,139 @@ Json MsgpackParser::Impl::ParseValue(const msgpack::object& msgobj)
   }
 }
 
+/**
+ * valuep[XăCxgʒm
+ * @param[in]     msgobj  MessagePackIuWFNg
+ * @param[in,out] handler Cxg̒ʒm
+ * @remarks ʒmlParseValuěʂƓ(int^͈̔͊ÔInt64, Ή̌^Null)
+ */
+void MsgpackParser::Impl::ParseValueEvents(const msgpack::object& msgobj, JsonHandler* handler)
+{
+  // object^Cv
+  switch (msgobj.type)
+  {
+    case msgpack::type::object_type::BOOLEAN:
+      this->CheckHandlerResult(handler->Bool(msgobj.via.boolean));
+      return;
+
+    case msgpack::type::object_type::FLOAT:
+      this->CheckHandlerResult(handler->Double(msgobj.via.f64));
+      return;
+
+    case msgpack::type::object_type::NEGATIVE_INTEGER:
+      // int^͈͓̔łInt, ȊOInt64
+      if (msgobj.via.i64 >= INT_MIN) this->CheckHandlerResult(handler->Int(static_cast<int>(msgobj.via.i64)));
+      else this->CheckHandlerResult(handler->Int64(msgobj.via.i64));
+      return;
+
+    case msgpack::type::object_type::POSITIVE_INTEGER:
+      // int^͈͓̔łInt, int64^͈͓̔łInt64
+      if (msgobj.via.u64 <= static_cast<std::uint64_t>(INT_MAX))
+      {
+        this->CheckHandlerResult(handler->Int(static_cast<int>(msgobj.via.u64)));
+      }
+      else if (msgobj.via.u64 <= static_cast<std::uint64_t>(INT64_MAX))
+      {
+        this->CheckHandlerResult(handler->Int64(static_cast<std::int64_t>(msgobj.via.u64)));
+      }
+      else
+      {
+        // int64^͈̔͊O(uint64)̓G[bZ[W𓊂
+        throw MakeErrorMsg(Impl::ERR_MSG_INT_NUMBER_OUT_OF_RANGE, std::to_string(msgobj.via.u64));
+      }
+      return;
+
+    case msgpack::type::object_type::STR:
+      m_eventBuffer.assign(msgobj.via.str.ptr, msgobj.via.str.size);
+      this->CheckHandlerResult(handler->String(m_eventBuffer));
+      return;
+
+    case msgpack::type::object_type::NIL:
+      this->CheckHandlerResult(handler->Null());
+      return;
+
+    case msgpack::type::object_type::ARRAY:
+    {
+      this->CheckHandlerResult(handler->StartArray());
+      msgpack::object* p = msgobj.via.array.ptr;
+      msgpack::object* const pend = msgobj.via.array.ptr + msgobj.via.array.size;
+      for (; p < pend; ++p) this->ParseValueEvents(*p, handler);
+      this->CheckHandlerResult(handler->EndArray(msgobj.via.array.size));
+      return;
+    }
+
+    case msgpack::type::object_type::MAP:
+    {
+      this->CheckHandlerResult(handler->StartObject());
+      msgpack::object_kv* p = msgobj.via.map.ptr;
+      msgpack::object_kv* const pend = msgobj.via.map.ptr + msgobj.via.map.size;
+      for (; p < pend; ++p)
+      {
+        // L[ʒm(string^ȊOstring^ɃRo[g)
+        if (p->key.type == msgpack::type::object_type::STR) m_eventBuffer.assign(p->key.via.str.ptr, p->key.via.str.size);
+        else p->key.convert(&m_eventBuffer);
+        this->CheckHandlerResult(handler->Key(m_eventBuffer));
+        // lʒm
+        this->ParseValueEvents(p->val, handler);
+      }
+      this->CheckHandlerResult(handler->EndObject(msgobj.via.map.size));
+      return;
+    }
+
+    case msgpack::type::object_type::BIN:
+      // Binary^͖ΉȂ̂, [jObZ[Wi[
+      m_warningMsg.emplace_back(Impl::WRN_MSG_BINARY_TYPE_EXIST);
+      // ꉞnullƂĂ
+      this->CheckHandlerResult(handler->Null());
+      return;
+
+    case msgpack::type::object_type::EXT:
+      // Extension^͖ΉȂ̂, [jObZ[Wi[
+      m_warningMsg.emplace_back(Impl::WRN_MSG_EXTENSION_TYPE_EXIST);
+      // ꉞnullƂĂ
+      this->CheckHandlerResult(handler->Null());
+      return;
+
+    default:
+      // Ή̌^Ȃ̂, [jObZ[Wi[
+      m_warningMsg.emplace_back(Impl::WRN_MSG_UNKNOWN_TYPE_EXIST);
+      // ꉞnullƂĂ
+      this->CheckHandlerResult(handler->Null());
+      return;
+  }
+}
+
+/**
+ * Xg[玟̃R[hfVACY
+ * @param[out] result i[
+ * @return R[htrue(Xg[̍Ōłfalse)
+ * @remarks 1̃R[h낤܂, TCYXg[ǂݍ
+ */
+bool MsgpackParser::Impl::UnpackNext(msgpack::object* result)
+{
+  // obt@ɃR[h낤܂œǂݍ
+  // (next̓R[hƂzoneVmۂ邽, executeŃfVACYzoneėp)
+  while (!m_unpacker->execute())
+  {
+    // Xg[̍Ō
+    if (!m_stream->good())
+    {
+      // ǂݎc, ܂̓fVACYr̃R[h΃G[bZ[W𓊂
+      if (m_unpacker->nonparsed_size() > 0 || m_unpacker->parsed_size() > 0) throw Impl::ERR_MSG_INCOMPLETE_RECORD;
+      return false;
+    }
+    // fVACŨobt@ɒړǂݍ(fVACYς݂̗͍̈ėp)
+    m_unpacker->reserve_buffer(Impl::STREAM_BUFFER_SIZE);
+    m_stream->read(m_unpacker->buffer(), static_cast<std::streamsize>(m_unpacker->buffer_capacity()));
+    m_unpacker->buffer_consumed(static_cast<size_t>(m_stream->gcount()));
+  }
+  *result = m_unpacker->data();
+  return true;
+}
+
 /** RXgN^ */
 MsgpackParser::MsgpackParser()
-  : m_impl(std::make_unique<Impl>())
+  : m_impl(std::make_unique<Impl>(false, false))
 {
 }
 
@@ -305,18 +598,21 @@ MsgpackParser::~MsgpackParser() {}
  */
 Json MsgpackParser::Parse(const std::string& target)
 {
-  // Õp[Xʂ
-  m_impl = std::make_unique<Impl>();
+  // Õp[Xʂ(A[i[h, Qƃ[h͈p)
+  m_impl->Reset();
 
-  // fVACY
-  msgpack::unpacked result;
-  msgpack::unpack(result, target.data(), target.size());
-  const msgpack::object& msgobj = result.get();
+  // fVACY(Qƃ[hłstring^Rs[Ȃ, zone͑Ö̗ėp)
+  m_impl->m_zone.clear();
+  const msgpack::object msgobj =
+    msgpack::unpack(m_impl->m_zone, target.data(), target.size(), m_impl->m_stringViewMode ? &ReferenceString : nullptr);
 
   try
   {
     // p[X
-    return m_impl->ParseValue(msgobj);
+    Json json = m_impl->ParseValue(msgobj);
+    // A[imۂꍇ, ŏʂ̒lA[iL
+    JsonValue::OwnArena(json);
+    return json;
   }
   catch (const std::string& err)
   {
@@ -334,6 +630,179 @@ Json MsgpackParser::Parse(const std::string& target)
   }
 }
 
+/**
+ * MessagePack`̕p[X, ǂݍ񂾒lnhɒʒm
+ * @param[in]     target  p[XΏۂ̕
+ * @param[in,out] handler Cxg̒ʒm
+ * @return Ō܂Ńp[Xłtrue(G[, ܂̓nhɂ钆f̏ꍇfalse)
+ * @attention ܂ł̃G[bZ[W⃏[jObZ[W
+ */
+bool MsgpackParser::ParseEvents(const std::string& target, JsonHandler* handler)
+{
+  // Õp[Xʂ(A[i[h, Qƃ[h͈p)
+  m_impl->Reset();
+
+  try
+  {
+    // fVACY(ʒm͓͂LȂ, string^͏ɃRs[Ȃ)
+    m_impl->m_zone.clear();
+    const msgpack::object msgobj = msgpack::unpack(m_impl->m_zone, target.data(), target.size(), &ReferenceString);
+    // p[XĒʒm
+    m_impl->ParseValueEvents(msgobj, handler);
+    return true;
+  }
+  catch (const Impl::StopParsing&)
+  {
+    // nhɂ钆f̓G[ƂȂ
+    return false;
+  }
+  catch (const std::string& err)
+  {
+    // G[bZ[Wi[
+    m_impl->m_errorMsg.emplace_back(err);
+    return false;
+  }
+  catch (...) // \ʃG[(MessagePack֘ÃG[Ȃ)
+  {
+    // G[bZ[Wi[
+    m_impl->m_errorMsg.emplace_back(Impl::ERR_MSG_UNKNOWN);
+    return false;
+  }
+}
+
+/**
+ * MessagePack`̕p[X, i[ɒڊi[
+ * @param[in] target p[XΏۂ̕
+ * @param[in] value  i[
+ * @return Ō܂Ŋi[łtrue
+ * @attention ܂ł̃G[bZ[W⃏[jObZ[W
+ */
+bool MsgpackParser::ParseIntoTarget(const std::string& target, const JsonBindTarget& value)
+{
+  // ǂݍ񂾒li[Ɋi[nhŃp[X
+  JsonBindHandler handler(value);
+  if (this->ParseEvents(target, &handler)) return true;
+  // i[łȂ(nhɂ钆f), G[bZ[Wi[
+  if (!handler.ErrorMessage().empty()) m_impl->m_errorMsg.emplace_back(handler.ErrorMessage());
+  return false;
+}
+
+/**
+ * Xg[̓ǂݍ݂Jn
+ * @param[in,out] stream ̓Xg[(MessagePack`̃R[hA)
+ * @attention ܂ł̃G[bZ[W⃏[jObZ[W
+ */
+void MsgpackParser::StartStream(std::istream* stream)
+{
+  // Õp[Xʂ(A[i[h, Qƃ[h͈p)
+  m_impl->Reset();
+  m_impl->m_stream = stream;
+  m_impl->m_unpacker = std::make_unique<msgpack::unpacker>();
+}
+
+/**
+ * Xg[玟̃R[hp[X
+ * @param[out] record i[
+ * @return R[hp[Xłtrue(Xg[̍Ō, ܂̓G[̏ꍇfalse)
+ */
+bool MsgpackParser::ParseNext(Json* record)
+{
+  // Xg[ǂݏIĂ, ܂̓G[
+  if (m_impl->m_unpacker == nullptr) return false;
+  // ÕR[h̍쐬r̗vfj(G[Œfꍇ)
+  m_impl->m_arrayStack.Clear();
+  // A[i[hł̓R[hƂɃA[i𕪂(ǂݏIR[hjΉ)
+  if (m_impl->m_arenaMode)
+  {
+    if (m_impl->m_arena && m_impl->m_arena->OwnerCount() == 1)
+    {
+      // ÕR[hSĔjĂ, A[iėp
+      m_impl->m_arena->Reset();
+    }
+    else
+    {
+      m_impl->m_arena = JsonArena::CreateShared();
+      m_impl->m_allocator = Json::Allocator(m_impl->m_arena.get());
+    }
+  }
+
+  try
+  {
+    // fVACY
+    msgpack::object msgobj;
+    if (m_impl->UnpackNext(&msgobj))
+    {
+      // p[X(A[imۂꍇ, ŏʂ̒lA[iL)
+      *record = m_impl->ParseValue(msgobj);
+      JsonValue::OwnArena(*record);
+      // ̃R[hɔăfVACU(zone͋ɂčėp)
+      m_impl->m_unpacker->reset_zone();
+      m_impl->m_unpacker->reset();
+      return true;
+    }
+  }
+  catch (const std::string& err)
+  {
+    // G[bZ[Wi[
+    m_impl->m_errorMsg.emplace_back(err);
+  }
+  catch (...) // \ʃG[(MessagePack֘ÃG[Ȃ)
+  {
+    // G[bZ[Wi[
+    m_impl->m_errorMsg.emplace_back(Impl::ERR_MSG_UNKNOWN);
+  }
+  // Xg[̍Ō, ܂̓G[̏ꍇ͈ȍ~̃R[hǂ܂Ȃ
+  m_impl->m_unpacker.reset();
+  m_impl->m_stream = nullptr;
+  return false;
+}
+
+/**
+ * ێĂobt@ƃA[i
+ * @attention ܂ł̃G[bZ[W⃏[jObZ[W
+ */
+void MsgpackParser::ReleaseBuffers()
+{
+  // Pimpl蒼(A[i[h, Qƃ[h͈p)
+  m_impl = std::make_unique<Impl>(m_impl->m_arenaMode, m_impl->m_stringViewMode);
+}
+
+/**
+ * Qƃ[hݒ肷
+ * @param[in] stringViewMode trueł, ȍ~ParsestringlRs[ɓ͂QƂ
+ */
+void MsgpackParser::SetStringViewMode(bool stringViewMode)
+{
+  m_impl->m_stringViewMode = stringViewMode;
+}
+
+/**
+ * Qƃ[hǂ
+ * @return Qƃ[hłtrue
+ */
+bool MsgpackParser::IsStringViewMode() const
+{
+  return m_impl->m_stringViewMode;
+}
+
+/**
+ * A[i[hݒ肷
+ * @param[in] arenaMode trueł, ȍ~ParseőSĂ̒l1̃A[imۂ
+ */
+void MsgpackParser::SetArenaMode(bool arenaMode)
+{
+  m_impl->m_arenaMode = arenaMode;
+}
+
+/**
+ * A[i[hǂ
+ * @return A[i[hłtrue
+ */
+bool MsgpackParser::IsArenaMode() const
+{
+  return m_impl->m_arenaMode;
+}
+
 /**
  * G[bZ[W擾
  * @return G[bZ[W̃Rei(ł΃TCY0)